@@ -0,0 +1,150 @@
+/*** aapcsCall.s   ***/
+/* Calling-convention check wrapper for the functions in asmMult.s.
+ * See aapcsCheck.h.
+ */
+
+/* Tell the assembler to allow both 16b and 32b extended Thumb instructions */
+.syntax unified
+.thumb
+
+/* aapcsFrame offsets; checked against aapcsCheck.h in aapcsCheck.c */
+.equ OFF_FN,          0
+.equ OFF_ARGS,        4
+.equ OFF_SEED,        20
+.equ OFF_AFTER,       52
+.equ OFF_RESULT,      84
+.equ OFF_SP_BEFORE,   88
+.equ OFF_SP_AFTER,    92
+.equ OFF_STACK_USED,  96
+.equ OFF_CYCLES,      100
+
+/* DWT->CYCCNT */
+.equ DWT_CYCCNT,      0xE0001004
+
+/* AAPCS_STACK_PAINT_BYTES and AAPCS_STACK_PAINT_WORD in aapcsCheck.h */
+.equ PAINT_BYTES,     512
+.equ PAINT_WORD,      0xA5C3A5C3
+
+/* room below the painted area for an exception frame (104 bytes with the
+ * FPU state); AAPCS_EXC_ROOM in aapcsCheck.h */
+.equ EXC_ROOM,        128
+
+.text
+.align
+
+.global aapcsCall
+.type aapcsCall,%function
+.global aapcsLeaveReturn
+
+/* function: aapcsCall
+ *    inputs:   aapcsCurrent: frame set up by aapcsPrepare()
+ *    outputs:  r0: r0 returned by the function
+ *              memory: result, after[], spBefore, spAfter, stackUsed and
+ *                      cycles in the frame
+ *
+ * Nothing the called function does to r4-r11 or SP can stop the wrapper
+ * getting back: it finds the frame again through aapcsCurrent, and restores
+ * SP from the frame before popping its own registers.
+ */
+.thumb_func
+aapcsCall:
+    push    {r4-r11, lr}
+
+    /* r12 = frame; remember the SP the function must return with */
+    ldr     r12, =aapcsCurrent
+    ldr     r12, [r12]
+    mov     r0, sp
+    str     r0, [r12, #OFF_SP_BEFORE]
+
+    /* paint the stack the function may use */
+    sub     r1, r0, #PAINT_BYTES
+    ldr     r2, =PAINT_WORD
+paint:
+    str     r2, [r1], #4
+    cmp     r1, r0
+    blo     paint
+
+    /* seed the callee-saved registers and start the clock. Every
+     * register is taken once the arguments are loaded, so the start count
+     * waits in the frame; the instructions between the two readings are
+     * the same every call (aapcsCheckInit() measures them). */
+    add     r0, r12, #OFF_SEED
+    ldmia   r0, {r4-r11}
+    ldr     r0, =DWT_CYCCNT
+    ldr     r0, [r0]
+    str     r0, [r12, #OFF_CYCLES]
+
+    /* a sandboxed call drops to unprivileged here rather than in
+     * sandboxBegin(), since the DWT is out of reach of unprivileged code */
+    ldr     r0, =sandboxDropPending
+    ldrb    r0, [r0]
+    cbz     r0, privileged
+    mrs     r0, control
+    orr     r0, r0, #1
+    msr     control, r0
+    isb
+privileged:
+
+    /* load the arguments, and call */
+    add     r0, r12, #OFF_ARGS
+    ldmia   r0, {r0-r3}
+    ldr     r12, [r12, #OFF_FN]
+    blx     r12
+
+    /* r12 = SP as the function left it. Leaving the sandbox takes an
+     * exception, so first move SP below the painted area, where the
+     * exception frame cannot count as stack the function used. */
+    mov     r12, sp
+    ldr     lr, =aapcsCurrent
+    ldr     lr, [lr]
+    ldr     lr, [lr, #OFF_SP_BEFORE]
+    sub     lr, lr, #(PAINT_BYTES + EXC_ROOM)
+    mov     sp, lr
+
+    /* regain privilege (the SVC keeps r0-r3 and r12), then stop the
+     * clock */
+    mrs     lr, control
+    tst     lr, #1
+    beq     stopClock
+    bl      sandboxLeave
+aapcsLeaveReturn:   /* the only return address sandboxLeave() takes here */
+stopClock:
+    ldr     lr, =DWT_CYCCNT
+    ldr     lr, [lr]
+
+    /* save what the function left in r0, r4-r11 and SP, and the time */
+    push    {r12, lr}
+    ldr     r12, =aapcsCurrent
+    ldr     r12, [r12]
+    str     r0, [r12, #OFF_RESULT]
+    add     r0, r12, #OFF_AFTER
+    stmia   r0, {r4-r11}
+    pop     {r0, r1}
+    str     r0, [r12, #OFF_SP_AFTER]
+    ldr     r0, [r12, #OFF_CYCLES]
+    sub     r1, r1, r0
+    str     r1, [r12, #OFF_CYCLES]
+
+    /* restore SP, then find the lowest painted word that was overwritten */
+    ldr     r0, [r12, #OFF_SP_BEFORE]
+    mov     sp, r0
+    sub     r1, r0, #PAINT_BYTES
+    ldr     r2, =PAINT_WORD
+scan:
+    cmp     r1, r0
+    bhs     scanned
+    ldr     r3, [r1]
+    cmp     r3, r2
+    bne     scanned
+    adds    r1, r1, #4
+    b       scan
+scanned:
+    sub     r1, r0, r1
+    str     r1, [r12, #OFF_STACK_USED]
+
+    ldr     r0, [r12, #OFF_RESULT]
+    pop     {r4-r11, pc}
+
+.ltorg
+
+.end
@@ -0,0 +1,320 @@
+/* ************************************************************************** */
+/** AAPCS register-preservation check and stack high-water measurement
+
+  @File Name
+    aapcsCheck.c
+
+  @Summary
+    Calls an asm function through a wrapper that checks it preserved the
+    callee-saved registers r4-r11 and SP, and measures how much stack it
+    used.
+
+  @Description
+    See aapcsCheck.h. The wrapper itself is aapcsCall() in aapcsCall.s.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "printFuncs.h"  // lab print funcs
+#include "testGuard.h"
+#include "sandbox.h"
+#include "resultStore.h"
+#include "aapcsCheck.h"
+
+#define MAX_PRINT_LEN 400
+
+#define USING_HW 1
+
+/* aapcsCall.s addresses the frame with these offsets */
+_Static_assert(offsetof(aapcsFrame, args) == 4, "aapcsCall.s OFF_ARGS");
+_Static_assert(offsetof(aapcsFrame, seed) == 20, "aapcsCall.s OFF_SEED");
+_Static_assert(offsetof(aapcsFrame, after) == 52, "aapcsCall.s OFF_AFTER");
+_Static_assert(offsetof(aapcsFrame, result) == 84, "aapcsCall.s OFF_RESULT");
+_Static_assert(offsetof(aapcsFrame, spBefore) == 88, "aapcsCall.s OFF_SP_BEFORE");
+_Static_assert(offsetof(aapcsFrame, spAfter) == 92, "aapcsCall.s OFF_SP_AFTER");
+_Static_assert(offsetof(aapcsFrame, stackUsed) == 96, "aapcsCall.s OFF_STACK_USED");
+_Static_assert(offsetof(aapcsFrame, cycles) == 100, "aapcsCall.s OFF_CYCLES");
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint8_t aapcsTxBuffer[MAX_PRINT_LEN] = {0};
+
+/* the frame of the prepared call; read by aapcsCall.s */
+static aapcsFrame frame;
+aapcsFrame * volatile aapcsCurrent = &frame;
+
+static aapcsStats stats[RESULT_NUM_TESTS];
+
+/* calls prepared so far; varies the register seeds */
+static uint32_t aapcsCallCount = 0;
+
+/* testGuardTickCount() when the call was prepared */
+static uint32_t aapcsStartTick = 0;
+
+/* frame.cycles of a call to a function that only returns; the wrapper's
+ * own share of every reading */
+static uint32_t aapcsOverhead = 0;
+
+/* calls timed to find aapcsOverhead; the fastest counts */
+#define AAPCS_OVERHEAD_CALLS 16
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#if USING_HW
+/* the function timed for aapcsOverhead: just the return */
+static uint32_t __attribute__((naked, noinline)) aapcsNull(uint32_t a0,
+        uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    __asm volatile ("bx lr");
+}
+#else
+static uint32_t __attribute__((noinline)) aapcsNull(uint32_t a0,
+        uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    return a0;
+}
+
+uint32_t aapcsCall(void)
+{
+    aapcsFrame *f = aapcsCurrent;
+    uint32_t start = resultStoreCycles();
+    f->result = f->fn(f->args[0], f->args[1], f->args[2], f->args[3]);
+    f->cycles = resultStoreCycles() - start;
+    for (uint32_t i = 0; i < AAPCS_NUM_CONSERVED; ++i)
+    {
+        f->after[i] = f->seed[i];
+    }
+    f->spAfter = f->spBefore;
+    f->stackUsed = 0;
+    return f->result;
+}
+#endif
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void aapcsCheckInit(void)
+{
+    for (uint32_t g = 0; g < RESULT_NUM_TESTS; ++g)
+    {
+        stats[g] = (aapcsStats){0};
+    }
+
+    // time the wrapper around a function that only returns, in the
+    // sandbox if it is on, since leaving it takes an SVC; the fastest call
+    // is the one no interrupt landed in. resultStoreInit() has started
+    // the counter.
+    aapcsOverhead = UINT32_MAX;
+    for (uint32_t i = 0; i < AAPCS_OVERHEAD_CALLS; ++i)
+    {
+        frame = (aapcsFrame){ .fn = aapcsNull };
+        aapcsCurrent = &frame;
+        sandboxDeferDrop();
+        sandboxBegin();
+        aapcsCall();
+        sandboxEnd();
+        if (frame.cycles < aapcsOverhead)
+        {
+            aapcsOverhead = frame.cycles;
+        }
+    }
+}
+
+void aapcsMaskDmac(bool mask)
+{
+#if USING_HW
+    for (uint32_t irq = DMAC_0_IRQn; irq <= DMAC_OTHER_IRQn; ++irq)
+    {
+        if (mask)
+        {
+            NVIC_DisableIRQ((IRQn_Type)irq);
+        }
+        else
+        {
+            NVIC_EnableIRQ((IRQn_Type)irq);
+        }
+    }
+#else
+    (void)mask;
+#endif
+}
+
+void aapcsPrepare(resultTestId group,
+        aapcsFunc fn,
+        uint32_t a0,
+        uint32_t a1,
+        uint32_t a2,
+        uint32_t a3)
+{
+    (void)group;
+    ++aapcsCallCount;
+    frame.fn = fn;
+    frame.args[0] = a0;
+    frame.args[1] = a1;
+    frame.args[2] = a2;
+    frame.args[3] = a3;
+    for (uint32_t i = 0; i < AAPCS_NUM_CONSERVED; ++i)
+    {
+        // r4 = 0x44444444, r5 = 0x55555555, ... with the call number mixed
+        // in so a value left over from the last call does not match
+        frame.seed[i] = (0x11111111UL * (i + 4)) ^ (aapcsCallCount * 0x00010001UL);
+    }
+    frame.spBefore = 0;
+    frame.spAfter = 0;
+    frame.stackUsed = 0;
+    frame.cycles = 0;
+    aapcsCurrent = &frame;
+    // the wrapper writes the frame privileged, around the sandboxed call
+    sandboxDeferDrop();
+    aapcsStartTick = testGuardTickCount();
+}
+
+uint32_t aapcsCheckCase(resultTestId group,
+        uint32_t testCase,
+        volatile bool *txComplete)
+{
+    aapcsStats *s = &stats[group];
+    uint32_t clobbered = 0;
+
+    for (uint32_t i = 0; i < AAPCS_NUM_CONSERVED; ++i)
+    {
+        if (frame.after[i] != frame.seed[i])
+        {
+            clobbered |= 1UL << i;
+        }
+    }
+    if (frame.spAfter != frame.spBefore)
+    {
+        clobbered |= AAPCS_SP_BIT;
+    }
+
+    ++s->calls;
+    // an interrupt during the call would have stacked in the painted area
+    if (testGuardTickCount() == aapcsStartTick)
+    {
+        ++s->stackCalls;
+        if (frame.stackUsed > s->maxStack)
+        {
+            s->maxStack = frame.stackUsed;
+        }
+    }
+    if (clobbered == 0)
+    {
+        return 0;
+    }
+    ++s->badCalls;
+    s->clobbered |= clobbered;
+
+    int len = snprintf((char*)aapcsTxBuffer, MAX_PRINT_LEN,
+            "========= AAPCS: %s test case %lu did not preserve:\r\n",
+            resultTestNames[group], testCase);
+    for (uint32_t i = 0; i < AAPCS_NUM_CONSERVED && len < MAX_PRINT_LEN; ++i)
+    {
+        if ((clobbered & (1UL << i)) != 0)
+        {
+            len += snprintf((char*)aapcsTxBuffer + len, MAX_PRINT_LEN - len,
+                    "  r%lu: 0x%08lx on entry, 0x%08lx on return\r\n",
+                    i + 4, frame.seed[i], frame.after[i]);
+        }
+    }
+    if ((clobbered & AAPCS_SP_BIT) != 0 && len < MAX_PRINT_LEN)
+    {
+        len += snprintf((char*)aapcsTxBuffer + len, MAX_PRINT_LEN - len,
+                "  sp: 0x%08lx on entry, 0x%08lx on return\r\n",
+                frame.spBefore, frame.spAfter);
+    }
+    if (len < MAX_PRINT_LEN)
+    {
+        snprintf((char*)aapcsTxBuffer + len, MAX_PRINT_LEN - len, "\r\n");
+    }
+    printAndWait((char*)aapcsTxBuffer, txComplete);
+    return 1;
+}
+
+uint32_t aapcsLastCycles(void)
+{
+    // AAPCS_GUARD_CALL() masks the DMAC, so only the RTC can interrupt
+    if (testGuardTickCount() != aapcsStartTick)
+    {
+        return RESULT_STORE_UNTIMED;
+    }
+    return frame.cycles > aapcsOverhead ? frame.cycles - aapcsOverhead : 0;
+}
+
+const aapcsStats *aapcsGetStats(resultTestId group)
+{
+    return &stats[group];
+}
+
+void aapcsPrintSummary(volatile bool *txComplete)
+{
+    for (uint32_t g = 0; g < RESULT_NUM_TESTS; ++g)
+    {
+        const aapcsStats *s = &stats[g];
+        if (s->calls == 0)
+        {
+            continue;
+        }
+        const char *atLeast =
+                s->maxStack >= AAPCS_STACK_PAINT_BYTES ? "at least " : "";
+        if (s->badCalls == 0)
+        {
+            snprintf((char*)aapcsTxBuffer, MAX_PRINT_LEN,
+                    "AAPCS: %-10s r4-r11 and sp preserved in all %lu calls; "
+                    "max stack %s%lu bytes\r\n",
+                    resultTestNames[g], s->calls, atLeast, s->maxStack);
+        }
+        else
+        {
+            char regs[40];
+            int len = 0;
+            regs[0] = '\0';
+            for (uint32_t i = 0; i < AAPCS_NUM_CONSERVED; ++i)
+            {
+                if ((s->clobbered & (1UL << i)) != 0)
+                {
+                    len += snprintf(regs + len, sizeof(regs) - len,
+                            " r%lu", i + 4);
+                }
+            }
+            if ((s->clobbered & AAPCS_SP_BIT) != 0)
+            {
+                snprintf(regs + len, sizeof(regs) - len, " sp");
+            }
+            snprintf((char*)aapcsTxBuffer, MAX_PRINT_LEN,
+                    "AAPCS: %-10s FAILED in %lu of %lu calls (changed:%s); "
+                    "max stack %s%lu bytes\r\n",
+                    resultTestNames[g], s->badCalls, s->calls, regs,
+                    atLeast, s->maxStack);
+        }
+        printAndWait((char*)aapcsTxBuffer, txComplete);
+    }
+    printAndWait("\r\n", txComplete);
+}
+
+/* *****************************************************************************
+ End of File
+ */
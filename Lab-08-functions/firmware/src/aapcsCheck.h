@@ -0,0 +1,193 @@
+/* ************************************************************************** */
+/** AAPCS register-preservation check and stack high-water measurement
+
+  @File Name
+    aapcsCheck.h
+
+  @Summary
+    Calls an asm function through a wrapper that checks it preserved the
+    callee-saved registers r4-r11 and SP, and measures how much stack it
+    used.
+
+  @Description
+    aapcsPrepare() names the function and its arguments. aapcsCall() (in
+    aapcsCall.s) then:
+      - paints AAPCS_STACK_PAINT_BYTES below its stack pointer with
+        AAPCS_STACK_PAINT_WORD,
+      - loads r4-r11 with a pattern that changes every call (r4 starts
+        from 0x44444444, r5 from 0x55555555, ...),
+      - calls the function, reading the DWT cycle counter just before
+        and after the BLX,
+      - saves r4-r11 and SP as the function left them, restores SP, and
+        finds the lowest painted word that was overwritten.
+    aapcsCheckCase() compares the saved registers against the seeds, prints
+    a line for a case that broke the calling convention, and adds the case
+    to its group's totals; aapcsPrintSummary() prints those totals.
+    aapcsLastCycles() gives the cycles of the call alone: not the setjmp,
+    the sandbox set-up or the stack painting around it, and less the
+    wrapper's own instructions between the two readings.
+
+    Usage:
+        aapcsPrepare(RESULT_MULT, (aapcsFunc)asmMult, a, b, 0, 0);
+        AAPCS_GUARD_CALL(status, RESULT_MULT, testCase,
+                r0 = (int32_t)aapcsCall());
+        if (status == TEST_GUARD_OK)
+            aapcsCheckCase(RESULT_MULT, testCase, &txComplete);
+
+    The stack reading is the deepest word written below the caller's SP, so
+    a function that uses more than AAPCS_STACK_PAINT_BYTES is reported as
+    using at least that much. An interrupt taken during the call also
+    stacks there, and its handler's cycles would count as the call's.
+    AAPCS_GUARD_CALL() masks the DMAC interrupts for the call, so the print
+    queue's completions wait until it returns and output keeps going
+    between calls; a call during which the RTC ticked is left out of the
+    stack figures, and aapcsLastCycles() gives RESULT_STORE_UNTIMED for it.
+
+    When USING_HW is 0, aapcsCall() is C: it calls the function directly,
+    and reports the registers as preserved and no stack used; its cycles
+    come from resultStoreCycles().
+ */
+/* ************************************************************************** */
+
+#ifndef _AAPCS_CHECK_H    /* Guard against multiple inclusion */
+#define _AAPCS_CHECK_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "resultStore.h"  // resultTestId
+#include "testGuard.h"    // TEST_GUARD_CALL
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* r4-r11 */
+#define AAPCS_NUM_CONSERVED 8
+
+    /* SP, reported next to r4-r11 in the clobber masks */
+#define AAPCS_SP_BIT (1UL << AAPCS_NUM_CONSERVED)
+
+    /* stack painted below the wrapper before each call, and the room below
+     * that where the wrapper takes the SVC that leaves the sandbox; keep in
+     * step with aapcsCall.s, and within SANDBOX_STACK_BELOW (sandbox.h) */
+#define AAPCS_STACK_PAINT_BYTES 512
+#define AAPCS_STACK_PAINT_WORD  0xA5C3A5C3UL
+#define AAPCS_EXC_ROOM          128
+
+    /* TEST_GUARD_CALL() with the DMAC interrupts masked around it. The RTC
+     * stays enabled for the guard's timeout. */
+#define AAPCS_GUARD_CALL(status, group, testCase, call)     \
+    do                                                      \
+    {                                                       \
+        aapcsMaskDmac(true);                                \
+        TEST_GUARD_CALL(status, group, testCase, call);     \
+        aapcsMaskDmac(false);                               \
+    } while (0)
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* any of the asm functions; unused arguments are passed as 0 */
+typedef uint32_t (*aapcsFunc)(uint32_t, uint32_t, uint32_t, uint32_t);
+
+    /* shared with aapcsCall.s; the offsets are checked in aapcsCheck.c */
+typedef struct _aapcsFrame
+{
+    aapcsFunc fn;                           // 0
+    uint32_t args[4];                       // 4: r0-r3
+    uint32_t seed[AAPCS_NUM_CONSERVED];     // 20: r4-r11 before the call
+    uint32_t after[AAPCS_NUM_CONSERVED];    // 52: r4-r11 after the call
+    uint32_t result;                        // 84: r0 after the call
+    uint32_t spBefore;                      // 88
+    uint32_t spAfter;                       // 92
+    uint32_t stackUsed;                     // 96: bytes below spBefore
+    uint32_t cycles;                        // 100: DWT cycles across the
+                                            // call, wrapper included
+} aapcsFrame;
+
+typedef struct _aapcsStats
+{
+    uint32_t calls;         // calls checked
+    uint32_t badCalls;      // calls that did not preserve r4-r11 or SP
+    uint32_t clobbered;     // bit n: r(4+n) was ever changed; AAPCS_SP_BIT
+    uint32_t stackCalls;    // calls included in maxStack
+    uint32_t maxStack;      // deepest stack use in bytes
+} aapcsStats;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* clear the totals of every group and time the wrapper's own share of
+     * a call. Call after sandboxInit(), and again if it changes. */
+void aapcsCheckInit(void);
+
+    /* set up the next aapcsCall(). Call before TEST_GUARD_CALL(): it also
+     * has the sandbox leave the drop to unprivileged to the wrapper
+     * (sandboxDeferDrop()). */
+void aapcsPrepare(resultTestId group,
+        aapcsFunc fn,
+        uint32_t a0,
+        uint32_t a1,
+        uint32_t a2,
+        uint32_t a3);
+
+    /* disable (true) or re-enable (false) the DMAC interrupts in the NVIC;
+     * one that comes while masked is taken when they are re-enabled */
+void aapcsMaskDmac(bool mask);
+
+    /* call the prepared function; returns its r0 */
+uint32_t aapcsCall(void);
+
+    /* check the last aapcsCall(), which returned, and add it to the totals.
+     * Prints the registers it changed, if any, and returns 1 in that case,
+     * else 0. */
+uint32_t aapcsCheckCase(resultTestId group,
+        uint32_t testCase,
+        volatile bool *txComplete);
+
+    /* cycles the last aapcsCall() spent in the function, without the
+     * wrapper, or RESULT_STORE_UNTIMED if the RTC interrupt was taken
+     * during it; only valid if it returned */
+uint32_t aapcsLastCycles(void);
+
+    /* totals of a group */
+const aapcsStats *aapcsGetStats(resultTestId group);
+
+    /* print one line per group that was checked */
+void aapcsPrintSummary(volatile bool *txComplete);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _AAPCS_CHECK_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -43,6 +43,26 @@ extern "C" {
      * to a known value */
     void asmExternsInit(void);
 
+    // VB COMMENT:
+    // The ARM calling convention permits the use of up to 4 registers, r0-r3
+    // to pass data into a function. Only one value can be returned to the 
+    // C caller. The assembly language routine stores the return value
+    // in r0. The C compiler will automatically use it as the function's return
+    // value.
+    //
+    /* These functions will be implemented by students in asmMult.s */
+    /* asmUnpack: no return value */
+    extern void asmUnpack(uint32_t packedValue, int32_t* a, int32_t* b);
+    /* asmAbs: return abs value. Also store abs value at location absOut,
+     * and sign bit at location signBit. Must b 0 for +, 1 for negative */
+    extern int32_t asmAbs(int32_t input, int32_t *absOut, int32_t *signBit);
+    /* return product of two positive integers guaranteed to be <= 2^16 */
+    extern int32_t asmMult(int32_t a, int32_t b);
+    /* return corrected product based on signs of two original input values */
+    extern int32_t asmFixSign(int32_t initProduct, int32_t signBitA, int32_t signBitB);
+    /* Executes student's asmMain() function that ties together all of the above */
+    extern int32_t asmMain(uint32_t packedValue);
+
 
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
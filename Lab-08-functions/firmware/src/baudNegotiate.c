@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/** UART baud rate negotiation
+
+  @File Name
+    baudNegotiate.c
+
+  @Summary
+    The board's end of a handshake that steps the UART up from 115200 to
+    the fastest rate both ends and the cable carry cleanly.
+
+  @Description
+    See baudNegotiate.h. This file is also built into
+    host/baudNegotiate.cpp, so it must not include definitions.h or
+    anything else from the board.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "baudNegotiate.h"
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+const uint32_t baudNegotiateRates[] = {
+    BAUD_NEGOTIATE_START_RATE, 460800, 1000000, 2000000, 3000000
+};
+
+const uint32_t baudNegotiateNumRates =
+        sizeof(baudNegotiateRates) / sizeof(baudNegotiateRates[0]);
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* send "#<word> <rate>\r\n" */
+static void baudNegotiateReply(const baudNegotiateLink *link,
+        const char *word, uint32_t rate)
+{
+    char line[BAUD_NEGOTIATE_LINE_LEN];
+    int n = snprintf(line, sizeof(line), "#%s %lu\r\n", word,
+            (unsigned long)rate);
+    link->write(link->ctx, line, (uint32_t)n);
+}
+
+static bool baudNegotiateSupported(uint32_t rate)
+{
+    for (uint32_t i = 0; i < baudNegotiateNumRates; ++i)
+    {
+        if (baudNegotiateRates[i] == rate)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* the PING and GOOD of one step at rate; true if both came, intact */
+static bool baudNegotiateStep(const baudNegotiateLink *link, uint32_t rate)
+{
+    char line[BAUD_NEGOTIATE_LINE_LEN];
+
+    if (link->setRate(link->ctx, rate) == false)
+    {
+        return false;
+    }
+    // drop whatever the switch left in the receiver
+    while (link->read(link->ctx) >= 0)
+    {
+    }
+    (void)link->errorSeen(link->ctx);
+
+    if (baudNegotiateReadLine(link, line, BAUD_NEGOTIATE_STEP_MS) == false ||
+            link->errorSeen(link->ctx) == true ||
+            strcmp(line, "PING " BAUD_NEGOTIATE_PATTERN) != 0)
+    {
+        return false;
+    }
+    static const char pong[] = "#PONG " BAUD_NEGOTIATE_PATTERN "\r\n";
+    link->write(link->ctx, pong, sizeof(pong) - 1);
+
+    return baudNegotiateReadLine(link, line, BAUD_NEGOTIATE_STEP_MS) == true &&
+            link->errorSeen(link->ctx) == false &&
+            strcmp(line, "GOOD") == 0;
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+bool baudNegotiateReadLine(const baudNegotiateLink *link, char *line,
+        uint32_t timeoutMs)
+{
+    uint32_t start = link->millis(link->ctx);
+    uint32_t len = 0;
+
+    while (link->millis(link->ctx) - start < timeoutMs)
+    {
+        int32_t c = link->read(link->ctx);
+        if (c < 0 || c == '\r')
+        {
+            continue;
+        }
+        if (c == '\n')
+        {
+            if (len == 0)
+            {
+                continue;   // blank line
+            }
+            line[len] = '\0';
+            return true;
+        }
+        if (len < BAUD_NEGOTIATE_LINE_LEN - 1)
+        {
+            line[len++] = (char)c;
+        }
+    }
+    return false;
+}
+
+uint32_t baudNegotiateBoard(const baudNegotiateLink *link)
+{
+    char line[BAUD_NEGOTIATE_LINE_LEN];
+    uint32_t rate = BAUD_NEGOTIATE_START_RATE;
+
+    int n = snprintf(line, sizeof(line), "#BAUD %lu %lu\r\n",
+            (unsigned long)rate,
+            (unsigned long)baudNegotiateRates[baudNegotiateNumRates - 1]);
+    link->write(link->ctx, line, (uint32_t)n);
+
+    while (baudNegotiateReadLine(link, line, BAUD_NEGOTIATE_WINDOW_MS) == true)
+    {
+        if (link->errorSeen(link->ctx) == true)
+        {
+            continue;   // garbled at a rate that has been left
+        }
+        if (strcmp(line, "DONE") == 0)
+        {
+            baudNegotiateReply(link, "END", rate);
+            break;
+        }
+        if (strncmp(line, "TRY ", 4) != 0)
+        {
+            continue;
+        }
+
+        uint32_t next = (uint32_t)strtoul(line + 4, NULL, 10);
+        if (baudNegotiateSupported(next) == false)
+        {
+            baudNegotiateReply(link, "NO", next);
+            continue;
+        }
+        baudNegotiateReply(link, "OK", next);
+        if (baudNegotiateStep(link, next) == true)
+        {
+            rate = next;
+        }
+        else
+        {
+            // back to the last rate that passed, where the host will be too
+            (void)link->setRate(link->ctx, rate);
+            while (link->read(link->ctx) >= 0)
+            {
+            }
+            (void)link->errorSeen(link->ctx);
+        }
+    }
+    return rate;
+}
+
+/* *****************************************************************************
+ End of File
+ */
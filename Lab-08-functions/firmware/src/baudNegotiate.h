@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/** UART baud rate negotiation
+
+  @File Name
+    baudNegotiate.h
+
+  @Summary
+    The board's end of a handshake that steps the UART up from 115200 to
+    the fastest rate both ends and the cable carry cleanly.
+
+  @Description
+    At 115200 a whole test run spends most of its time waiting for the
+    UART. The board can go much faster: SERCOM5 runs from the 60 MHz
+    GCLK1, so 3 Mbaud still has 16x oversampling. Whether the USB bridge
+    and the host keep up is only known by trying, so the board offers and
+    the host (host/baudNegotiate.cpp) leads:
+
+        board                          host
+        #BAUD 115200 3000000     ->
+                                 <-    TRY 460800
+        #OK 460800               ->
+        (both switch to 460800)
+                                 <-    PING <BAUD_NEGOTIATE_PATTERN>
+        #PONG <pattern>          ->
+                                 <-    GOOD
+        (460800 is kept; the host tries the next rate)
+        ...
+                                 <-    DONE
+        #END 2000000             ->
+
+    Host lines end in '\n', board lines in "\r\n"; the board's start with
+    '#' so that they read as notes in a plain terminal.
+
+    A step fails when its PING or GOOD does not come within
+    BAUD_NEGOTIATE_STEP_MS, when it does not match, or when the link
+    reports a framing, parity or overrun error while it is read: then the
+    board goes back to the last rate that passed and waits for the next
+    line there. The host does the same when its PONG does not come; it
+    then stops stepping and sends DONE, and #END confirms the rate both
+    use. If no host answers #BAUD within the window the board stays at
+    115200, so a plain terminal sees one extra line and nothing else.
+
+    Nothing here touches the hardware: the board passes a
+    baudNegotiateLink for SERCOM5 (uartPort.c), and host/baudNegotiate.cpp
+    builds this file with a simulated serial pair to test both ends
+    together.
+ */
+/* ************************************************************************** */
+
+#ifndef _BAUD_NEGOTIATE_H    /* Guard against multiple inclusion */
+#define _BAUD_NEGOTIATE_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+#ifndef BAUD_NEGOTIATE_ENABLE
+#define BAUD_NEGOTIATE_ENABLE 1
+#endif
+
+    /* The rate after reset, and the one to fall back to */
+#define BAUD_NEGOTIATE_START_RATE 115200
+
+    /* How long the board waits for each of the host's lines between steps:
+     * the first, and the one after a failed step, which the host sends
+     * only once both ends must have fallen back (2 * BAUD_NEGOTIATE_STEP_MS
+     * after its PING) */
+#ifndef BAUD_NEGOTIATE_WINDOW_MS
+#define BAUD_NEGOTIATE_WINDOW_MS 300
+#endif
+
+    /* How long either end waits for each reply within a step */
+#ifndef BAUD_NEGOTIATE_STEP_MS
+#define BAUD_NEGOTIATE_STEP_MS 100
+#endif
+
+    /* Sent in PING and echoed in PONG: 'U' and '*' alternate bits, '~'
+     * and '!' are long runs of ones, '0' and 'O' of zeros */
+#define BAUD_NEGOTIATE_PATTERN "UUUU****~~~~!!!!0000OOOOzazaUUUU"
+
+    /* Longest line either end sends */
+#define BAUD_NEGOTIATE_LINE_LEN 64
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+typedef struct _baudNegotiateLink
+{
+    void *ctx;
+
+    /* send n bytes and return once the last has left the wire, so that
+     * the rate can be changed right after */
+    void (*write)(void *ctx, const char *bytes, uint32_t n);
+
+    /* the next received byte, or -1 if there is none yet */
+    int32_t (*read)(void *ctx);
+
+    /* true if a framing, parity or overrun error was seen since the last
+     * call; clears it */
+    bool (*errorSeen)(void *ctx);
+
+    /* switch to rate; false if the UART cannot make it */
+    bool (*setRate)(void *ctx, uint32_t rate);
+
+    /* a millisecond count; only differences are used */
+    uint32_t (*millis)(void *ctx);
+} baudNegotiateLink;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* The rates tried, in order; the first is BAUD_NEGOTIATE_START_RATE */
+extern const uint32_t baudNegotiateRates[];
+extern const uint32_t baudNegotiateNumRates;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* The board's end: offer, follow the host's steps, and return the rate
+     * the link is left at. The link must be at BAUD_NEGOTIATE_START_RATE
+     * and nothing else may be sending. */
+uint32_t baudNegotiateBoard(const baudNegotiateLink *link);
+
+    /* read one line into line, without its end; false if none came within
+     * timeoutMs. Also used by the host end. */
+bool baudNegotiateReadLine(const baudNegotiateLink *link, char *line,
+        uint32_t timeoutMs);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BAUD_NEGOTIATE_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,350 @@
+/* ************************************************************************** */
+/** Cycle-accurate benchmark of the asm functions
+
+  @File Name
+    benchFuncs.c
+
+  @Summary
+    Times every call of each asm function with the DWT cycle counter and
+    prints the min, median, p99 and max cycles per call.
+
+  @Description
+    See benchFuncs.h.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <string.h>
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "asmExterns.h"
+#include "printFuncs.h"  // lab print funcs
+#include "printQueue.h"
+#include "fmtFuncs.h"
+#include "benchFuncs.h"
+#include "benchStats.h"
+#include "resultStore.h"
+#include "aapcsCheck.h"
+#include "testVectors.h"
+
+#define MAX_PRINT_LEN 400
+
+/* room for the sample report formatted by both formatters */
+#define BENCH_REPORT_LEN 400
+
+#define USING_HW 1
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint8_t benchTxBuffer[MAX_PRINT_LEN] = {0};
+
+/* cycles of each timed call of the function being benchmarked */
+static uint32_t benchSamples[BENCH_MAX_SAMPLES];
+
+/* the sample report as snprintf and as fmtFuncs.c write it */
+static char benchReportSnprintf[BENCH_REPORT_LEN];
+static char benchReportFmt[BENCH_REPORT_LEN];
+
+/* out pointers for asmUnpack and asmAbs; the values are not checked */
+static int32_t benchOutA;
+static int32_t benchOutB;
+
+/* indexed by resultTestId */
+static const aapcsFunc benchFuncs[RESULT_NUM_TESTS] = {
+    (aapcsFunc)asmUnpack,
+    (aapcsFunc)asmAbs,
+    (aapcsFunc)asmMult,
+    (aapcsFunc)asmFixSign,
+    (aapcsFunc)asmMain
+};
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* the empty function timed for the call overhead: just the return */
+#if USING_HW
+static uint32_t __attribute__((naked, noinline)) benchNull(uint32_t a0,
+        uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    __asm volatile ("bx lr");
+}
+#else
+static uint32_t __attribute__((noinline)) benchNull(uint32_t a0,
+        uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    return a0;
+}
+#endif
+
+/* cycles one call of fn takes, including the call overhead. Interrupts are
+ * masked so that the RTC tick cannot land inside the timed call. */
+static uint32_t __attribute__((noinline)) benchTime(aapcsFunc fn,
+        uint32_t a0, uint32_t a1, uint32_t a2)
+{
+#if USING_HW
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t start = DWT->CYCCNT;
+    fn(a0, a1, a2, 0);
+    uint32_t cycles = DWT->CYCCNT - start;
+    __set_PRIMASK(primask);
+    return cycles;
+#else
+    uint32_t start = resultStoreSimCycles;
+    fn(a0, a1, a2, 0);
+    return resultStoreSimCycles - start;
+#endif
+}
+
+/* the value lines of a testAsmMain report for packed input p, formatted
+ * as testFuncs.c did before fmtFuncs.c */
+static uint32_t __attribute__((noinline)) benchFormatSnprintf(uint32_t p,
+        uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    int32_t a = TV_A(p);
+    int32_t b = TV_B(p);
+    int32_t product = a * b;
+    return (uint32_t)snprintf(benchReportSnprintf, BENCH_REPORT_LEN,
+            "test case INPUT: packed value:    0x%08lx\r\n"
+            "test case INPUT: multiplier (a):   %11ld; 0x%08lx\r\n"
+            "test case INPUT: multiplicand (b): %11ld; 0x%08lx\r\n"
+            "a_Abs:...........%11ld   %11ld\r\n"
+            "b_Abs:...........%11ld   %11ld\r\n"
+            "init_Product:....%11ld   %11ld\r\n"
+            "final_Product:...%11ld   %11ld\r\n",
+            p, a, a, b, b, TV_ABS(a), TV_ABS(a), TV_ABS(b), TV_ABS(b),
+            TV_ABS(product), TV_ABS(product), product, product);
+}
+
+/* the same lines as testFuncs.c now writes them */
+static uint32_t __attribute__((noinline)) benchFormatFast(uint32_t p,
+        uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    static const char * const labels[] = {
+        "a_Abs:...........",
+        "b_Abs:...........",
+        "init_Product:....",
+        "final_Product:..."
+    };
+    int32_t a = TV_A(p);
+    int32_t b = TV_B(p);
+    int32_t product = a * b;
+    const int32_t values[] = {
+        TV_ABS(a), TV_ABS(b), TV_ABS(product), product
+    };
+    fmtWriter w;
+
+    fmtBegin(&w, benchReportFmt, BENCH_REPORT_LEN);
+    fmtStr(&w, "test case INPUT: packed value:    0x");
+    fmtHex(&w, p, 8);
+    fmtStr(&w, "\r\ntest case INPUT: multiplier (a):   ");
+    fmtDecHex(&w, a);
+    fmtStr(&w, "\r\ntest case INPUT: multiplicand (b): ");
+    fmtDecHex(&w, b);
+    fmtStr(&w, "\r\n");
+    for (uint32_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+    {
+        fmtStr(&w, labels[i]);
+        fmtDec(&w, values[i], 11);
+        fmtStr(&w, "   ");
+        fmtDec(&w, values[i], 11);
+        fmtStr(&w, "\r\n");
+    }
+    return fmtEnd(&w);
+}
+
+/* time fn on every input of the set into s; returns false if the two
+ * formatters ever disagree */
+static bool benchFormatter(const benchConfig *c, const int32_t *tc,
+        uint32_t numInputs, uint32_t overhead, aapcsFunc fn, benchStats *s)
+{
+    uint32_t seen = 0;
+    bool same = true;
+
+    for (uint32_t i = 0; i < numInputs; ++i)
+    {
+        uint32_t p = benchInput(c, tc, i);
+        for (uint32_t w = 0; w < c->warmup; ++w)
+        {
+            benchTime(fn, p, 0, 0);
+        }
+        for (uint32_t n = 0; n < c->iterations; ++n)
+        {
+            uint32_t cycles = benchTime(fn, p, 0, 0);
+            uint32_t slot = benchSampleSlot(seen++);
+            if (slot < BENCH_MAX_SAMPLES)
+            {
+                benchSamples[slot] = cycles;
+            }
+        }
+        benchFormatSnprintf(p, 0, 0, 0);
+        benchFormatFast(p, 0, 0, 0);
+        if (strcmp(benchReportSnprintf, benchReportFmt) != 0)
+        {
+            same = false;
+        }
+    }
+    benchComputeStats(benchSamples,
+            seen < BENCH_MAX_SAMPLES ? seen : BENCH_MAX_SAMPLES, overhead, s);
+    return same;
+}
+
+/* arguments main.c would pass to function test for packed input p. lane
+ * picks multiplicand (0) or multiplier (1) for asmAbs. */
+static void benchArgs(resultTestId test, uint32_t p, uint32_t lane,
+        uint32_t args[3])
+{
+    int32_t a = TV_A(p);
+    int32_t b = TV_B(p);
+
+    args[0] = p;
+    args[1] = 0;
+    args[2] = 0;
+    switch (test)
+    {
+        case RESULT_UNPACK:
+            args[1] = (uint32_t)&benchOutA;
+            args[2] = (uint32_t)&benchOutB;
+            break;
+        case RESULT_ABS:
+            args[0] = (uint32_t)(lane == 0 ? a : b);
+            args[1] = (uint32_t)&benchOutA;
+            args[2] = (uint32_t)&benchOutB;
+            break;
+        case RESULT_MULT:
+            args[0] = (uint32_t)TV_ABS(a);
+            args[1] = (uint32_t)TV_ABS(b);
+            break;
+        case RESULT_FIXSIGN:
+            args[0] = (uint32_t)(TV_ABS(a) * TV_ABS(b));
+            args[1] = (uint32_t)TV_SIGN(a);
+            args[2] = (uint32_t)TV_SIGN(b);
+            break;
+        default:    // RESULT_MAIN
+            break;
+    }
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void runBenchmark(const benchConfig *c,
+        const int32_t *tc,
+        uint32_t numCases,
+        uint32_t skipMask,
+        volatile bool *txComplete)
+{
+    uint32_t numInputs = benchInputCount(c, numCases);
+    benchStats stats;
+
+#if USING_HW
+    // resultStoreInit() starts the counter; make sure of it anyway
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    // DMA traffic to the UART would steal bus cycles from the timed calls
+    printQueueFlush();
+
+    // call overhead: the fastest of several timed calls that only return
+    for (uint32_t i = 0; i < c->warmup + BENCH_OVERHEAD_CALLS; ++i)
+    {
+        uint32_t cycles = benchTime(benchNull, 0, 0, 0);
+        if (i >= c->warmup)
+        {
+            benchSamples[i - c->warmup] = cycles;
+        }
+    }
+    benchComputeStats(benchSamples, BENCH_OVERHEAD_CALLS, 0, &stats);
+    uint32_t overhead = stats.min;
+
+    benchFormatHeader((char*)benchTxBuffer, MAX_PRINT_LEN, c, numInputs,
+            overhead);
+    printAndWait((char*)benchTxBuffer, txComplete);
+
+    for (int test = 0; test < RESULT_NUM_TESTS; ++test)
+    {
+        uint32_t seen = 0;
+        uint32_t lanes = test == RESULT_ABS ? 2 : 1;
+
+        printQueueFlush();
+
+        for (uint32_t i = 0; i < numInputs && (skipMask & (1u << test)) == 0;
+                ++i)
+        {
+            uint32_t p = benchInput(c, tc, i);
+            for (uint32_t lane = 0; lane < lanes; ++lane)
+            {
+                uint32_t args[3];
+                benchArgs((resultTestId)test, p, lane, args);
+                for (uint32_t w = 0; w < c->warmup; ++w)
+                {
+                    benchTime(benchFuncs[test], args[0], args[1], args[2]);
+                }
+                for (uint32_t n = 0; n < c->iterations; ++n)
+                {
+                    uint32_t cycles = benchTime(benchFuncs[test],
+                            args[0], args[1], args[2]);
+                    uint32_t slot = benchSampleSlot(seen++);
+                    if (slot < BENCH_MAX_SAMPLES)
+                    {
+                        benchSamples[slot] = cycles;
+                    }
+                }
+            }
+        }
+
+        benchComputeStats(benchSamples,
+                seen < BENCH_MAX_SAMPLES ? seen : BENCH_MAX_SAMPLES,
+                overhead, &stats);
+        benchFormatRow((char*)benchTxBuffer, MAX_PRINT_LEN,
+                resultTestNames[test], &stats);
+        printAndWait((char*)benchTxBuffer, txComplete);
+    }
+
+    // what the reports cost to format, before and after fmtFuncs.c
+    benchStats fast;
+    printQueueFlush();
+    bool same = benchFormatter(c, tc, numInputs, overhead,
+            benchFormatSnprintf, &stats);
+    same = benchFormatter(c, tc, numInputs, overhead,
+            benchFormatFast, &fast) && same;
+    printAndWait("report lines, cycles per call:\r\n", txComplete);
+    benchFormatRow((char*)benchTxBuffer, MAX_PRINT_LEN, "snprintf", &stats);
+    printAndWait((char*)benchTxBuffer, txComplete);
+    benchFormatRow((char*)benchTxBuffer, MAX_PRINT_LEN, "fmtFuncs", &fast);
+    printAndWait((char*)benchTxBuffer, txComplete);
+    uint32_t tenths = fast.median != 0 ? stats.median * 10 / fast.median : 0;
+    snprintf((char*)benchTxBuffer, MAX_PRINT_LEN,
+            "fmtFuncs median %lu.%lu times faster; output %s\r\n",
+            tenths / 10, tenths % 10,
+            same == true ? "identical" : "DIFFERS");
+    printAndWait((char*)benchTxBuffer, txComplete);
+
+    printAndWait("\r\n", txComplete);
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/** Cycle-accurate benchmark of the asm functions
+
+  @File Name
+    benchFuncs.h
+
+  @Summary
+    Times every call of each asm function with the DWT cycle counter and
+    prints the min, median, p99 and max cycles per call.
+
+  @Description
+    The cycles main.c stores per test case (see resultStore.h) include the
+    sandbox, the AAPCS check and the timeout guard around each call. The
+    benchmark mode times the bare call instead: each function is called
+    directly, with interrupts masked, between two reads of DWT->CYCCNT.
+    For every input of the chosen set (see benchStats.h) a function is
+    called benchConfig.warmup times untimed, so the flash cache holds its
+    code, and then benchConfig.iterations times timed. The cycles of the
+    same timed call of a function that only returns are measured first and
+    subtracted from every sample, so a result is the cost of the function
+    itself.
+
+    The calls are not guarded: a function that faults or never returns
+    takes the board with it. runBenchmark() skips the functions whose tests
+    did not all pass, and main.c only runs it after the normal tests.
+    host/asmBench.cpp runs the same benchmark on thumbEmu's cycle estimate.
+
+    After the functions, the value lines of a testAsmMain report are
+    formatted for every input with snprintf and with fmtFuncs.c (see
+    fmtFuncs.h), timed the same way, and the two outputs compared.
+ */
+/* ************************************************************************** */
+
+#ifndef _BENCH_FUNCS_H    /* Guard against multiple inclusion */
+#define _BENCH_FUNCS_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "benchStats.h"
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* Timed calls of the empty function; the fastest is the call overhead */
+#define BENCH_OVERHEAD_CALLS 64
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /**
+      @Function
+        void runBenchmark(const benchConfig *c, const int32_t *tc,
+                          uint32_t numCases, uint32_t skipMask,
+                          volatile bool *txComplete)
+
+      @Summary
+        Times each asm function over c's input set and prints one table row
+        per function.
+
+      @Parameters
+        @param tc, numCases  the test corpus, used by BENCH_INPUTS_TEST_VECTORS
+        @param skipMask      bit n set (n a resultTestId) to skip that function
+
+      @Remarks
+        asmAbs is timed on both lanes of each input, so it has twice the
+        samples of the others. Past BENCH_MAX_SAMPLES timed calls of a
+        function, a random subset of them is kept (see benchSampleSlot()).
+     */
+void runBenchmark(const benchConfig *c,
+        const int32_t *tc,
+        uint32_t numCases,
+        uint32_t skipMask,
+        volatile bool *txComplete);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BENCH_FUNCS_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/** Cycle statistics for the benchmark mode
+
+  @File Name
+    benchStats.c
+
+  @Summary
+    Input sets, per-call cycle statistics and the table rows printed by the
+    benchmark mode.
+
+  @Description
+    See benchStats.h. This file is also built into host/asmBench.cpp, so it
+    must not include definitions.h or anything else from the board.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "benchStats.h"
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* random input number index: xorshift32 from a state spread out from the
+ * seed and index, so any input can be generated without the ones before it */
+static uint32_t benchRandomInput(uint32_t seed, uint32_t index)
+{
+    uint32_t x = seed ^ (index * 0x9E3779B9UL) ^ 0xA5A5A5A5UL;
+    if (x == 0)
+    {
+        x = 0x6D2B79F5UL;
+    }
+    for (int round = 0; round < 3; ++round)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+    }
+    return x;
+}
+
+/* a well mixed 32-bit hash (the murmur3 finalizer) */
+static uint32_t benchMix(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x85EBCA6BUL;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35UL;
+    x ^= x >> 16;
+    return x;
+}
+
+static int benchCompare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+uint32_t benchInputCount(const benchConfig *c, uint32_t numCases)
+{
+    return c->inputSet == BENCH_INPUTS_RANDOM ? c->randomCount : numCases;
+}
+
+uint32_t benchInput(const benchConfig *c, const int32_t *tc, uint32_t index)
+{
+    if (c->inputSet == BENCH_INPUTS_RANDOM)
+    {
+        return benchRandomInput(c->randomSeed, index);
+    }
+    return (uint32_t)tc[index];
+}
+
+uint32_t benchSampleSlot(uint32_t seen)
+{
+    if (seen < BENCH_MAX_SAMPLES)
+    {
+        return seen;
+    }
+    // algorithm R: keep call number seen with probability MAX / (seen + 1)
+    uint32_t slot = benchMix(seen) % (seen + 1);
+    return slot < BENCH_MAX_SAMPLES ? slot : BENCH_MAX_SAMPLES;
+}
+
+void benchComputeStats(uint32_t *samples,
+        uint32_t count,
+        uint32_t overhead,
+        benchStats *s)
+{
+    s->samples = count;
+    if (count == 0)
+    {
+        s->min = s->median = s->p99 = s->max = 0;
+        return;
+    }
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        samples[i] = samples[i] > overhead ? samples[i] - overhead : 0;
+    }
+    qsort(samples, count, sizeof(samples[0]), benchCompare);
+
+    // nearest rank: the smallest sample with at least p% of them at or below
+    s->min = samples[0];
+    s->median = samples[(count - 1) / 2];
+    s->p99 = samples[(99 * count + 99) / 100 - 1];
+    s->max = samples[count - 1];
+}
+
+int benchFormatHeader(char *buffer,
+        size_t length,
+        const benchConfig *c,
+        uint32_t numInputs,
+        uint32_t overhead)
+{
+    const char *setName = "test vectors";
+    char seedText[32] = "";
+    if (c->inputSet == BENCH_INPUTS_RANDOM)
+    {
+        setName = "random";
+        snprintf(seedText, sizeof(seedText), ", seed 0x%08" PRIx32,
+                c->randomSeed);
+    }
+    return snprintf(buffer, length,
+            "BENCHMARK: %" PRIu32 " %s inputs%s; %" PRIu32 " warm-up + %"
+            PRIu32 " timed calls each\r\n"
+            "cycles per call, %" PRIu32 " cycles of call overhead subtracted\r\n"
+            "function    samples     min  median     p99     max\r\n",
+            numInputs, setName, seedText, c->warmup, c->iterations, overhead);
+}
+
+int benchFormatRow(char *buffer,
+        size_t length,
+        const char *name,
+        const benchStats *s)
+{
+    if (s->samples == 0)
+    {
+        return snprintf(buffer, length, "%-10s  skipped: its tests did not "
+                "all pass\r\n", name);
+    }
+    return snprintf(buffer, length,
+            "%-10s  %7" PRIu32 " %7" PRIu32 " %7" PRIu32 " %7" PRIu32
+            " %7" PRIu32 "\r\n",
+            name, s->samples, s->min, s->median, s->p99, s->max);
+}
+
+
+/* *****************************************************************************
+ End of File
+ */
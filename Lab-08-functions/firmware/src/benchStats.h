@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/** Cycle statistics for the benchmark mode
+
+  @File Name
+    benchStats.h
+
+  @Summary
+    Input sets, per-call cycle statistics and the table rows printed by the
+    benchmark mode.
+
+  @Description
+    This is the part of the benchmark that does not touch the hardware, so
+    that benchFuncs.c on the board and host/asmBench.cpp on thumbEmu pick
+    the same inputs, reduce the samples the same way and print the same
+    table. Nothing here calls the asm functions or reads a cycle counter.
+
+    Each sample is the cycles one call took, minus the call overhead: the
+    cycles the same timed call of a function that only returns takes.
+    benchComputeStats() reports the minimum, median, 99th percentile and
+    maximum of a function's samples. The minimum is the cost of the code
+    itself; a median or p99 well above it points at data-dependent loops
+    (a shift-and-add asmMult, say), a max far above p99 at a stall or an
+    interrupt the timing did not keep out.
+ */
+/* ************************************************************************** */
+
+#ifndef _BENCH_STATS_H    /* Guard against multiple inclusion */
+#define _BENCH_STATS_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* Samples kept per function, 4 KB of RAM on the board. Past this many
+     * timed calls, benchSampleSlot() keeps a uniform random subset. */
+#define BENCH_MAX_SAMPLES 1024
+
+    /* Length of the buffer benchFormatHeader() and benchFormatRow() need */
+#define BENCH_LINE_LEN 200
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+typedef enum _benchInputSet
+{
+    BENCH_INPUTS_TEST_VECTORS = 0,  // the tc[] corpus, TEST_VECTORS_EXTRA included
+    BENCH_INPUTS_RANDOM             // randomCount packed values from randomSeed
+} benchInputSet;
+
+typedef struct _benchConfig
+{
+    benchInputSet inputSet;
+    uint32_t randomCount;       // inputs in BENCH_INPUTS_RANDOM
+    uint32_t randomSeed;        // the same seed gives the same inputs
+    uint32_t warmup;            // untimed calls per input before the timed ones
+    uint32_t iterations;        // timed calls per input
+} benchConfig;
+
+typedef struct _benchStats
+{
+    uint32_t samples;           // timed calls; 0 if the function was skipped
+    uint32_t min;               // cycles per call, overhead subtracted
+    uint32_t median;
+    uint32_t p99;
+    uint32_t max;
+} benchStats;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* number of packed inputs in c's input set; numCases is the length of
+     * tc[] */
+uint32_t benchInputCount(const benchConfig *c, uint32_t numCases);
+
+    /* packed input number index of c's input set */
+uint32_t benchInput(const benchConfig *c, const int32_t *tc, uint32_t index);
+
+    /* where to store the sample of timed call number seen (from 0) of a
+     * function: seen itself while there is room, then a reservoir-sampling
+     * slot, or BENCH_MAX_SAMPLES to drop it. Every call has the same chance
+     * of being kept, so a long input set is not cut short. */
+uint32_t benchSampleSlot(uint32_t seen);
+
+    /* sort samples[0 .. count - 1] in place, subtract overhead from each
+     * (stopping at 0) and fill s */
+void benchComputeStats(uint32_t *samples,
+        uint32_t count,
+        uint32_t overhead,
+        benchStats *s);
+
+    /* the lines above the table rows; returns the length, as snprintf */
+int benchFormatHeader(char *buffer,
+        size_t length,
+        const benchConfig *c,
+        uint32_t numInputs,
+        uint32_t overhead);
+
+    /* one table row; a function with s->samples == 0 is shown as skipped */
+int benchFormatRow(char *buffer,
+        size_t length,
+        const char *name,
+        const benchStats *s);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BENCH_STATS_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/** Binary log records
+
+  @File Name
+    binLog.c
+
+  @Summary
+    Sends a report as a record ID and its raw arguments instead of text;
+    host/logDecode.cpp prints the text.
+
+  @Description
+    See binLog.h.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stddef.h>                     // Defines NULL
+#include <string.h>
+#include "binLog.h"
+#include "printQueue.h"
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* append n bytes; a record that outgrows its buffer loses the rest, and
+ * the decoder shows it as truncated */
+static inline void binLogPut(binLogRecord *r, const uint8_t *bytes,
+        uint32_t n)
+{
+    if (n > r->cap - r->len)
+    {
+        n = r->cap - r->len;
+    }
+    memcpy(r->buf + r->len, bytes, n);
+    r->len += n;
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void binLogBegin(binLogRecord *r, binLogId id)
+{
+    r->buf = (uint8_t *)printQueueBufferGet();
+    r->cap = PRINT_QUEUE_TX_BUFFER_LEN;
+    r->buf[0] = BIN_LOG_SYNC;
+    r->buf[1] = (uint8_t)id;
+    r->len = BIN_LOG_HEADER_LEN;
+}
+
+void binLogUnsigned(binLogRecord *r, uint32_t v)
+{
+    uint8_t bytes[5];
+    uint32_t n = 0;
+    while (v >= 0x80)
+    {
+        bytes[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    bytes[n++] = (uint8_t)v;
+    binLogPut(r, bytes, n);
+}
+
+void binLogSigned(binLogRecord *r, int32_t v)
+{
+    // zigzag: the sign goes to bit 0
+    binLogUnsigned(r, ((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+}
+
+void binLogStr(binLogRecord *r, const char *s)
+{
+    uint32_t n = (uint32_t)strlen(s);
+    binLogUnsigned(r, n);
+    binLogPut(r, (const uint8_t *)s, n);
+}
+
+void binLogSend(binLogRecord *r, volatile bool *done)
+{
+    uint32_t payload = r->len - BIN_LOG_HEADER_LEN;
+    r->buf[2] = (uint8_t)payload;
+    r->buf[3] = (uint8_t)(payload >> 8);
+    printQueueBufferSend((char *)r->buf, r->len, done);
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/** Binary log records
+
+  @File Name
+    binLog.h
+
+  @Summary
+    Sends a report as a record ID and its raw arguments instead of text;
+    host/logDecode.cpp prints the text.
+
+  @Description
+    Built with -DBIN_LOG_ENABLE=1, the per-case reports of testFuncs.c are
+    not formatted on the board. Each is sent as one record:
+
+        0xA5  id  length (2 bytes, little-endian)  arguments
+
+    where id is the position of the report's format in binLogFormats.h and
+    the arguments are, in the order of the format's conversions:
+      - words as LEB128 varints, 7 bits per byte, low group first, the
+        top bit set on every byte but the last. Signed words are zigzag
+        coded first (0, -1, 1, -2 ... as 0, 1, 2, 3 ...), so that small
+        negative values stay short too.
+      - strings as a varint length and the bytes
+    A testAsmMain report shrinks from about 1000 characters to about 60
+    bytes, and the board spends no cycles on decimal conversion.
+
+    The summaries main.c prints stay text, so the stream mixes the two.
+    0xA5 is not ASCII, which is how logDecode.cpp tells a record from
+    text; everything else it passes through unchanged.
+
+    The default, 0, keeps the text reports, so a plain serial terminal
+    still shows them.
+ */
+/* ************************************************************************** */
+
+#ifndef _BIN_LOG_H    /* Guard against multiple inclusion */
+#define _BIN_LOG_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "binLogFormats.h"
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+#ifndef BIN_LOG_ENABLE
+#define BIN_LOG_ENABLE 0
+#endif
+
+    /* First byte of every record */
+#define BIN_LOG_SYNC 0xA5
+
+    /* Sync, ID and length */
+#define BIN_LOG_HEADER_LEN 4
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+#define BIN_LOG_ID_ENTRY(name, format) name,
+typedef enum
+{
+    BIN_LOG_FORMATS(BIN_LOG_ID_ENTRY)
+    BIN_LOG_NUM_FORMATS
+} binLogId;
+#undef BIN_LOG_ID_ENTRY
+
+typedef struct _binLogRecord
+{
+    uint8_t *buf;
+    uint32_t cap;
+    uint32_t len;              // bytes so far, header included
+} binLogRecord;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* start record id in a print queue buffer */
+void binLogBegin(binLogRecord *r, binLogId id);
+
+    /* %ld and %V arguments */
+void binLogSigned(binLogRecord *r, int32_t v);
+
+    /* %lu, %lx and %P arguments */
+void binLogUnsigned(binLogRecord *r, uint32_t v);
+
+    /* %s arguments */
+void binLogStr(binLogRecord *r, const char *s);
+
+    /* fill in the length and queue the record; done as for printAndWait */
+void binLogSend(binLogRecord *r, volatile bool *done);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BIN_LOG_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/** Format strings of the binary log records
+
+  @File Name
+    binLogFormats.h
+
+  @Summary
+    The one table of report formats, shared by the board, which sends only
+    a record ID and the arguments, and host/logDecode.cpp, which turns the
+    records back into the text.
+
+  @Description
+    Each X(name, format) entry gets the ID of its position: binLog.h makes
+    the enum from this list and logDecode.cpp the string table, so adding
+    an entry at the end keeps both in step. Never reorder or remove
+    entries a deployed board may still send.
+
+    The formats are printf formats with three additions, and the record
+    carries one argument per conversion, in order:
+      %ld %d     signed word
+      %lu %lx    unsigned word
+      %s         string
+      %V         one signed word printed as "%11ld; 0x%08lx", the value
+                 pair of the reports
+      %P         a pass flag: 1 prints PASS, 0 FAIL
+    Width and flags are allowed on the standard conversions.
+
+    The texts are those testFuncs.c writes in text mode; keep the two
+    alike when a report changes.
+ */
+/* ************************************************************************** */
+
+#ifndef _BIN_LOG_FORMATS_H    /* Guard against multiple inclusion */
+#define _BIN_LOG_FORMATS_H
+
+#define BIN_LOG_FORMATS(X) \
+    X(BIN_LOG_UNPACK, \
+            "========= testAsmUnpack %s test number: %ld\r\n" \
+            "packed (input) value:    0x%08lx\r\n" \
+            "unpacked A (multiplicand) value: %V\r\n" \
+            "expected A (multiplicand) value: %V\r\n" \
+            "unpacked B (multiplier) value:   %V\r\n" \
+            "expected B (multiplier) value:   %V\r\n" \
+            "unpacked A pass/fail:            %P\r\n" \
+            "unpacked B pass/fail:            %P\r\n" \
+            "========= END -- testAsmUnpack() debug output\r\n" \
+            "\r\n") \
+    X(BIN_LOG_ABS, \
+            "========= testAsmAbs %s test number: %ld\r\n" \
+            "signed input value:    0x%08lx\r\n" \
+            "abs value stored in mem:  %V; %P\r\n" \
+            "abs value returned in r0: %V; %P\r\n" \
+            "sign bit stored in mem:   %V; %P\r\n" \
+            "expected abs value:   %V\r\n" \
+            "expected sign bit:    %11ld\r\n" \
+            "========= END -- testAsmAbs() debug output\r\n" \
+            "\r\n") \
+    X(BIN_LOG_MULT, \
+            "========= testAsmMult %s test number: %ld\r\n" \
+            "Inputs:\r\n" \
+            "abs value A:             %V\r\n" \
+            "abs value B:             %V\r\n" \
+            "Output:\r\n" \
+            "product abs(A) * abs(B): %V; %P\r\n" \
+            "Expected product:        %V\r\n" \
+            "========= END -- testAsmMult() debug output\r\n" \
+            "\r\n") \
+    X(BIN_LOG_FIXSIGN, \
+            "========= testAsmFixSign %s test number: %ld\r\n" \
+            "Inputs:\r\n" \
+            "Initial (unsigned) product: %V\r\n" \
+            "sign bit A:                 %ld\r\n" \
+            "sign bit B:                 %ld\r\n" \
+            "Output:\r\n" \
+            "Final (signed) product:     %V; %P\r\n" \
+            "Expected product:           %V\r\n" \
+            "========= END -- testAsmFixSign() debug output\r\n" \
+            "\r\n") \
+    X(BIN_LOG_MAIN, \
+            "========= testAsmMain %s test number: %ld\r\n" \
+            "test case INPUT: packed value:    0x%08lx\r\n" \
+            "test case INPUT: multiplier (a):   %V\r\n" \
+            "test case INPUT: multiplicand (b): %V\r\n" \
+            "a check p/f:           %P\r\n" \
+            "b check p/f:           %P\r\n" \
+            "sign bit a check p/f:  %P\r\n" \
+            "sign bit b check p/f:  %P\r\n" \
+            "abs a check p/f:       %P\r\n" \
+            "abs b check p/f:       %P\r\n" \
+            "initial product p/f:   %P\r\n" \
+            "final product p/f:     %P\r\n" \
+            "returned result p/f:   %P\r\n" \
+            "debug values        expected        actual\r\n" \
+            "a_Multiplicand:..%11ld   %11ld\r\n" \
+            "b_Multiplier:....%11ld   %11ld\r\n" \
+            "a_Sign:..........%11ld   %11ld\r\n" \
+            "b_Sign:..........%11ld   %11ld\r\n" \
+            "a_Abs:...........%11ld   %11ld\r\n" \
+            "b_Abs:...........%11ld   %11ld\r\n" \
+            "init_Product:....%11ld   %11ld\r\n" \
+            "final_Product:...%11ld   %11ld\r\n" \
+            "returned value:..%11ld   %11ld\r\n")
+
+#endif /* _BIN_LOG_FORMATS_H */
+
+/* *****************************************************************************
+ End of File
+ */
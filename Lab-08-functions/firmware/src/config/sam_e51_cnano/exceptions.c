@@ -46,6 +46,8 @@
 // *****************************************************************************
 #include "interrupts.h"
 #include "definitions.h"
+#include "faultCapture.h"
+#include "excEntry.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -53,6 +55,14 @@
 // *****************************************************************************
 // *****************************************************************************
 
+/* Pass the stacked exception frame (on MSP or PSP, per EXC_RETURN bit 2)
+ * and the fault type to faultCaptureHandler(), which records the fault
+ * against the running test case and resets. A MemManage fault raised by
+ * the test sandbox returns to a trampoline instead. */
+#define FAULT_HANDLER_ENTRY(type)                   \
+    EXC_ENTRY(faultCaptureHandler,                  \
+            "    movs   r1, #" EXC_XSTR(type) "\n")
+
 /* Brief default interrupt handlers for core IRQs.*/
 
 void __attribute__((noreturn)) NonMaskableInt_Handler(void)
@@ -65,14 +75,9 @@ void __attribute__((noreturn)) NonMaskableInt_Handler(void)
     }
 }
 
-void __attribute__((noreturn)) HardFault_Handler(void)
+void __attribute__((naked, noreturn)) HardFault_Handler(void)
 {
-#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
-   __builtin_software_breakpoint();
-#endif
-   while (true)
-   {
-   }
+   FAULT_HANDLER_ENTRY(FAULT_TYPE_HARD);
 }
 
 void __attribute__((noreturn)) DebugMonitor_Handler(void)
@@ -85,34 +90,19 @@ void __attribute__((noreturn)) DebugMonitor_Handler(void)
    }
 }
 
-void __attribute__((noreturn)) MemoryManagement_Handler(void)
+void __attribute__((naked)) MemoryManagement_Handler(void)
 {
-#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
-   __builtin_software_breakpoint();
-#endif
-   while (true)
-   {
-   }
+   FAULT_HANDLER_ENTRY(FAULT_TYPE_MEMMANAGE);
 }
 
-void __attribute__((noreturn)) BusFault_Handler(void)
+void __attribute__((naked, noreturn)) BusFault_Handler(void)
 {
-#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
-   __builtin_software_breakpoint();
-#endif
-   while (true)
-   {
-   }
+   FAULT_HANDLER_ENTRY(FAULT_TYPE_BUS);
 }
 
-void __attribute__((noreturn)) UsageFault_Handler(void)
+void __attribute__((naked, noreturn)) UsageFault_Handler(void)
 {
-#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
-   __builtin_software_breakpoint();
-#endif
-   while (true)
-   {
-   }
+   FAULT_HANDLER_ENTRY(FAULT_TYPE_USAGE);
 }
 /*******************************************************************************
  End of File
@@ -112,10 +112,6 @@ extern void EIC_EXTINT_14_Handler      ( void ) __attribute__((weak, alias("Dumm
 extern void FREQM_Handler              ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void NVMCTRL_0_Handler          ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void NVMCTRL_1_Handler          ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void DMAC_1_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void DMAC_2_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void DMAC_3_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void DMAC_OTHER_Handler         ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EVSYS_0_Handler            ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EVSYS_1_Handler            ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EVSYS_2_Handler            ( void ) __attribute__((weak, alias("Dummy_Handler")));
@@ -257,10 +253,10 @@ const H3DeviceVectors exception_table=
     .pfnNVMCTRL_0_Handler          = NVMCTRL_0_Handler,
     .pfnNVMCTRL_1_Handler          = NVMCTRL_1_Handler,
     .pfnDMAC_0_Handler             = DMAC_0_InterruptHandler,
-    .pfnDMAC_1_Handler             = DMAC_1_Handler,
-    .pfnDMAC_2_Handler             = DMAC_2_Handler,
-    .pfnDMAC_3_Handler             = DMAC_3_Handler,
-    .pfnDMAC_OTHER_Handler         = DMAC_OTHER_Handler,
+    .pfnDMAC_1_Handler             = DMAC_1_InterruptHandler,
+    .pfnDMAC_2_Handler             = DMAC_2_InterruptHandler,
+    .pfnDMAC_3_Handler             = DMAC_3_InterruptHandler,
+    .pfnDMAC_OTHER_Handler         = DMAC_OTHER_InterruptHandler,
     .pfnEVSYS_0_Handler            = EVSYS_0_Handler,
     .pfnEVSYS_1_Handler            = EVSYS_1_Handler,
     .pfnEVSYS_2_Handler            = EVSYS_2_Handler,
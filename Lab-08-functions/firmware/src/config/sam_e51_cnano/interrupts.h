@@ -63,6 +63,10 @@ void HardFault_Handler (void);
 void RTC_InterruptHandler (void);
 void EIC_EXTINT_15_InterruptHandler (void);
 void DMAC_0_InterruptHandler (void);
+void DMAC_1_InterruptHandler (void);
+void DMAC_2_InterruptHandler (void);
+void DMAC_3_InterruptHandler (void);
+void DMAC_OTHER_InterruptHandler (void);
 
 
 
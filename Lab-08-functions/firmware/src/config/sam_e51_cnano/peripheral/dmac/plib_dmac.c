@@ -54,7 +54,7 @@
 // *****************************************************************************
 // *****************************************************************************
 
-#define DMAC_CHANNELS_NUMBER        1
+#define DMAC_CHANNELS_NUMBER        8
 
 #define DMAC_CRC_CHANNEL_OFFSET     0x20U
 
@@ -125,6 +125,80 @@ void DMAC_Initialize( void )
     DMAC_REGS->DMAC_CTRL = DMAC_CTRL_DMAENABLE_Msk | DMAC_CTRL_LVLEN0_Msk | DMAC_CTRL_LVLEN1_Msk | DMAC_CTRL_LVLEN2_Msk | DMAC_CTRL_LVLEN3_Msk;
 }
 
+/*******************************************************************************
+    This function claims the first free DMAC channel and configures it as
+    described by setup. Channel 0 is configured statically for SERCOM5 TX in
+    DMAC_Initialize and is never returned. Returns DMAC_CHANNEL_NONE if all
+    channels are in use.
+********************************************************************************/
+
+DMAC_CHANNEL DMAC_ChannelAllocate( const DMAC_CHANNEL_SETUP *setup )
+{
+    DMAC_CHANNEL allocated = DMAC_CHANNEL_NONE;
+    uint32_t channel = 0;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    for(channel = 1; channel < DMAC_CHANNELS_NUMBER; channel++)
+    {
+        if (dmacChannelObj[channel].inUse == 0)
+        {
+            dmacChannelObj[channel].inUse = 1;
+            allocated = (DMAC_CHANNEL)channel;
+            break;
+        }
+    }
+    __set_PRIMASK(primask);
+
+    if (allocated == DMAC_CHANNEL_NONE)
+    {
+        return allocated;
+    }
+
+    dmacChannelObj[channel].callback = NULL;
+    dmacChannelObj[channel].context = 0;
+    dmacChannelObj[channel].busyStatus = false;
+
+    /* Make sure the channel is idle before it is reconfigured */
+    DMAC_REGS->CHANNEL[channel].DMAC_CHCTRLA &= (~DMAC_CHCTRLA_ENABLE_Msk);
+    while((DMAC_REGS->CHANNEL[channel].DMAC_CHCTRLA & DMAC_CHCTRLA_ENABLE_Msk) != 0);
+
+    DMAC_REGS->CHANNEL[channel].DMAC_CHCTRLA = DMAC_CHCTRLA_TRIGACT(setup->trigger_action) | DMAC_CHCTRLA_TRIGSRC(setup->trigger_source) | DMAC_CHCTRLA_THRESHOLD(0) | DMAC_CHCTRLA_BURSTLEN(0) ;
+
+    descriptor_section[channel].DMAC_BTCTRL = DMAC_BTCTRL_BLOCKACT_INT | DMAC_BTCTRL_BEATSIZE(setup->beat_size) | DMAC_BTCTRL_VALID_Msk |
+            (setup->source_increment ? DMAC_BTCTRL_SRCINC_Msk : 0U) | (setup->destination_increment ? DMAC_BTCTRL_DSTINC_Msk : 0U);
+    descriptor_section[channel].DMAC_DESCADDR = 0;
+
+    DMAC_REGS->CHANNEL[channel].DMAC_CHPRILVL = DMAC_CHPRILVL_PRILVL(setup->priority_level);
+
+    DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG = DMAC_CHINTENCLR_TCMPL_Msk | DMAC_CHINTENCLR_TERR_Msk;
+    DMAC_REGS->CHANNEL[channel].DMAC_CHINTENSET = (DMAC_CHINTENSET_TERR_Msk | DMAC_CHINTENSET_TCMPL_Msk);
+
+    return allocated;
+}
+
+/*******************************************************************************
+    This function stops a channel from DMAC_ChannelAllocate and returns it to
+    the free pool.
+********************************************************************************/
+
+void DMAC_ChannelFree( DMAC_CHANNEL channel )
+{
+    if ((channel <= DMAC_CHANNEL_0) || (channel >= DMAC_CHANNELS_NUMBER))
+    {
+        return;
+    }
+
+    DMAC_ChannelDisable(channel);
+
+    DMAC_REGS->CHANNEL[channel].DMAC_CHINTENCLR = (DMAC_CHINTENCLR_TERR_Msk | DMAC_CHINTENCLR_TCMPL_Msk);
+    DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG = DMAC_CHINTENCLR_TCMPL_Msk | DMAC_CHINTENCLR_TERR_Msk;
+
+    dmacChannelObj[channel].callback = NULL;
+    dmacChannelObj[channel].context = 0;
+    dmacChannelObj[channel].inUse = 0;
+}
+
 /*******************************************************************************
     This function schedules a DMA transfer on the specified DMA channel.
 ********************************************************************************/
@@ -194,6 +268,42 @@ bool DMAC_ChannelTransfer( DMAC_CHANNEL channel, const void *srcAddr, const void
     return returnStatus;
 }
 
+/*******************************************************************************
+    This function submits a list of DMAC transfers linked through their
+    descriptors' DESCADDR fields to the specified DMA channel.
+********************************************************************************/
+
+bool DMAC_ChannelLinkedListTransfer( DMAC_CHANNEL channel, dmac_descriptor_registers_t *channelDesc )
+{
+    bool returnStatus = false;
+
+    if ((dmacChannelObj[channel].busyStatus == false) || (DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG & (DMAC_CHINTENCLR_TCMPL_Msk | DMAC_CHINTENCLR_TERR_Msk)))
+    {
+        /* Clear the transfer complete flag */
+        DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG = DMAC_CHINTENCLR_TCMPL_Msk | DMAC_CHINTENCLR_TERR_Msk;
+
+        dmacChannelObj[channel].busyStatus = true;
+
+        /* The first descriptor is copied to the descriptor section; the rest
+         * are fetched by the DMAC from wherever they are linked */
+        (void) memcpy(&descriptor_section[channel], channelDesc, sizeof(dmac_descriptor_registers_t));
+
+        /* Enable the channel */
+        DMAC_REGS->CHANNEL[channel].DMAC_CHCTRLA |= DMAC_CHCTRLA_ENABLE_Msk;
+
+        /* Verify if Trigger source is Software Trigger */
+        if ((((DMAC_REGS->CHANNEL[channel].DMAC_CHCTRLA & DMAC_CHCTRLA_TRIGSRC_Msk) >> DMAC_CHCTRLA_TRIGSRC_Pos) == 0x00)
+                                                && (((DMAC_REGS->CHANNEL[channel].DMAC_CHEVCTRL & DMAC_CHEVCTRL_EVIE_Msk)) != DMAC_CHEVCTRL_EVIE_Msk))
+        {
+            /* Trigger the DMA transfer */
+            DMAC_REGS->DMAC_SWTRIGCTRL |= (1 << channel);
+        }
+        returnStatus = true;
+    }
+
+    return returnStatus;
+}
+
 /*******************************************************************************
     This function returns the status of the channel.
 ********************************************************************************/
@@ -463,3 +573,33 @@ void DMAC_0_InterruptHandler( void )
    _DMAC_interruptHandler(0);
 }
 
+void DMAC_1_InterruptHandler( void )
+{
+   _DMAC_interruptHandler(1);
+}
+
+void DMAC_2_InterruptHandler( void )
+{
+   _DMAC_interruptHandler(2);
+}
+
+void DMAC_3_InterruptHandler( void )
+{
+   _DMAC_interruptHandler(3);
+}
+
+/* Channels 4 and up share one interrupt line */
+void DMAC_OTHER_InterruptHandler( void )
+{
+    uint32_t channel = 0;
+    uint32_t intStatus = DMAC_REGS->DMAC_INTSTATUS;
+
+    for(channel = 4; channel < DMAC_CHANNELS_NUMBER; channel++)
+    {
+        if ((intStatus & (1UL << channel)) != 0U)
+        {
+            _DMAC_interruptHandler((uint8_t)channel);
+        }
+    }
+}
+
@@ -76,8 +76,32 @@
 
 typedef enum
 {
+    /* No channel; returned when none is free */
+    DMAC_CHANNEL_NONE = -1,
+
     /* DMAC Channel 0 */
     DMAC_CHANNEL_0 = 0,
+
+    /* DMAC Channel 1 */
+    DMAC_CHANNEL_1 = 1,
+
+    /* DMAC Channel 2 */
+    DMAC_CHANNEL_2 = 2,
+
+    /* DMAC Channel 3 */
+    DMAC_CHANNEL_3 = 3,
+
+    /* DMAC Channel 4 */
+    DMAC_CHANNEL_4 = 4,
+
+    /* DMAC Channel 5 */
+    DMAC_CHANNEL_5 = 5,
+
+    /* DMAC Channel 6 */
+    DMAC_CHANNEL_6 = 6,
+
+    /* DMAC Channel 7 */
+    DMAC_CHANNEL_7 = 7,
 } DMAC_CHANNEL;
 
 typedef enum
@@ -144,13 +168,50 @@ typedef struct
     uint32_t seed;
 } DMAC_CRC_SETUP;
 
+typedef enum
+{
+    /* 8-bit bus access */
+    DMAC_BEAT_SIZE_BYTE     = 0x0,
+
+    /* 16-bit bus access */
+    DMAC_BEAT_SIZE_HWORD    = 0x1,
+
+    /* 32-bit bus access */
+    DMAC_BEAT_SIZE_WORD     = 0x2
+
+} DMAC_BEAT_SIZE;
+
+typedef struct
+{
+    /* CHCTRLA[TRIGSRC]: peripheral trigger; 0 for software trigger
+     * (memory-to-memory) */
+    uint8_t trigger_source;
+
+    /* CHCTRLA[TRIGACT]: DMAC_CHCTRLA_TRIGACT_BLOCK_Val, _BURST_Val or
+     * _TRANSACTION_Val */
+    uint8_t trigger_action;
+
+    /* BTCTRL[BEATSIZE] */
+    DMAC_BEAT_SIZE beat_size;
+
+    /* BTCTRL[SRCINC] and BTCTRL[DSTINC] */
+    bool source_increment;
+    bool destination_increment;
+
+    /* CHPRILVL[PRILVL]: 0 (lowest) to 3 */
+    uint8_t priority_level;
+} DMAC_CHANNEL_SETUP;
+
 typedef uint32_t DMAC_CHANNEL_CONFIG;
 
 typedef void (*DMAC_CHANNEL_CALLBACK) (DMAC_TRANSFER_EVENT event, uintptr_t contextHandle);
 void DMAC_ChannelCallbackRegister (DMAC_CHANNEL channel, const DMAC_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle);
 
 void DMAC_Initialize( void );
+DMAC_CHANNEL DMAC_ChannelAllocate (const DMAC_CHANNEL_SETUP *setup);
+void DMAC_ChannelFree (DMAC_CHANNEL channel);
 bool DMAC_ChannelTransfer (DMAC_CHANNEL channel, const void *srcAddr, const void *destAddr, size_t blockSize);
+bool DMAC_ChannelLinkedListTransfer (DMAC_CHANNEL channel, dmac_descriptor_registers_t *channelDesc);
 bool DMAC_ChannelIsBusy ( DMAC_CHANNEL channel );
 void DMAC_ChannelDisable ( DMAC_CHANNEL channel );
 DMAC_CHANNEL_CONFIG  DMAC_ChannelSettingsGet ( DMAC_CHANNEL channel );
@@ -65,6 +65,14 @@ void NVIC_Initialize( void )
     NVIC_EnableIRQ(EIC_EXTINT_15_IRQn);
     NVIC_SetPriority(DMAC_0_IRQn, 7);
     NVIC_EnableIRQ(DMAC_0_IRQn);
+    NVIC_SetPriority(DMAC_1_IRQn, 7);
+    NVIC_EnableIRQ(DMAC_1_IRQn);
+    NVIC_SetPriority(DMAC_2_IRQn, 7);
+    NVIC_EnableIRQ(DMAC_2_IRQn);
+    NVIC_SetPriority(DMAC_3_IRQn, 7);
+    NVIC_EnableIRQ(DMAC_3_IRQn);
+    NVIC_SetPriority(DMAC_OTHER_IRQn, 7);
+    NVIC_EnableIRQ(DMAC_OTHER_IRQn);
 
 
 
@@ -80,8 +80,9 @@ void PORT_Initialize(void)
 
    /************************** GROUP 1 Initialization *************************/
    PORT_REGS->GROUP[1].PORT_PINCFG[16] = 0x1;
+   PORT_REGS->GROUP[1].PORT_PINCFG[17] = 0x1;
 
-   PORT_REGS->GROUP[1].PORT_PMUX[8] = 0x2;
+   PORT_REGS->GROUP[1].PORT_PMUX[8] = 0x22;
 
 }
 
@@ -253,6 +253,28 @@ void SERCOM5_USART_TransmitterDisable( void )
     }
 }
 
+void SERCOM5_USART_ReceiverEnable( void )
+{
+    SERCOM5_REGS->USART_INT.SERCOM_CTRLB |= SERCOM_USART_INT_CTRLB_RXEN_Msk;
+
+    /* Wait for sync */
+    while((SERCOM5_REGS->USART_INT.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+}
+
+void SERCOM5_USART_ReceiverDisable( void )
+{
+    SERCOM5_REGS->USART_INT.SERCOM_CTRLB &= ~SERCOM_USART_INT_CTRLB_RXEN_Msk;
+
+    /* Wait for sync */
+    while((SERCOM5_REGS->USART_INT.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+}
+
 bool SERCOM5_USART_Write( void *buffer, const size_t size )
 {
     bool writeStatus      = false;
@@ -294,6 +316,23 @@ bool SERCOM5_USART_Write( void *buffer, const size_t size )
 }
 
 
+bool SERCOM5_USART_ReceiverIsReady( void )
+{
+    bool receiverStatus = false;
+
+    if ((SERCOM5_REGS->USART_INT.SERCOM_INTFLAG & SERCOM_USART_INT_INTFLAG_RXC_Msk) == SERCOM_USART_INT_INTFLAG_RXC_Msk)
+    {
+        receiverStatus = true;
+    }
+
+    return receiverStatus;
+}
+
+int SERCOM5_USART_ReadByte( void )
+{
+    return (int)SERCOM5_REGS->USART_INT.SERCOM_DATA;
+}
+
 bool SERCOM5_USART_TransmitterIsReady( void )
 {
     bool transmitterStatus = false;
@@ -75,6 +75,10 @@ void SERCOM5_USART_TransmitterEnable( void );
 
 void SERCOM5_USART_TransmitterDisable( void );
 
+void SERCOM5_USART_ReceiverEnable( void );
+
+void SERCOM5_USART_ReceiverDisable( void );
+
 bool SERCOM5_USART_Write( void *buffer, const size_t size );
 
 
@@ -84,6 +88,10 @@ bool SERCOM5_USART_TransmitComplete( void );
 
 void SERCOM5_USART_WriteByte( int data );
 
+bool SERCOM5_USART_ReceiverIsReady( void );
+
+int SERCOM5_USART_ReadByte( void );
+
 
 USART_ERROR SERCOM5_USART_ErrorGet( void );
 
@@ -0,0 +1,436 @@
+/* ************************************************************************** */
+/** Serial command console
+
+  @File Name
+    console.c
+
+  @Summary
+    Reads commands from the UART into a circular DMA buffer and applies
+    them to main.c's test settings, so that a change needs no rebuild.
+
+  @Description
+    See console.h.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>
+#include <string.h>
+#include "definitions.h"                // SYS function prototypes
+#include "console.h"
+#include "printFuncs.h"  // lab print funcs
+#include "fmtFuncs.h"
+#include "diffFuncs.h"
+
+#define MAX_PRINT_LEN 1000
+
+#ifndef USING_HW
+#define USING_HW 1
+#endif
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* written by the DMAC, read by consolePoll() */
+static volatile uint8_t consoleRxRing[CONSOLE_RX_RING_LEN] __attribute__((aligned(4)));
+
+/* next ring byte to read */
+static uint32_t consoleRxRead = 0;
+
+#if USING_HW
+static DMAC_CHANNEL consoleRxChannel = DMAC_CHANNEL_NONE;
+
+/* the channel's only descriptor, linked to itself */
+static dmac_descriptor_registers_t consoleRxDescriptor __attribute__((aligned(16)));
+#else
+/* next ring byte consoleSimInput() writes */
+static uint32_t consoleSimWrite = 0;
+#endif
+
+static const consoleConfig *consoleCfg = NULL;
+
+static char consoleLine[CONSOLE_LINE_LEN];
+static uint32_t consoleLineLen = 0;
+
+static bool consoleRunRequested = false;
+
+static char consoleTxBuffer[MAX_PRINT_LEN];
+static volatile bool consoleTxDone = true;
+
+static const char consoleHelp[] =
+        "commands:\r\n"
+        "  help | show | run\r\n"
+        "  set NAME on|off     (unpack abs mult fixsign main fails turbo\r\n"
+        "                       failfast sandbox sweep fuzz bench diff)\r\n"
+        "  set NAME VALUE      (fuzzseed fuzzcount diffseed diffcount\r\n"
+        "                       sweepfirst sweeplast benchcount benchseed\r\n"
+        "                       benchwarmup benchiterations)\r\n"
+        "  inputs vectors|random\r\n"
+        "  engine NAME|all on|off\r\n";
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* ring index the DMAC writes next */
+static uint32_t consoleRxWritePosition(void)
+{
+#if USING_HW
+    // BTCNT counts down from the block length and reloads at the wrap
+    return DMAC_ChannelGetTransferredCount(consoleRxChannel) &
+            (CONSOLE_RX_RING_LEN - 1);
+#else
+    return consoleSimWrite;
+#endif
+}
+
+#if USING_HW
+/* clear the receiver's error flags so that reception goes on. Unlike
+ * SERCOM5_USART_ErrorGet(), which empties the receiver through DATA when
+ * it clears them, this leaves DATA alone: every byte is the DMAC's. */
+static void consoleRxErrorClear(void)
+{
+    const uint16_t errors = SERCOM_USART_INT_STATUS_PERR_Msk |
+            SERCOM_USART_INT_STATUS_FERR_Msk |
+            SERCOM_USART_INT_STATUS_BUFOVF_Msk;
+    uint16_t status = SERCOM5_REGS->USART_INT.SERCOM_STATUS & errors;
+
+    if (status != 0)
+    {
+        // write-one-to-clear; only the bits that are set
+        SERCOM5_REGS->USART_INT.SERCOM_STATUS = status;
+        SERCOM5_REGS->USART_INT.SERCOM_INTFLAG =
+                (uint8_t)SERCOM_USART_INT_INTFLAG_ERROR_Msk;
+    }
+}
+#endif
+
+static void consoleReply(fmtWriter *w)
+{
+    fmtEnd(w);
+    printAndWait(consoleTxBuffer, &consoleTxDone);
+}
+
+static void consoleError(const char *what, const char *word)
+{
+    fmtWriter w;
+    fmtBegin(&w, consoleTxBuffer, MAX_PRINT_LEN);
+    fmtStr(&w, "console: ");
+    fmtStr(&w, what);
+    if (word != NULL)
+    {
+        fmtStr(&w, " '");
+        fmtStr(&w, word);
+        fmtStr(&w, "'");
+    }
+    fmtStr(&w, "; try help\r\n");
+    consoleReply(&w);
+}
+
+/* "on" or "off" into *value; false if it is neither */
+static bool consoleOnOff(const char *word, bool *value)
+{
+    if (word != NULL && strcmp(word, "on") == 0)
+    {
+        *value = true;
+        return true;
+    }
+    if (word != NULL && strcmp(word, "off") == 0)
+    {
+        *value = false;
+        return true;
+    }
+    return false;
+}
+
+static void consoleShow(void)
+{
+    fmtWriter w;
+    fmtBegin(&w, consoleTxBuffer, MAX_PRINT_LEN);
+    fmtStr(&w, "========= console settings\r\n");
+    for (uint32_t i = 0; i < consoleCfg->numFlags; ++i)
+    {
+        fmtStr(&w, consoleCfg->flags[i].name);
+        fmtStr(&w, *consoleCfg->flags[i].flag ? " on\r\n" : " off\r\n");
+    }
+    for (uint32_t i = 0; i < consoleCfg->numNumbers; ++i)
+    {
+        fmtStr(&w, consoleCfg->numbers[i].name);
+        fmtStr(&w, " ");
+        fmtUDec(&w, *consoleCfg->numbers[i].value, 0);
+        fmtStr(&w, " (0x");
+        fmtHex(&w, *consoleCfg->numbers[i].value, 8);
+        fmtStr(&w, ")\r\n");
+    }
+    fmtStr(&w, "inputs ");
+    fmtStr(&w, *consoleCfg->benchInputs == BENCH_INPUTS_RANDOM ?
+            "random\r\n" : "vectors\r\n");
+    fmtStr(&w, "engines");
+    for (uint32_t e = 0; e < diffNumEngines; ++e)
+    {
+        fmtStr(&w, " ");
+        fmtStr(&w, diffEngines[e].name);
+        fmtStr(&w, e == 0 ? "(reference)" :
+                (*consoleCfg->diffEngineMask & (1u << e)) != 0 ? "" : "(off)");
+    }
+    fmtStr(&w, "\r\n\r\n");
+    consoleReply(&w);
+}
+
+static void consoleSet(const char *name, const char *value)
+{
+    if (name == NULL || value == NULL)
+    {
+        consoleError("set needs a name and a value", NULL);
+        return;
+    }
+    for (uint32_t i = 0; i < consoleCfg->numFlags; ++i)
+    {
+        if (strcmp(name, consoleCfg->flags[i].name) == 0)
+        {
+            if (consoleOnOff(value, consoleCfg->flags[i].flag) == false)
+            {
+                consoleError("expected on or off, not", value);
+            }
+            return;
+        }
+    }
+    for (uint32_t i = 0; i < consoleCfg->numNumbers; ++i)
+    {
+        if (strcmp(name, consoleCfg->numbers[i].name) == 0)
+        {
+            char *end;
+            uint32_t v = (uint32_t)strtoul(value, &end, 0);
+            if (*end != '\0')
+            {
+                consoleError("not a number:", value);
+                return;
+            }
+            *consoleCfg->numbers[i].value = v;
+            return;
+        }
+    }
+    consoleError("no setting", name);
+}
+
+static void consoleEngine(const char *name, const char *value)
+{
+    bool on;
+    if (name == NULL || consoleOnOff(value, &on) == false)
+    {
+        consoleError("engine needs a name and on or off", NULL);
+        return;
+    }
+    bool all = strcmp(name, "all") == 0;
+    bool found = all;
+    for (uint32_t e = 1; e < diffNumEngines; ++e)
+    {
+        if (all || strcmp(name, diffEngines[e].name) == 0)
+        {
+            found = true;
+            if (on)
+            {
+                *consoleCfg->diffEngineMask |= 1u << e;
+            }
+            else
+            {
+                *consoleCfg->diffEngineMask &= ~(1u << e);
+            }
+        }
+    }
+    if (found == false)
+    {
+        consoleError(strcmp(name, diffEngines[0].name) == 0 ?
+                "the reference always runs:" : "no engine", name);
+    }
+}
+
+/* split consoleLine at spaces and run it */
+static void consoleRunLine(void)
+{
+    char *word[4] = { NULL, NULL, NULL, NULL };
+    uint32_t n = 0;
+    char *p = consoleLine;
+    while (n < 4)
+    {
+        while (*p == ' ' || *p == '\t')
+        {
+            *p++ = '\0';
+        }
+        if (*p == '\0')
+        {
+            break;
+        }
+        word[n++] = p;
+        while (*p != '\0' && *p != ' ' && *p != '\t')
+        {
+            ++p;
+        }
+    }
+    if (n == 0)
+    {
+        return;
+    }
+
+    if (strcmp(word[0], "help") == 0)
+    {
+        printAndWait((char *)consoleHelp, &consoleTxDone);
+    }
+    else if (strcmp(word[0], "show") == 0)
+    {
+        consoleShow();
+    }
+    else if (strcmp(word[0], "set") == 0)
+    {
+        consoleSet(word[1], word[2]);
+    }
+    else if (strcmp(word[0], "inputs") == 0)
+    {
+        if (word[1] != NULL && strcmp(word[1], "vectors") == 0)
+        {
+            *consoleCfg->benchInputs = BENCH_INPUTS_TEST_VECTORS;
+        }
+        else if (word[1] != NULL && strcmp(word[1], "random") == 0)
+        {
+            *consoleCfg->benchInputs = BENCH_INPUTS_RANDOM;
+        }
+        else
+        {
+            consoleError("inputs are vectors or random", NULL);
+        }
+    }
+    else if (strcmp(word[0], "engine") == 0)
+    {
+        consoleEngine(word[1], word[2]);
+    }
+    else if (strcmp(word[0], "run") == 0)
+    {
+        consoleRunRequested = true;
+        printAndWait("console: starting a new run\r\n\r\n", &consoleTxDone);
+    }
+    else
+    {
+        consoleError("unknown command", word[0]);
+    }
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void consoleInit(const consoleConfig *config)
+{
+    consoleCfg = config;
+    consoleRxRead = 0;
+    consoleLineLen = 0;
+    consoleRunRequested = false;
+
+#if USING_HW
+    static const DMAC_CHANNEL_SETUP setup = {
+        .trigger_source = SERCOM5_DMAC_ID_RX,
+        .trigger_action = DMAC_CHCTRLA_TRIGACT_BURST_Val,  // a byte per RXC
+        .beat_size = DMAC_BEAT_SIZE_BYTE,
+        .source_increment = false,
+        .destination_increment = true,
+        .priority_level = 1                 // above the print queue's 0
+    };
+    consoleRxChannel = DMAC_ChannelAllocate(&setup);
+    if (consoleRxChannel == DMAC_CHANNEL_NONE)
+    {
+        return;
+    }
+
+    // DSTADDR is the end of the block when it increments; no interrupt at
+    // the end of a block, the next is the same one again
+    consoleRxDescriptor.DMAC_BTCTRL = DMAC_BTCTRL_VALID_Msk |
+            DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_DSTINC_Msk |
+            DMAC_BTCTRL_BLOCKACT_NOACT;
+    consoleRxDescriptor.DMAC_BTCNT = CONSOLE_RX_RING_LEN;
+    consoleRxDescriptor.DMAC_SRCADDR =
+            (uint32_t)&SERCOM5_REGS->USART_INT.SERCOM_DATA;
+    consoleRxDescriptor.DMAC_DSTADDR =
+            (uint32_t)consoleRxRing + CONSOLE_RX_RING_LEN;
+    consoleRxDescriptor.DMAC_DESCADDR = (uint32_t)&consoleRxDescriptor;
+
+    consoleRxErrorClear();
+    SERCOM5_USART_ReceiverEnable();
+    DMAC_ChannelLinkedListTransfer(consoleRxChannel, &consoleRxDescriptor);
+#else
+    consoleSimWrite = 0;
+#endif
+}
+
+bool consolePoll(void)
+{
+    if (consoleCfg == NULL)
+    {
+        return false;
+    }
+#if USING_HW
+    // a framing error (a terminal at another rate, say) garbles a byte;
+    // the DMAC has taken that byte already, so only the flags are left
+    consoleRxErrorClear();
+#endif
+
+    uint32_t end = consoleRxWritePosition();
+    while (consoleRxRead != end)
+    {
+        char c = (char)consoleRxRing[consoleRxRead];
+        consoleRxRead = (consoleRxRead + 1) & (CONSOLE_RX_RING_LEN - 1);
+
+        if (c == '\r' || c == '\n')
+        {
+            consoleLine[consoleLineLen] = '\0';
+            consoleLineLen = 0;
+            consoleRunLine();
+        }
+        else if (c == '\b' || c == 0x7F)
+        {
+            if (consoleLineLen > 0)
+            {
+                --consoleLineLen;
+            }
+        }
+        else if (consoleLineLen < CONSOLE_LINE_LEN - 1)
+        {
+            consoleLine[consoleLineLen++] = c;
+        }
+    }
+    return consoleRunRequested;
+}
+
+void consoleRunStarted(void)
+{
+    consoleRunRequested = false;
+}
+
+#if !USING_HW
+void consoleSimInput(const char *bytes)
+{
+    while (*bytes != '\0')
+    {
+        consoleRxRing[consoleSimWrite] = (uint8_t)*bytes++;
+        consoleSimWrite = (consoleSimWrite + 1) & (CONSOLE_RX_RING_LEN - 1);
+    }
+}
+#endif
+
+/* *****************************************************************************
+ End of File
+ */
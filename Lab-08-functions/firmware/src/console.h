@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/** Serial command console
+
+  @File Name
+    console.h
+
+  @Summary
+    Reads commands from the UART into a circular DMA buffer and applies
+    them to main.c's test settings, so that a change needs no rebuild.
+
+  @Description
+    SERCOM5's receiver is copied by a DMAC channel (from
+    DMAC_ChannelAllocate) into a CONSOLE_RX_RING_LEN byte ring. The
+    channel's descriptor links to itself, so it never stops and needs no
+    interrupt: consolePoll() finds how far it has got with
+    DMAC_ChannelGetTransferredCount() and reads up to there. A line is
+    run when its '\r' or '\n' comes. If more than a ring of input arrives
+    between two polls the oldest is lost, which a person typing at a
+    terminal does not come near. Nothing is echoed; turn on the
+    terminal's local echo to see what is typed.
+
+    Commands, one per line:
+        help                      list the commands
+        show                      print every setting
+        set NAME on|off           a flag: unpack, abs, mult, fixsign, main,
+                                  fails, turbo, failfast, sandbox, sweep,
+                                  fuzz, bench, diff
+        set NAME VALUE            a number: fuzzseed, fuzzcount, diffseed,
+                                  diffcount, sweepfirst, sweeplast,
+                                  benchcount, benchseed, benchwarmup,
+                                  benchiterations (0x for hex)
+        inputs vectors|random     the benchmark's input set
+        engine NAME|all on|off    a multiply engine of the differential
+                                  test (see diffFuncs.h)
+        run                       start a new run with these settings
+    The names and what they set are main.c's consoleConfig; see there.
+
+    main.c polls the console while it idles after a run. When USING_HW is
+    0 there is no receiver: consoleSimInput() puts bytes in the ring
+    instead, as ../host/simCheck.cpp does to check the commands.
+ */
+/* ************************************************************************** */
+
+#ifndef _CONSOLE_H    /* Guard against multiple inclusion */
+#define _CONSOLE_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "benchStats.h"
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* Receive ring; a power of two */
+#define CONSOLE_RX_RING_LEN 256
+
+    /* Longest command line; the rest of a longer one is dropped */
+#define CONSOLE_LINE_LEN 80
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+typedef struct _consoleFlag
+{
+    const char *name;
+    bool *flag;
+} consoleFlag;
+
+typedef struct _consoleNumber
+{
+    const char *name;
+    uint32_t *value;
+} consoleNumber;
+
+    /* what the commands change; all of it belongs to the caller */
+typedef struct _consoleConfig
+{
+    const consoleFlag *flags;
+    uint32_t numFlags;
+    const consoleNumber *numbers;
+    uint32_t numNumbers;
+    benchInputSet *benchInputs;
+    uint32_t *diffEngineMask;  // bit e is diffEngines[e]
+} consoleConfig;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* start receiving; call after uartPortNegotiate() and printQueueInit() */
+void consoleInit(const consoleConfig *config);
+
+    /* run the commands that have come in; true once "run" has been given */
+bool consolePoll(void);
+
+    /* clear the "run" request, as a new run starts */
+void consoleRunStarted(void);
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Simulator hooks (only defined when USING_HW is 0)
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* bytes as if they had been received */
+void consoleSimInput(const char *bytes);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CONSOLE_H */
+
+/* *****************************************************************************
+ End of File
+ */
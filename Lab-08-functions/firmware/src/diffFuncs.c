@@ -0,0 +1,336 @@
+/* ************************************************************************** */
+/** Differential testing of the multiply implementations
+
+  @File Name
+    diffFuncs.c
+
+  @Summary
+    Runs every registered multiply engine on the same stream of packed
+    inputs and reports where each one first disagrees with the reference.
+
+  @Description
+    See diffFuncs.h.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <string.h>
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "asmExterns.h"
+#include "printFuncs.h"  // lab print funcs
+#include "diffFuncs.h"
+#include "fuzzFuncs.h"
+#include "testVectors.h"
+#include "testGuard.h"
+
+#define MAX_PRINT_LEN 400
+
+#define USING_HW 1
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint8_t diffTxBuffer[MAX_PRINT_LEN] = {0};
+
+/* one block of the input stream, the reference products for it, and the
+ * products of the engine being checked */
+static uint32_t diffInputs[DIFF_BLOCK_LEN];
+static int32_t diffExpected[DIFF_BLOCK_LEN];
+static int32_t diffActual[DIFF_BLOCK_LEN];
+
+/* n * n / 4 for n = 0 .. 510, the largest sum of two bytes */
+static uint32_t diffQuarterSquares[511];
+static bool diffQuarterSquaresReady = false;
+
+/* how the call an asm engine stopped at ended */
+static testGuardStatus diffGuardStatus = TEST_GUARD_OK;
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint32_t diffMul(const uint32_t *packed, int32_t *product, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        product[i] = TV_A(packed[i]) * TV_B(packed[i]);
+    }
+    return n;
+}
+
+/* SMUAD adds the products of the low and of the high halfwords; with the
+ * multiplier alone in one operand and the multiplicand alone in the other,
+ * the high product is 0 */
+static uint32_t diffSmuad(const uint32_t *packed, int32_t *product,
+        uint32_t n)
+{
+    for (uint32_t i = 0; i < n; ++i)
+    {
+#if USING_HW
+        product[i] = (int32_t)__SMUAD(packed[i] & 0xFFFF, packed[i] >> 16);
+#else
+        product[i] = (int32_t)(int16_t)(packed[i] & 0xFFFF) *
+                (int32_t)(int16_t)(packed[i] >> 16);
+#endif
+    }
+    return n;
+}
+
+/* x * y for bytes, as (x + y)^2 / 4 - (x - y)^2 / 4. x + y and x - y are
+ * both even or both odd, so the truncation in the table cancels out. */
+static inline uint32_t diffByteProduct(uint32_t x, uint32_t y)
+{
+    uint32_t d = x > y ? x - y : y - x;
+    return diffQuarterSquares[x + y] - diffQuarterSquares[d];
+}
+
+/* |A| and |B| (at most 0x8000) split into bytes, four table products */
+static uint32_t diffQuarterSquare(const uint32_t *packed, int32_t *product,
+        uint32_t n)
+{
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        int32_t a = TV_A(packed[i]);
+        int32_t b = TV_B(packed[i]);
+        uint32_t ua = (uint32_t)TV_ABS(a);
+        uint32_t ub = (uint32_t)TV_ABS(b);
+        uint32_t ah = ua >> 8, al = ua & 0xFF;
+        uint32_t bh = ub >> 8, bl = ub & 0xFF;
+        uint32_t p = (diffByteProduct(ah, bh) << 16) +
+                ((diffByteProduct(ah, bl) + diffByteProduct(al, bh)) << 8) +
+                diffByteProduct(al, bl);
+        product[i] = TV_SIGN(a) != TV_SIGN(b) ? -(int32_t)p : (int32_t)p;
+    }
+    return n;
+}
+
+/* the asm engines guard each call (product[] is out of the sandbox's
+ * reach, so the call writes a local) and stop at the first that times out
+ * or faults */
+static uint32_t diffAsmMult(const uint32_t *packed, int32_t *product,
+        uint32_t n)
+{
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        int32_t a = TV_A(packed[i]);
+        int32_t b = TV_B(packed[i]);
+        int32_t p = 0;
+        TEST_GUARD_CALL(diffGuardStatus, RESULT_MODE_DIFF, packed[i],
+                p = asmMult(TV_ABS(a), TV_ABS(b)));
+        if (diffGuardStatus != TEST_GUARD_OK)
+        {
+            return i;
+        }
+        product[i] = TV_SIGN(a) != TV_SIGN(b) ? -p : p;
+    }
+    return n;
+}
+
+static uint32_t diffAsmMain(const uint32_t *packed, int32_t *product,
+        uint32_t n)
+{
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        int32_t p = 0;
+        TEST_GUARD_CALL(diffGuardStatus, RESULT_MODE_DIFF, packed[i],
+                p = asmMain(packed[i]));
+        if (diffGuardStatus != TEST_GUARD_OK)
+        {
+            return i;
+        }
+        product[i] = p;
+    }
+    return n;
+}
+
+/* note the inputs of one block where engine e differs from the reference */
+static void diffScanBlock(diffEngineResult *e, uint32_t firstIndex,
+        uint32_t n)
+{
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        if (diffActual[i] != diffExpected[i])
+        {
+            if (e->mismatches == 0)
+            {
+                e->firstIndex = firstIndex + i;
+                e->firstInput = diffInputs[i];
+                e->firstActual = diffActual[i];
+                e->firstExpected = diffExpected[i];
+            }
+            ++e->mismatches;
+        }
+    }
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+    /* add an engine here to check it against the others; keep mul first */
+const diffEngine diffEngines[] = {
+    { "mul",     diffMul },
+    { "smuad",   diffSmuad },
+    { "qsquare", diffQuarterSquare },
+    { "asmMult", diffAsmMult },
+    { "asmMain", diffAsmMain }
+};
+const uint32_t diffNumEngines = sizeof(diffEngines) / sizeof(diffEngines[0]);
+
+void runDifferential(uint32_t seed,
+        uint32_t numCases,
+        uint32_t engineMask,
+        diffResult *r,
+        volatile bool *tick,
+        volatile bool *txComplete)
+{
+    uint32_t numEngines = diffNumEngines < DIFF_MAX_ENGINES ?
+            diffNumEngines : DIFF_MAX_ENGINES;
+    uint32_t ticks = 0;
+    engineMask |= 1;
+
+    if (diffQuarterSquaresReady == false)
+    {
+        for (uint32_t k = 0; k < sizeof(diffQuarterSquares) /
+                sizeof(diffQuarterSquares[0]); ++k)
+        {
+            diffQuarterSquares[k] = k * k / 4;
+        }
+        diffQuarterSquaresReady = true;
+    }
+
+    memset(r, 0, sizeof(*r));
+    r->seed = seed != 0 ? seed : 0x2545F491;    // xorshift must not start at 0
+    uint32_t state = r->seed;
+
+    snprintf((char*)diffTxBuffer, MAX_PRINT_LEN,
+            "========= DIFFERENTIAL TEST of %lu multiply engines: seed 0x%08lx, "
+            "%lu cases, reference %s\r\n"
+            "\r\n",
+            (uint32_t)__builtin_popcount(engineMask &
+                    ((1u << numEngines) - 1)),
+            r->seed, numCases, diffEngines[0].name);
+    printAndWait((char*)diffTxBuffer, txComplete);
+    *tick = false;
+
+    while (r->casesRun < numCases)
+    {
+        uint32_t n = numCases - r->casesRun;
+        if (n > DIFF_BLOCK_LEN)
+        {
+            n = DIFF_BLOCK_LEN;
+        }
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            diffInputs[i] = fuzzPackedValue(&state);
+        }
+
+        diffEngines[0].run(diffInputs, diffExpected, n);
+        for (uint32_t e = 1; e < numEngines; ++e)
+        {
+            diffEngineResult *d = &r->engine[e];
+            if ((engineMask & (1u << e)) == 0 || d->stopped == true)
+            {
+                continue;
+            }
+            uint32_t made = diffEngines[e].run(diffInputs, diffActual, n);
+            if (memcmp(diffActual, diffExpected,
+                    made * sizeof(diffActual[0])) != 0)
+            {
+                diffScanBlock(d, r->casesRun, made);
+            }
+            if (made < n)
+            {
+                d->stopped = true;
+                d->stopIndex = r->casesRun + made;
+                d->stopInput = diffInputs[made];
+                testGuardPrintFailure(diffGuardStatus, RESULT_MODE_DIFF,
+                        d->stopInput, txComplete);
+            }
+        }
+        r->casesRun += n;
+
+        if (*tick == true)
+        {
+            *tick = false;
+            if (++ticks >= DIFF_PROGRESS_TICKS)
+            {
+                ticks = 0;
+                LED0_Toggle();
+                snprintf((char*)diffTxBuffer, MAX_PRINT_LEN,
+                        "differential progress: %lu of %lu cases\r\n",
+                        r->casesRun, numCases);
+                printAndWait((char*)diffTxBuffer, txComplete);
+            }
+        }
+    }
+
+    snprintf((char*)diffTxBuffer, MAX_PRINT_LEN,
+            "========= DIFFERENTIAL TEST COMPLETE: seed 0x%08lx, %lu cases\r\n",
+            r->seed, r->casesRun);
+    printAndWait((char*)diffTxBuffer, txComplete);
+    for (uint32_t e = 1; e < numEngines; ++e)
+    {
+        const diffEngineResult *d = &r->engine[e];
+        if ((engineMask & (1u << e)) == 0)
+        {
+            continue;
+        }
+        if (d->stopped == true)
+        {
+            snprintf((char*)diffTxBuffer, MAX_PRINT_LEN,
+                    "%-8s stopped at case %lu: packed 0x%08lx timed out or "
+                    "faulted\r\n",
+                    diffEngines[e].name, d->stopIndex, d->stopInput);
+            printAndWait((char*)diffTxBuffer, txComplete);
+        }
+        if (d->mismatches == 0)
+        {
+            snprintf((char*)diffTxBuffer, MAX_PRINT_LEN,
+                    "%-8s bit-exact with %s%s\r\n",
+                    diffEngines[e].name, diffEngines[0].name,
+                    d->stopped == true ? " before that" : "");
+        }
+        else
+        {
+            int32_t a = TV_A(d->firstInput);
+            int32_t b = TV_B(d->firstInput);
+            snprintf((char*)diffTxBuffer, MAX_PRINT_LEN,
+                    "%-8s %lu cases differ. First at case %lu: packed "
+                    "0x%08lx, A %ld, B %ld, |A| %ld, |B| %ld, signs %ld %ld\r\n"
+                    "         returned %ld (0x%08lx), %s returned %ld "
+                    "(0x%08lx)\r\n",
+                    diffEngines[e].name, d->mismatches, d->firstIndex,
+                    d->firstInput, a, b, TV_ABS(a), TV_ABS(b),
+                    (int32_t)TV_SIGN(a), (int32_t)TV_SIGN(b),
+                    d->firstActual, (uint32_t)d->firstActual,
+                    diffEngines[0].name,
+                    d->firstExpected, (uint32_t)d->firstExpected);
+        }
+        printAndWait((char*)diffTxBuffer, txComplete);
+    }
+    printAndWait("\r\n", txComplete);
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/** Differential testing of the multiply implementations
+
+  @File Name
+    diffFuncs.h
+
+  @Summary
+    Runs every registered multiply engine on the same stream of packed
+    inputs and reports where each one first disagrees with the reference.
+
+  @Description
+    An engine turns a block of packed values (multiplicand in the upper 16
+    bits, multiplier in the lower, as asmMain takes them) into a block of
+    signed products. The engines are listed in diffEngines[] in
+    diffFuncs.c:
+      - mul:     A * B in C; one hardware MUL. This is the reference.
+      - smuad:   the DSP extension's SMUAD on the two halfwords
+      - qsquare: a quarter-square lookup table, four byte products
+      - asmMult: the student's asmMult on |A| and |B|, sign fixed in C
+      - asmMain: the student's asmMain
+    To check a faster multiply against the others, add it to that table;
+    the console's engine command (console.h) turns engines off and on.
+
+    The inputs come from fuzzPackedValue() (see fuzzFuncs.h) in blocks of
+    DIFF_BLOCK_LEN. Each engine fills an output block, which is compared
+    with the reference block as a whole; only a block that differs is
+    scanned for the inputs that differ. Nothing is printed per case. The
+    summary gives, for each engine, how many products differed and the
+    full operands of the first one.
+
+    The asm engines guard each call (testGuard.h) as RESULT_MODE_DIFF,
+    with the packed value as the test case. An engine whose call times
+    out or faults prints that value and is left out of the rest of the
+    run; the others go on.
+ */
+/* ************************************************************************** */
+
+#ifndef _DIFF_FUNCS_H    /* Guard against multiple inclusion */
+#define _DIFF_FUNCS_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* Packed inputs given to each engine per call */
+#define DIFF_BLOCK_LEN 256
+
+    /* Room for the engines of diffEngines[] in a diffResult */
+#define DIFF_MAX_ENGINES 8
+
+    /* Progress is printed after this many RTC ticks (10 ms each) */
+#define DIFF_PROGRESS_TICKS 300
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* product[i] = A * B of packed[i], for i < n; returns how many it
+     * made, less than n only if the call for the next timed out or
+     * faulted */
+typedef uint32_t (*diffBatchFunc)(const uint32_t *packed, int32_t *product,
+        uint32_t n);
+
+typedef struct _diffEngine
+{
+    const char *name;
+    diffBatchFunc run;
+} diffEngine;
+
+typedef struct _diffEngineResult
+{
+    uint32_t mismatches;       // products that differed from the reference
+    uint32_t firstIndex;       // position in the input stream of the first
+    uint32_t firstInput;       // its packed value
+    int32_t  firstActual;      // what this engine returned
+    int32_t  firstExpected;    // what the reference returned
+    bool     stopped;          // a call timed out or faulted; the engine
+                               // was not run after it
+    uint32_t stopIndex;        // position and packed value of that call
+    uint32_t stopInput;
+} diffEngineResult;
+
+typedef struct _diffResult
+{
+    uint32_t seed;             // generator seed actually used for the run
+    uint32_t casesRun;
+    diffEngineResult engine[DIFF_MAX_ENGINES];  // indexed as diffEngines[]
+} diffResult;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* the registered engines; diffEngines[0] is the reference */
+extern const diffEngine diffEngines[];
+extern const uint32_t diffNumEngines;
+
+    /**
+      @Function
+        void runDifferential(uint32_t seed, uint32_t numCases,
+                             uint32_t engineMask, diffResult *r,
+                             volatile bool *tick, volatile bool *txComplete)
+
+      @Summary
+        Runs numCases packed values generated from seed through every
+        engine and compares each with diffEngines[0].
+
+      @Parameters
+        @param seed  generator seed; 0 uses a fixed seed. The seed used is
+                     printed and stored in r.
+        @param engineMask  bit e set runs diffEngines[e]; the reference,
+                     diffEngines[0], always runs
+        @param tick  flag set by the RTC callback every 10 ms; used only to
+                     pace the progress output
+     */
+void runDifferential(uint32_t seed,
+        uint32_t numCases,
+        uint32_t engineMask,
+        diffResult *r,
+        volatile bool *tick,
+        volatile bool *txComplete);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DIFF_FUNCS_H */
+
+/* *****************************************************************************
+ End of File
+ */
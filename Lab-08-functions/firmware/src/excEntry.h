@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/** Entry stub for exception handlers that need the stacked frame
+
+  @File Name
+    excEntry.h
+
+  @Summary
+    The body of a naked exception handler that passes the stacked
+    exception frame to a C function.
+
+  @Description
+    An exception stacks r0-r3, r12, lr, pc and xPSR on the stack that was
+    in use when it was taken: MSP if it interrupted a handler, PSP if it
+    interrupted thread code running on the process stack. Bit 2 of the
+    EXC_RETURN value in lr says which. EXC_ENTRY() picks that stack into
+    r0 and branches to the handler, so the handler runs as
+        void handler(uint32_t *frame, ...);
+    and returns straight to the exception return.
+
+    Any further argument is loaded by the setup string, which runs after
+    r0 is set and before the branch.
+
+    Usage:
+        void __attribute__((naked)) PendSV_Handler(void)
+        {
+            EXC_ENTRY(testGuardPendSV, "");
+        }
+    and with the fault type in r1, as in config/sam_e51_cnano/exceptions.c:
+        EXC_ENTRY(faultCaptureHandler,
+                "    movs   r1, #" EXC_XSTR(FAULT_TYPE_BUS) "\n");
+
+    Use it only as the whole body of a function declared naked.
+ */
+/* ************************************************************************** */
+
+#ifndef _EXC_ENTRY_H    /* Guard against multiple inclusion */
+#define _EXC_ENTRY_H
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* turn a macro's value into a string for an asm operand */
+#define EXC_STR(x)  #x
+#define EXC_XSTR(x) EXC_STR(x)
+
+    /* r0 = the stacked frame (MSP or PSP, per EXC_RETURN bit 2), run
+     * setup, then branch to handler */
+#define EXC_ENTRY(handler, setup)                   \
+    __asm volatile (                                \
+        "    tst    lr, #4              \n"         \
+        "    ite    eq                  \n"         \
+        "    mrseq  r0, msp             \n"         \
+        "    mrsne  r0, psp             \n"         \
+        setup                                       \
+        "    b      " #handler "        \n"         \
+    )
+
+
+#endif /* _EXC_ENTRY_H */
+
+/* *****************************************************************************
+ End of File
+ */
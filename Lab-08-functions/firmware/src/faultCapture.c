@@ -0,0 +1,306 @@
+/* ************************************************************************** */
+/** Fault capture across a reset
+
+  @File Name
+    faultCapture.c
+
+  @Summary
+    Records the details of a fault taken while a test case runs, resets the
+    board, and lets the harness skip that case on the next run.
+
+  @Description
+    See faultCapture.h.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <string.h>
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "printFuncs.h"  // lab print funcs
+#include "printQueue.h"
+#include "testVectors.h" // TEST_VECTOR_COUNT
+#include "testGuard.h"
+#include "faultCapture.h"
+#include "sandbox.h"
+
+#define MAX_PRINT_LEN 400
+
+#define USING_HW 1
+
+/* first word of a valid log: "FLT3" */
+#define FAULT_LOG_MAGIC 0x464C5433UL
+
+/* words of one group's bitmap of faulted cases */
+#define FAULT_CASE_WORDS ((TEST_VECTOR_COUNT + 31) / 32)
+
+/* xc32 leaves persistent variables alone at startup, so they survive a reset */
+#if USING_HW
+#define FAULT_PERSISTENT __attribute__((persistent))
+#else
+#define FAULT_PERSISTENT
+#endif
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint8_t faultTxBuffer[MAX_PRINT_LEN] = {0};
+
+typedef struct _faultLog
+{
+    uint32_t magic;         // FAULT_LOG_MAGIC once initialized
+    uint32_t currentGroup;  // test or mode running now, or RESULT_NUM_TESTS
+                            // for none
+    uint32_t currentCase;
+    uint32_t count;         // records in use
+    uint32_t overflow;      // faults past FAULT_MAX_RECORDS, not recorded
+    faultRecord records[FAULT_MAX_RECORDS];
+    // every case that faulted, recorded or not, so that each reset gets
+    // the run past one more case however many fault
+    uint32_t faulted[RESULT_NUM_TESTS][FAULT_CASE_WORDS];
+    // a bit per mode, from RESULT_NUM_TESTS + 1, that reset the board
+    uint32_t modesFaulted;
+} faultLog;
+
+static faultLog faults FAULT_PERSISTENT;
+
+/* the last fault the sandbox recovered from; ordinary RAM, since nothing
+ * about it needs to survive a reset */
+static faultRecord faultRecovered;
+static bool faultRecoveredValid = false;
+
+static const char * const faultTypeNames[] = {
+    "?", "HardFault", "MemManage", "BusFault", "UsageFault", "SVC"
+};
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static inline uint32_t faultModeBit(uint32_t group)
+{
+    return 1UL << (group - (RESULT_NUM_TESTS + 1));
+}
+
+static void faultFill(faultRecord *f, const uint32_t *frame, uint32_t type)
+{
+    f->group = faults.currentGroup;
+    f->testCase = faults.currentCase;
+    f->type = type;
+    // stacked frame: r0, r1, r2, r3, r12, lr, pc, xpsr
+    f->lr = frame[5];
+    f->pc = frame[6];
+    f->xpsr = frame[7];
+#if USING_HW
+    f->cfsr = SCB->CFSR;
+    f->hfsr = SCB->HFSR;
+    f->bfar = SCB->BFAR;
+    f->mmfar = SCB->MMFAR;
+#endif
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void faultInit(void)
+{
+    if (faults.magic != FAULT_LOG_MAGIC || faults.count > FAULT_MAX_RECORDS)
+    {
+        faultClear();
+    }
+    faultClearCurrentTest();
+#if USING_HW
+    SCB->SHCSR |= SCB_SHCSR_USGFAULTENA_Msk |
+            SCB_SHCSR_BUSFAULTENA_Msk |
+            SCB_SHCSR_MEMFAULTENA_Msk;
+#endif
+}
+
+void faultSetCurrentTest(resultTestId group, uint32_t testCase)
+{
+    faultRecoveredValid = false;
+    faults.currentGroup = group;
+    faults.currentCase = testCase;
+}
+
+void faultClearCurrentTest(void)
+{
+    faults.currentGroup = RESULT_NUM_TESTS;
+    faults.currentCase = 0;
+}
+
+const faultRecord *faultFind(resultTestId group, uint32_t testCase)
+{
+    for (uint32_t i = 0; i < faults.count; ++i)
+    {
+        if (faults.records[i].group == group &&
+                (faults.records[i].testCase == testCase ||
+                RESULT_IS_MODE(group)))
+        {
+            return &faults.records[i];
+        }
+    }
+    return NULL;
+}
+
+const faultRecord *faultLastRecovered(void)
+{
+    return faultRecoveredValid == true ? &faultRecovered : NULL;
+}
+
+bool faultSeen(resultTestId group, uint32_t testCase)
+{
+    if (RESULT_IS_MODE(group))
+    {
+        return (faults.modesFaulted & faultModeBit(group)) != 0;
+    }
+    if (group >= RESULT_NUM_TESTS || testCase >= TEST_VECTOR_COUNT)
+    {
+        return false;
+    }
+    return (faults.faulted[group][testCase / 32] &
+            (1UL << (testCase % 32))) != 0;
+}
+
+void faultCaseName(char *buf, uint32_t len, uint32_t group,
+        uint32_t testCase)
+{
+    if (RESULT_IS_MODE(group))
+    {
+        snprintf(buf, len, "%s packed 0x%08lx", resultTestNames[group],
+                testCase);
+    }
+    else
+    {
+        snprintf(buf, len, "%s test case %lu", resultTestNames[group],
+                testCase);
+    }
+}
+
+uint32_t faultPrintSummary(volatile bool *txComplete)
+{
+    char name[40];
+
+    for (uint32_t i = 0; i < faults.count; ++i)
+    {
+        const faultRecord *f = &faults.records[i];
+        faultCaseName(name, sizeof(name), f->group, f->testCase);
+        snprintf((char*)faultTxBuffer, MAX_PRINT_LEN,
+                "FAULT: %s: %s at PC 0x%08lx\r\n"
+                "  LR 0x%08lx  xPSR 0x%08lx\r\n"
+                "  CFSR 0x%08lx  HFSR 0x%08lx  BFAR 0x%08lx  MMFAR 0x%08lx\r\n",
+                name, faultTypeNames[f->type], f->pc,
+                f->lr, f->xpsr,
+                f->cfsr, f->hfsr, f->bfar, f->mmfar);
+        printAndWait((char*)faultTxBuffer, txComplete);
+    }
+    if (faults.overflow != 0)
+    {
+        snprintf((char*)faultTxBuffer, MAX_PRINT_LEN,
+                "FAULT: %lu more test cases faulted after the log of %d "
+                "was full; not recorded\r\n",
+                faults.overflow, FAULT_MAX_RECORDS);
+        printAndWait((char*)faultTxBuffer, txComplete);
+    }
+    snprintf((char*)faultTxBuffer, MAX_PRINT_LEN,
+            "========= FAULT SUMMARY: %lu test cases faulted\r\n"
+            "\r\n",
+            faults.count + faults.overflow);
+    printAndWait((char*)faultTxBuffer, txComplete);
+    return faults.count + faults.overflow;
+}
+
+void faultClear(void)
+{
+    memset(&faults, 0, sizeof(faults));
+    faults.magic = FAULT_LOG_MAGIC;
+    faults.currentGroup = RESULT_NUM_TESTS;
+}
+
+void faultRecoverSandbox(uint32_t *frame, uint32_t type)
+{
+    faultFill(&faultRecovered, frame, type);
+    faultRecoveredValid = true;
+    testGuardRedirect(frame, TEST_GUARD_FAULT);
+}
+
+void faultCaptureHandler(uint32_t *frame, uint32_t type)
+{
+    bool inTest = faults.currentGroup < RESULT_NUM_TESTS ||
+            RESULT_IS_MODE(faults.currentGroup);
+
+#if USING_HW
+    // The MPU stopped a load or store by the sandboxed call before it
+    // happened, so nothing needs a reset: unwind to the runner instead,
+    // and keep the case out of the log so that it runs again next time.
+    // Stacking errors (MSTKERR/MUNSTKERR) leave no usable frame.
+    if (type == FAULT_TYPE_MEMMANAGE && sandboxActive() == true &&
+            (SCB->CFSR & (SCB_CFSR_DACCVIOL_Msk | SCB_CFSR_IACCVIOL_Msk)) != 0 &&
+            (SCB->CFSR & (SCB_CFSR_MSTKERR_Msk | SCB_CFSR_MUNSTKERR_Msk)) == 0)
+    {
+        faultRecoverSandbox(frame, type);
+        SCB->CFSR = SCB->CFSR & SCB_CFSR_MEMFAULTSR_Msk;  // write 1 to clear
+        return;
+    }
+#endif
+
+    if (RESULT_IS_MODE(faults.currentGroup))
+    {
+        // after the reset the mode reports this and stops
+        faults.modesFaulted |= faultModeBit(faults.currentGroup);
+    }
+    else if (inTest == true && faults.currentCase < TEST_VECTOR_COUNT)
+    {
+        faults.faulted[faults.currentGroup][faults.currentCase / 32] |=
+                1UL << (faults.currentCase % 32);
+    }
+    if (inTest == true && faults.count >= FAULT_MAX_RECORDS)
+    {
+        ++faults.overflow;
+    }
+    else if (inTest == true)
+    {
+        faultFill(&faults.records[faults.count++], frame, type);
+    }
+
+#if USING_HW
+#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
+    __builtin_software_breakpoint();
+#endif
+    if (inTest == true)
+    {
+        // send what was already printed; the reset would drop it
+        printQueueFlushPolled();
+        NVIC_SystemReset();
+    }
+    while (true)
+    {
+    }
+#else
+    // the simulator cannot reset; go straight back to the runner
+    (void)inTest;
+    testGuardAbandon(TEST_GUARD_FAULT);
+#endif
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/** Fault capture across a reset
+
+  @File Name
+    faultCapture.h
+
+  @Summary
+    Records the details of a HardFault, MemManage, BusFault or UsageFault
+    taken while a test case runs, resets the board, and lets the harness
+    skip that case and report it on the next run.
+
+  @Description
+    The fault handlers in config/sam_e51_cnano/exceptions.c pass the stacked
+    exception frame to faultCaptureHandler(). It stores the stacked PC, LR
+    and xPSR, the fault status registers (CFSR, HFSR) and fault addresses
+    (BFAR, MMFAR), and the test group and case that were running (set by
+    TEST_GUARD_CALL() through faultSetCurrentTest()) in RAM that the startup
+    code does not clear, then calls NVIC_SystemReset().
+
+    After the reset the tests run again from the start. TEST_GUARD_CALL()
+    does not call a case that has a fault record; it reports it as FAULT
+    instead, so the run continues past it. main.c prints every record in a
+    fault summary at the end of the run and then clears them, so pressing
+    reset afterwards tests those cases again.
+
+    At most FAULT_MAX_RECORDS faults are recorded per run. Past that the
+    board still resets, and the log keeps only a count and a bitmap of the
+    cases, enough to skip them; the summary gives the count. A fault
+    outside any test case is not followed by a reset, since the reset
+    would not get the harness any further.
+
+    A MemManage fault from the MPU sandbox (sandbox.h), or an SVC issued by
+    the code under test, needs no reset: the blocked access never
+    happened, so the handler returns into a trampoline that unwinds to
+    TEST_GUARD_CALL(). It is kept in ordinary RAM, not in the log, for
+    testGuardPrintFailure() to report; the case runs again next time and
+    uses up no record.
+
+    A mode (sweep, fuzz, ...) names its calls with its own group and the
+    packed value as the test case, and stops at its first TIMEOUT or
+    FAULT. A mode that reset the board is not run again after the reset:
+    every call it makes reports FAULT at once, so it stops at the first,
+    and its record, found whatever packed value is asked for, gives the
+    input that faulted. main.c prints the summary after the modes.
+
+    When USING_HW is 0 there is no reset: faultCaptureHandler() records the
+    fault and unwinds straight back to TEST_GUARD_CALL().
+ */
+/* ************************************************************************** */
+
+#ifndef _FAULT_CAPTURE_H    /* Guard against multiple inclusion */
+#define _FAULT_CAPTURE_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "resultStore.h"  // resultTestId
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+#define FAULT_MAX_RECORDS 8
+
+    /* which handler captured the fault */
+#define FAULT_TYPE_HARD       1
+#define FAULT_TYPE_MEMMANAGE  2
+#define FAULT_TYPE_BUS        3
+#define FAULT_TYPE_USAGE      4
+#define FAULT_TYPE_SVC        5   // an SVC other than the sandbox's own
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+typedef struct _faultRecord
+{
+    uint32_t group;     // resultTestId of the running test
+    uint32_t testCase;  // index into tc[], or a mode's packed value
+    uint32_t type;      // FAULT_TYPE_xxx
+    uint32_t pc;        // stacked registers of the faulting code
+    uint32_t lr;
+    uint32_t xpsr;
+    uint32_t cfsr;      // SCB fault status and address registers
+    uint32_t hfsr;
+    uint32_t bfar;
+    uint32_t mmfar;
+} faultRecord;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* keep the records from before the last reset if they are valid,
+     * otherwise clear them; enable the separate MemManage, BusFault and
+     * UsageFault handlers so faults are not all escalated to HardFault */
+void faultInit(void);
+
+    /* name the test that is about to run; faults are charged to it */
+void faultSetCurrentTest(resultTestId group, uint32_t testCase);
+
+    /* no test is running */
+void faultClearCurrentTest(void);
+
+    /* the record for a case, or NULL if it has not faulted or faulted
+     * after the log was full. A mode has at most one, whatever testCase. */
+const faultRecord *faultFind(resultTestId group, uint32_t testCase);
+
+    /* the last fault the sandbox recovered from during the current or last
+     * guarded call, or NULL if it returned or has not started */
+const faultRecord *faultLastRecovered(void);
+
+    /* true if a case faulted during this run, recorded or not; for a
+     * mode, true for every case once any one has */
+bool faultSeen(resultTestId group, uint32_t testCase);
+
+    /* "asmMult test case 3", or "sweep packed 0x80000001" for a mode,
+     * into buf */
+void faultCaseName(char *buf, uint32_t len, uint32_t group,
+        uint32_t testCase);
+
+    /* print all records and the count of faults past them; returns the
+     * number of faults */
+uint32_t faultPrintSummary(volatile bool *txComplete);
+
+    /* forget all records and faulted cases */
+void faultClear(void);
+
+    /* called by the fault handlers with the stacked exception frame */
+void faultCaptureHandler(uint32_t *frame, uint32_t type);
+
+    /* keep the fault as the last recovered one and make the handler's
+     * return unwind to TEST_GUARD_CALL(); the sandbox is active */
+void faultRecoverSandbox(uint32_t *frame, uint32_t type);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FAULT_CAPTURE_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,185 @@
+/* ************************************************************************** */
+/** Fast fixed-format integer output
+
+  @File Name
+    fmtFuncs.c
+
+  @Summary
+    Appends strings, padded decimals and zero-padded hex to a buffer; the
+    test reports use it instead of snprintf.
+
+  @Description
+    See fmtFuncs.h.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stddef.h>                     // Defines NULL
+#include <string.h>
+#include "fmtFuncs.h"
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* "00" to "99"; entry n is at 2 * n */
+static const char fmtDigitPairs[200] = {
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899"
+};
+
+static const char fmtHexDigits[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7',
+    '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
+
+/* widest field: 10 digits and a sign, or the widest padding asked for */
+#define FMT_FIELD_LEN 32
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* append n characters, or as many as fit */
+static inline void fmtPut(fmtWriter *w, const char *s, uint32_t n)
+{
+    uint32_t room = w->cap > w->len ? w->cap - 1 - w->len : 0;
+    if (n > room)
+    {
+        n = room;
+    }
+    memcpy(w->buf + w->len, s, n);
+    w->len += n;
+}
+
+/* the decimal digits of v, written backwards so they end at end; returns
+ * the first */
+static inline char *fmtDigits(uint32_t v, char *end)
+{
+    char *p = end;
+    while (v >= 100)
+    {
+        uint32_t q = v / 100;
+        uint32_t r = v - q * 100;
+        p -= 2;
+        p[0] = fmtDigitPairs[2 * r];
+        p[1] = fmtDigitPairs[2 * r + 1];
+        v = q;
+    }
+    if (v >= 10)
+    {
+        p -= 2;
+        p[0] = fmtDigitPairs[2 * v];
+        p[1] = fmtDigitPairs[2 * v + 1];
+    }
+    else
+    {
+        *--p = (char)('0' + v);
+    }
+    return p;
+}
+
+/* the field from p to end, spaces in front up to width */
+static void fmtPadded(fmtWriter *w, char *p, char *end, uint32_t width,
+        char *field)
+{
+    uint32_t n = (uint32_t)(end - p);
+    if (width > FMT_FIELD_LEN)
+    {
+        width = FMT_FIELD_LEN;
+    }
+    while (n < width && p > field)
+    {
+        *--p = ' ';
+        ++n;
+    }
+    fmtPut(w, p, n);
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void fmtBegin(fmtWriter *w, char *buf, uint32_t cap)
+{
+    w->buf = buf;
+    w->cap = cap;
+    w->len = 0;
+}
+
+uint32_t fmtEnd(fmtWriter *w)
+{
+    if (w->cap != 0)
+    {
+        w->buf[w->len] = '\0';
+    }
+    return w->len;
+}
+
+void fmtStr(fmtWriter *w, const char *s)
+{
+    fmtPut(w, s, (uint32_t)strlen(s));
+}
+
+void fmtDec(fmtWriter *w, int32_t v, uint32_t width)
+{
+    char field[FMT_FIELD_LEN];
+    char *end = field + FMT_FIELD_LEN;
+    // 0 - v as unsigned, so that INT32_MIN has a magnitude too
+    char *p = fmtDigits(v < 0 ? 0u - (uint32_t)v : (uint32_t)v, end);
+    if (v < 0)
+    {
+        *--p = '-';
+    }
+    fmtPadded(w, p, end, width, field);
+}
+
+void fmtUDec(fmtWriter *w, uint32_t v, uint32_t width)
+{
+    char field[FMT_FIELD_LEN];
+    char *end = field + FMT_FIELD_LEN;
+    fmtPadded(w, fmtDigits(v, end), end, width, field);
+}
+
+void fmtHex(fmtWriter *w, uint32_t v, uint32_t digits)
+{
+    char field[8];
+    // at least digits digits, and all of v's
+    uint32_t n = v == 0 ? 1 : 8 - (uint32_t)__builtin_clz(v) / 4;
+    if (digits > n)
+    {
+        n = digits > 8 ? 8 : digits;
+    }
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        field[7 - i] = fmtHexDigits[(v >> (4 * i)) & 0xF];
+    }
+    fmtPut(w, field + 8 - n, n);
+}
+
+void fmtDecHex(fmtWriter *w, int32_t v)
+{
+    fmtDec(w, v, 11);
+    fmtPut(w, "; 0x", 4);
+    fmtHex(w, (uint32_t)v, 8);
+}
+
+/* *****************************************************************************
+ End of File
+ */
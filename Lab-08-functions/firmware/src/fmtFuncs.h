@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/** Fast fixed-format integer output
+
+  @File Name
+    fmtFuncs.h
+
+  @Summary
+    Appends strings, padded decimals and zero-padded hex to a buffer; the
+    test reports use it instead of snprintf.
+
+  @Description
+    The reports are mostly "%11ld; 0x%08lx" fields. snprintf parses the
+    format string on every call, goes through the generic conversion code
+    of the C library, and divides by 10 once per digit. The writers here
+    do only the conversion asked for:
+      - fmtDec() converts two digits per step with a 200-byte table of
+        the pairs "00" to "99", so a 10-digit value takes five divisions
+        by 100 (a multiply and a shift each on the M4)
+      - fmtHex() takes each nibble from a 16-byte table, with no branch
+        per digit
+      - padding is a fixed count worked out once, not a loop over flags
+    fmtDec(w, v, 11) writes exactly what "%11ld" writes, fmtHex(w, v, 8)
+    what "%08lx" writes, so a converted report is byte-identical to the
+    snprintf one.
+
+    Like snprintf, a writer never writes past its buffer: output that does
+    not fit is dropped, and fmtEnd() always leaves the text terminated.
+    Nothing here touches the hardware, so host tools can share it; the
+    benchmark mode (see benchFuncs.h) times it against snprintf.
+ */
+/* ************************************************************************** */
+
+#ifndef _FMT_FUNCS_H    /* Guard against multiple inclusion */
+#define _FMT_FUNCS_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+typedef struct _fmtWriter
+{
+    char *buf;
+    uint32_t cap;              // size of buf, including the terminator
+    uint32_t len;              // characters written so far
+} fmtWriter;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* start writing at buf, which holds cap bytes */
+void fmtBegin(fmtWriter *w, char *buf, uint32_t cap);
+
+    /* terminate the text; returns its length */
+uint32_t fmtEnd(fmtWriter *w);
+
+    /* %s */
+void fmtStr(fmtWriter *w, const char *s);
+
+    /* %*ld: v right-aligned in width characters */
+void fmtDec(fmtWriter *w, int32_t v, uint32_t width);
+
+    /* %*lu */
+void fmtUDec(fmtWriter *w, uint32_t v, uint32_t width);
+
+    /* %0*lx: v in lower case hex, zero-padded to digits (at most 8) */
+void fmtHex(fmtWriter *w, uint32_t v, uint32_t digits);
+
+    /* "%11ld; 0x%08lx", the value pair every report prints */
+void fmtDecHex(fmtWriter *w, int32_t v);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FMT_FUNCS_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,364 @@
+/* ************************************************************************** */
+/** Seeded property-based fuzzing of the asm functions
+
+  @File Name
+    fuzzFuncs.c
+
+  @Summary
+    Generates packed inputs from a seeded xorshift generator and checks the
+    asm functions against the reference and against algebraic properties.
+
+  @Description
+    See fuzzFuncs.h for the list of checks.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <string.h>
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "asmExterns.h"
+#include "testFuncs.h" // lab test structs
+#include "printFuncs.h"  // lab print funcs
+#include "fuzzFuncs.h"
+#include "shrinkFuncs.h"
+#include "testGuard.h"
+
+#define MAX_PRINT_LEN 600
+
+#define USING_HW 1
+
+/* make call under the guard as RESULT_MODE_FUZZ, in fuzzCheckPacked();
+ * leave it with just FUZZ_FAIL_GUARD if the call timed out or faulted */
+#define FUZZ_CALL(call)                                                 \
+    do                                                                  \
+    {                                                                   \
+        TEST_GUARD_CALL(*status, RESULT_MODE_FUZZ, packedValue, call);  \
+        if (*status != TEST_GUARD_OK)                                   \
+        {                                                               \
+            return FUZZ_FAIL_GUARD;                                     \
+        }                                                               \
+    } while (0)
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint8_t fuzzTxBuffer[MAX_PRINT_LEN] = {0};
+
+static const uint16_t fuzzEdgeLanes[] = { FUZZ_EDGE_LANES };
+
+/* names for the FUZZ_FAIL_xxx bits, lowest bit first */
+static const char * const fuzzFailNames[] = {
+    "UNPACK", "ABS", "MULT", "FIXSIGN", "MAIN", "COMMUTE", "SIGN", "ZERO",
+    "GUARD"
+};
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* one 16-bit lane: an edge value, a signed power of two, or random bits */
+static uint16_t fuzzLane(uint32_t *state)
+{
+    uint32_t r = fuzzNext(state);
+    uint16_t lane;
+
+    switch (r & 3)
+    {
+        case 0:
+            lane = fuzzEdgeLanes[(r >> 2) %
+                    (sizeof(fuzzEdgeLanes)/sizeof(fuzzEdgeLanes[0]))];
+            break;
+        case 1:
+            lane = (uint16_t)(1U << ((r >> 2) & 0xF));
+            if (r & 0x100)
+            {
+                lane = (uint16_t)(0 - lane);
+            }
+            break;
+        default:
+            lane = (uint16_t)(r >> 16);
+            break;
+    }
+    return lane;
+}
+
+/* write the names of the bits set in mask into buf, space separated */
+static void fuzzMaskNames(uint32_t mask, char *buf, size_t len)
+{
+    buf[0] = 0;
+    for (uint32_t bit = 0; bit < sizeof(fuzzFailNames)/sizeof(fuzzFailNames[0]); ++bit)
+    {
+        if (mask & (1UL << bit))
+        {
+            strncat(buf, fuzzFailNames[bit], len - strlen(buf) - 1);
+            strncat(buf, " ", len - strlen(buf) - 1);
+        }
+    }
+}
+
+
+/* shrink predicate: every check that failed for the original still fails */
+static bool fuzzStillFails(uint32_t packedValue, void *context,
+        testGuardStatus *status)
+{
+    uint32_t mask = *(const uint32_t *)context;
+    return (fuzzCheckPacked(packedValue, status) & mask) == mask;
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+uint32_t fuzzNext(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+uint32_t fuzzPackedValue(uint32_t *state)
+{
+    uint32_t a = fuzzLane(state);
+    uint32_t b = fuzzLane(state);
+    return (a << 16) | b;
+}
+
+uint32_t fuzzCheckPacked(uint32_t packedValue, testGuardStatus *status)
+{
+    expectedValues e;
+    uint32_t mask = 0;
+    int32_t a = 0;
+    int32_t b = 0;
+    int32_t absOut = 0;
+    int32_t signBit = 0;
+    int32_t r0 = 0;
+
+    calcExpectedValues(0, "", packedValue, &e);
+
+    // reference checks of each function on its own
+    FUZZ_CALL(asmUnpack(packedValue, &a, &b));
+    if (a != e.inputA || b != e.inputB)
+    {
+        mask |= FUZZ_FAIL_UNPACK;
+    }
+
+    FUZZ_CALL(r0 = asmAbs(e.inputA, &absOut, &signBit));
+    if (r0 != e.absA || absOut != e.absA || signBit != e.signA)
+    {
+        mask |= FUZZ_FAIL_ABS;
+    }
+    FUZZ_CALL(r0 = asmAbs(e.inputB, &absOut, &signBit));
+    if (r0 != e.absB || absOut != e.absB || signBit != e.signB)
+    {
+        mask |= FUZZ_FAIL_ABS;
+    }
+
+    int32_t initProduct = 0;
+    FUZZ_CALL(initProduct = asmMult(e.absA, e.absB));
+    if (initProduct != e.initProduct)
+    {
+        mask |= FUZZ_FAIL_MULT;
+    }
+    FUZZ_CALL(r0 = asmMult(e.absB, e.absA));
+    if (r0 != initProduct)
+    {
+        mask |= FUZZ_FAIL_COMMUTE;
+    }
+
+    FUZZ_CALL(r0 = asmFixSign(e.initProduct, e.signA, e.signB));
+    if (r0 != e.finalProduct)
+    {
+        mask |= FUZZ_FAIL_FIXSIGN;
+    }
+
+    int32_t finalProduct = 0;
+    FUZZ_CALL(finalProduct = asmMain(packedValue));
+    if (finalProduct != e.finalProduct)
+    {
+        mask |= FUZZ_FAIL_MAIN;
+    }
+
+    // properties of asmMain that do not depend on the reference
+    uint32_t swapped = (packedValue << 16) | (packedValue >> 16);
+    FUZZ_CALL(r0 = asmMain(swapped));
+    if (r0 != finalProduct)
+    {
+        mask |= FUZZ_FAIL_COMMUTE;
+    }
+
+    // -0x8000 does not fit in 16 bits, so there is nothing to compare against
+    if ((packedValue >> 16) != 0x8000)
+    {
+        uint32_t negA = ((uint32_t)(uint16_t)(0 - e.inputA) << 16) |
+                (packedValue & 0x0000FFFF);
+        FUZZ_CALL(r0 = asmMain(negA));
+        if (r0 != 0 - finalProduct)
+        {
+            mask |= FUZZ_FAIL_SIGN;
+        }
+    }
+
+    int32_t zeroA = 0;
+    int32_t zeroB = 0;
+    FUZZ_CALL(zeroA = asmMain(packedValue & 0x0000FFFF));
+    FUZZ_CALL(zeroB = asmMain(packedValue & 0xFFFF0000));
+    if (zeroA != 0 || zeroB != 0)
+    {
+        mask |= FUZZ_FAIL_ZERO;
+    }
+
+    return mask;
+}
+
+void runFuzz(uint32_t seed,
+        uint32_t numCases,
+        fuzzResult *r,
+        volatile bool *tick,
+        volatile bool *txComplete)
+{
+    uint32_t ticks = 0;
+    uint32_t casesAtLastProgress = 0;
+    char names[80];
+
+    if (seed == 0)
+    {
+#if USING_HW
+        // the RTC counter only spans 10 ms, so take the seed from the TRNG
+        MCLK_REGS->MCLK_APBCMASK |= MCLK_APBCMASK_TRNG_Msk;
+        TRNG_REGS->TRNG_CTRLA = TRNG_CTRLA_ENABLE_Msk;
+        while ((TRNG_REGS->TRNG_INTFLAG & TRNG_INTFLAG_DATARDY_Msk) == 0);
+        seed = TRNG_REGS->TRNG_DATA;
+        TRNG_REGS->TRNG_CTRLA = 0;
+#endif
+        if (seed == 0)
+        {
+            seed = 0x2545F491;  // xorshift must not start at 0
+        }
+    }
+    uint32_t state = seed;
+
+    r->seed = seed;
+    r->casesRun = 0;
+    r->failCount = 0;
+    r->firstFailInput = 0;
+    r->firstFailMask = 0;
+    r->firstFailShrunk = 0;
+    r->stopped = false;
+
+    snprintf((char*)fuzzTxBuffer, MAX_PRINT_LEN,
+            "========= FUZZ asm functions: %lu cases, seed 0x%08lx\r\n"
+            "(set fuzzSeed = 0x%08lx in main.c to reproduce this run)\r\n"
+            "\r\n",
+            numCases, seed, seed);
+    printAndWait((char*)fuzzTxBuffer, txComplete);
+    *tick = false;
+
+    for (uint32_t testCase = 0; testCase < numCases; ++testCase)
+    {
+        uint32_t packedValue = fuzzPackedValue(&state);
+        testGuardStatus status;
+        uint32_t mask = fuzzCheckPacked(packedValue, &status);
+        if (status != TEST_GUARD_OK)
+        {
+            testGuardPrintFailure(status, RESULT_MODE_FUZZ, packedValue,
+                    txComplete);
+            r->stopped = true;
+            break;
+        }
+        ++r->casesRun;
+
+        if (mask != 0)
+        {
+            if (r->failCount == 0)
+            {
+                r->firstFailInput = packedValue;
+                r->firstFailMask = mask;
+            }
+            ++r->failCount;
+
+            if (r->failCount <= FUZZ_MAX_PRINTED_FAILS)
+            {
+                fuzzMaskNames(mask, names, sizeof(names));
+                snprintf((char*)fuzzTxBuffer, MAX_PRINT_LEN,
+                        "FUZZ FAIL: seed 0x%08lx case %lu: packed 0x%08lx "
+                        "(A = %ld, B = %ld): %s\r\n",
+                        seed, testCase, packedValue,
+                        (int32_t)(int16_t)(packedValue >> 16),
+                        (int32_t)(int16_t)(packedValue & 0xFFFF),
+                        names);
+                printAndWait((char*)fuzzTxBuffer, txComplete);
+            }
+        }
+
+        if (*tick == true)
+        {
+            *tick = false;
+            if (++ticks >= FUZZ_PROGRESS_TICKS)
+            {
+                ticks = 0;
+                LED0_Toggle();
+                snprintf((char*)fuzzTxBuffer, MAX_PRINT_LEN,
+                        "fuzz progress: %lu of %lu cases; %lu failures; "
+                        "%lu cases in the last %d ms\r\n",
+                        r->casesRun, numCases, r->failCount,
+                        r->casesRun - casesAtLastProgress,
+                        FUZZ_PROGRESS_TICKS * 10);
+                printAndWait((char*)fuzzTxBuffer, txComplete);
+                casesAtLastProgress = r->casesRun;
+            }
+        }
+    }
+
+    fuzzMaskNames(r->firstFailMask, names, sizeof(names));
+    snprintf((char*)fuzzTxBuffer, MAX_PRINT_LEN,
+            "========= FUZZ %s: seed 0x%08lx\r\n"
+            "cases run:           %lu\r\n"
+            "failing cases:       %lu\r\n"
+            "first failure input: 0x%08lx %s\r\n"
+            "\r\n",
+            r->stopped == true ? "STOPPED" : "COMPLETE",
+            r->seed,
+            r->casesRun,
+            r->failCount,
+            r->firstFailInput, names);
+    printAndWait((char*)fuzzTxBuffer, txComplete);
+
+    if (r->failCount != 0)
+    {
+        shrinkResult shrink;
+        r->firstFailShrunk = shrinkPacked(r->firstFailInput, fuzzStillFails,
+                &r->firstFailMask, &shrink);
+        shrinkPrint("fuzz", &shrink, txComplete);
+        if (shrink.guardStatus != TEST_GUARD_OK)
+        {
+            testGuardPrintFailure(shrink.guardStatus, RESULT_MODE_FUZZ,
+                    shrink.guardInput, txComplete);
+        }
+    }
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/** Seeded property-based fuzzing of the asm functions
+
+  @File Name
+    fuzzFuncs.h
+
+  @Summary
+    Generates packed inputs from a seeded xorshift generator and checks the
+    asm functions against the reference and against algebraic properties.
+
+  @Description
+    Each lane of a generated packed value is either drawn from a table of
+    edge values (0, +/-1, 0x7FFF, 0x8000, powers of two, ...) or is plain
+    random. Every case is checked against calcExpectedValues() and against
+    properties that must hold for any correct multiply:
+      - commutativity:  asmMain(a:b) == asmMain(b:a), asmMult(x,y) == asmMult(y,x)
+      - sign symmetry:  asmMain(-a:b) == -asmMain(a:b)
+      - zero identity:  asmMain(0:b) == asmMain(a:0) == 0
+    The run prints its seed first, so any failure can be reproduced exactly
+    by setting fuzzSeed in main.c to that value. The first failing case is
+    shrunk (see shrinkFuncs.h) to the simplest input that fails the same
+    checks. The fuzz mode always uses
+    turbo pacing: it never waits for the 10 ms RTC tick between cases.
+
+    Every call is guarded (testGuard.h) as RESULT_MODE_FUZZ with the
+    packed value as the test case. The run stops at the first call that
+    times out or faults and prints that value.
+ */
+/* ************************************************************************** */
+
+#ifndef _FUZZ_FUNCS_H    /* Guard against multiple inclusion */
+#define _FUZZ_FUNCS_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "testGuard.h"
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* bits of the failure mask returned by fuzzCheckPacked() */
+#define FUZZ_FAIL_UNPACK    (1UL << 0)  // asmUnpack disagrees with the reference
+#define FUZZ_FAIL_ABS       (1UL << 1)  // asmAbs disagrees with the reference
+#define FUZZ_FAIL_MULT      (1UL << 2)  // asmMult disagrees with the reference
+#define FUZZ_FAIL_FIXSIGN   (1UL << 3)  // asmFixSign disagrees with the reference
+#define FUZZ_FAIL_MAIN      (1UL << 4)  // asmMain disagrees with the reference
+#define FUZZ_FAIL_COMMUTE   (1UL << 5)  // swapping operands changed the product
+#define FUZZ_FAIL_SIGN      (1UL << 6)  // negating A did not negate the product
+#define FUZZ_FAIL_ZERO      (1UL << 7)  // a zero operand gave a nonzero product
+#define FUZZ_FAIL_GUARD     (1UL << 8)  // a call timed out or faulted; the
+                                        // other bits were not checked
+
+    /* only this many failing cases are printed in detail per run */
+#define FUZZ_MAX_PRINTED_FAILS 10
+
+    /* Progress is printed after this many RTC ticks (10 ms each) */
+#define FUZZ_PROGRESS_TICKS 300
+
+    /* 16-bit lane values that tend to break multiply and sign handling
+     * code; the initializer of fuzzEdgeLanes in fuzzFuncs.c, and of
+     * ../host/asmFuzz.cpp's mutations */
+#define FUZZ_EDGE_LANES                                 \
+    0x0000, 0x0001, 0xFFFF,  /* 0, +1, -1 */            \
+    0x0002, 0xFFFE,          /* +2, -2 */               \
+    0x7FFF, 0x7FFE,          /* MAX, MAX-1 */           \
+    0x8000, 0x8001,          /* MIN, MIN+1 */           \
+    0x00FF, 0x0100, 0xFF00,  /* byte boundaries */      \
+    0x5555, 0xAAAA           /* alternating bits */
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+typedef struct _fuzzResult
+{
+    uint32_t seed;             // generator seed actually used for the run
+    uint32_t casesRun;         // number of generated cases checked
+    uint32_t failCount;        // number of cases with a nonzero failure mask
+    uint32_t firstFailInput;   // first failing packed value, if any
+    uint32_t firstFailMask;    // FUZZ_FAIL_xxx bits for that case
+    uint32_t firstFailShrunk;  // simplest input with those bits still failing
+    bool stopped;              // a call timed out or faulted on the case
+                               // after the casesRun checked
+} fuzzResult;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* advance an xorshift32 state and return the new value. state must be nonzero */
+uint32_t fuzzNext(uint32_t *state);
+
+    /* generate one packed test value, biased toward edge values in each lane */
+uint32_t fuzzPackedValue(uint32_t *state);
+
+    /* run every check on one packed value, each call guarded as
+     * RESULT_MODE_FUZZ; returns a mask of FUZZ_FAIL_xxx bits and sets
+     * status to how the last call ended */
+uint32_t fuzzCheckPacked(uint32_t packedValue, testGuardStatus *status);
+
+    /**
+      @Function
+        void runFuzz(uint32_t seed, uint32_t numCases, fuzzResult *r,
+                     volatile bool *tick, volatile bool *txComplete)
+
+      @Summary
+        Generates numCases packed values from seed and checks each one.
+
+      @Parameters
+        @param seed  generator seed. 0 picks a seed from the TRNG;
+                     either way the seed used is printed and stored in r.
+        @param tick  flag set by the RTC callback every 10 ms; used only to
+                     pace the progress output
+     */
+void runFuzz(uint32_t seed,
+        uint32_t numCases,
+        fuzzResult *r,
+        volatile bool *tick,
+        volatile bool *txComplete);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FUZZ_FUNCS_H */
+
+/* *****************************************************************************
+ End of File
+ */
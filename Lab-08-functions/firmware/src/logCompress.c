@@ -0,0 +1,286 @@
+/* ************************************************************************** */
+/** Streaming compression of the UART output
+
+  @File Name
+    logCompress.c
+
+  @Summary
+    A small-window LZ77 coder that printQueue.c runs over everything it
+    sends; host/logInflate.cpp turns the stream back into text.
+
+  @Description
+    See logCompress.h. This file is also built into host/logInflate.cpp,
+    so it must not include definitions.h or anything else from the board.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "logCompress.h"
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* decoder states: what the next byte is */
+enum
+{
+    LOG_COMPRESS_TOKEN = 0,
+    LOG_COMPRESS_LITERAL,
+    LOG_COMPRESS_OFFSET,
+    LOG_COMPRESS_EXTRA
+};
+
+/* the longest copy the 4 length bits give */
+#define LOG_COMPRESS_SHORT_MATCH (LOG_COMPRESS_MIN_MATCH + 14)
+
+/* decoded bytes gathered before each call of the sink */
+#define LOG_COMPRESS_SINK_LEN 256
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint32_t logCompressHash(const uint8_t *p)
+{
+    uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    return (v * 2654435761u) >> (32 - LOG_COMPRESS_HASH_BITS);
+}
+
+/* literal tokens for n bytes; returns the bytes written */
+static uint32_t logCompressLiterals(const uint8_t *in, uint32_t n,
+        uint8_t *out)
+{
+    uint32_t o = 0;
+    while (n > 0)
+    {
+        uint32_t run = n < 128 ? n : 128;
+        out[o++] = (uint8_t)(run - 1);
+        memcpy(&out[o], in, run);
+        o += run;
+        in += run;
+        n -= run;
+    }
+    return o;
+}
+
+/* append one decoded byte to the window and the pending output */
+static void logCompressPut(logCompressDecoder *d, uint8_t b, uint8_t *pend,
+        uint32_t *numPend, logCompressSink sink, void *ctx)
+{
+    d->window[d->total % LOG_COMPRESS_WINDOW] = b;
+    ++d->total;
+    pend[(*numPend)++] = b;
+    if (*numPend == LOG_COMPRESS_SINK_LEN)
+    {
+        sink(ctx, pend, *numPend);
+        *numPend = 0;
+    }
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void logCompressEncoderInit(logCompressEncoder *e)
+{
+    memset(e->head, 0, sizeof(e->head));
+    e->total = 0;
+}
+
+uint32_t logCompressEncode(logCompressEncoder *e, const uint8_t *in,
+        uint32_t len, uint8_t *out)
+{
+    const uint32_t base = e->total;
+    uint32_t o = 0;
+    uint32_t i = 0;
+    uint32_t literalStart = 0;
+
+    if (len > LOG_COMPRESS_MAX_INPUT)
+    {
+        len = LOG_COMPRESS_MAX_INPUT;
+    }
+
+    while (i < len)
+    {
+        uint32_t matchLen = 0;
+        uint32_t dist = 0;
+
+        if (i + LOG_COMPRESS_MIN_MATCH <= len)
+        {
+            uint32_t h = logCompressHash(&in[i]);
+            uint32_t pos = base + i;
+            // the table keeps 16 bits; a stale entry only costs a compare
+            dist = (pos - e->head[h]) & 0xFFFF;
+            e->head[h] = (uint16_t)pos;
+
+            if (dist >= 1 && dist <= LOG_COMPRESS_WINDOW && dist <= pos)
+            {
+                uint32_t from = pos - dist;
+                uint32_t max = len - i;
+                if (max > LOG_COMPRESS_MAX_MATCH)
+                {
+                    max = LOG_COMPRESS_MAX_MATCH;
+                }
+                // bytes from this call are in in[], older ones in the
+                // window, which is only updated at the end
+                while (matchLen < max)
+                {
+                    uint32_t q = from + matchLen;
+                    uint8_t b = q >= base ? in[q - base] :
+                            e->window[q % LOG_COMPRESS_WINDOW];
+                    if (b != in[i + matchLen])
+                    {
+                        break;
+                    }
+                    ++matchLen;
+                }
+            }
+        }
+
+        if (matchLen < LOG_COMPRESS_MIN_MATCH)
+        {
+            ++i;
+            continue;
+        }
+
+        o += logCompressLiterals(&in[literalStart], i - literalStart, &out[o]);
+
+        uint32_t offset = dist - 1;
+        if (matchLen <= LOG_COMPRESS_SHORT_MATCH)
+        {
+            out[o++] = (uint8_t)(0x80 |
+                    ((matchLen - LOG_COMPRESS_MIN_MATCH) << 3) | (offset >> 8));
+            out[o++] = (uint8_t)offset;
+        }
+        else
+        {
+            out[o++] = (uint8_t)(0xF8 | (offset >> 8));
+            out[o++] = (uint8_t)offset;
+            out[o++] = (uint8_t)(matchLen - LOG_COMPRESS_SHORT_MATCH - 1);
+        }
+
+        // the strings starting inside the copy are candidates too
+        for (uint32_t k = i + 1; k < i + matchLen &&
+                k + LOG_COMPRESS_MIN_MATCH <= len; ++k)
+        {
+            e->head[logCompressHash(&in[k])] = (uint16_t)(base + k);
+        }
+        i += matchLen;
+        literalStart = i;
+    }
+    o += logCompressLiterals(&in[literalStart], len - literalStart, &out[o]);
+
+    // len is at most the window, so this wraps at most once
+    uint32_t start = base % LOG_COMPRESS_WINDOW;
+    uint32_t first = LOG_COMPRESS_WINDOW - start;
+    if (first > len)
+    {
+        first = len;
+    }
+    memcpy(&e->window[start], in, first);
+    memcpy(&e->window[0], in + first, len - first);
+    e->total = base + len;
+
+    return o;
+}
+
+void logCompressDecoderInit(logCompressDecoder *d)
+{
+    d->total = 0;
+    d->state = LOG_COMPRESS_TOKEN;
+    d->token = 0;
+    d->count = 0;
+}
+
+bool logCompressDecode(logCompressDecoder *d, const uint8_t *in, uint32_t len,
+        logCompressSink sink, void *ctx)
+{
+    uint8_t pend[LOG_COMPRESS_SINK_LEN];
+    uint32_t numPend = 0;
+    bool ok = true;
+
+    for (uint32_t i = 0; i < len; ++i)
+    {
+        uint8_t b = in[i];
+        uint32_t copy = 0;
+
+        switch (d->state)
+        {
+        case LOG_COMPRESS_TOKEN:
+            d->token = b;
+            if (b < 0x80)
+            {
+                d->count = (uint16_t)(b + 1);
+                d->state = LOG_COMPRESS_LITERAL;
+            }
+            else
+            {
+                d->state = LOG_COMPRESS_OFFSET;
+            }
+            break;
+        case LOG_COMPRESS_LITERAL:
+            logCompressPut(d, b, pend, &numPend, sink, ctx);
+            if (--d->count == 0)
+            {
+                d->state = LOG_COMPRESS_TOKEN;
+            }
+            break;
+        case LOG_COMPRESS_OFFSET:
+            // keep the offset where the length bits were; the length is
+            // known from the token or the next byte
+            d->count = (uint16_t)((((uint32_t)d->token & 0x07) << 8) | b);
+            copy = ((d->token >> 3) & 0x0F) + LOG_COMPRESS_MIN_MATCH;
+            if (copy > LOG_COMPRESS_SHORT_MATCH)
+            {
+                d->state = LOG_COMPRESS_EXTRA;
+                copy = 0;
+            }
+            break;
+        default:    // LOG_COMPRESS_EXTRA
+            copy = LOG_COMPRESS_SHORT_MATCH + 1 + b;
+            break;
+        }
+
+        if (copy > 0)
+        {
+            uint32_t dist = (uint32_t)d->count + 1;
+            d->state = LOG_COMPRESS_TOKEN;
+            if (dist > d->total)
+            {
+                logCompressDecoderInit(d);
+                ok = false;
+                break;
+            }
+            for (uint32_t k = 0; k < copy; ++k)
+            {
+                logCompressPut(d, d->window[(d->total - dist) %
+                        LOG_COMPRESS_WINDOW], pend, &numPend, sink, ctx);
+            }
+        }
+    }
+
+    if (numPend > 0)
+    {
+        sink(ctx, pend, numPend);
+    }
+    return ok;
+}
+
+/* *****************************************************************************
+ End of File
+ */
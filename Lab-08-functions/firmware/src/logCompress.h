@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/** Streaming compression of the UART output
+
+  @File Name
+    logCompress.h
+
+  @Summary
+    A small-window LZ77 coder that printQueue.c runs over everything it
+    sends; host/logInflate.cpp turns the stream back into text.
+
+  @Description
+    The reports repeat themselves: the same banners, the same labels and
+    mostly the same digits in every test case. Built with
+    -DLOG_COMPRESS_ENABLE=1, printQueue.c passes each message through
+    logCompressEncode() before it queues it, so the link carries a few
+    times the text it otherwise could.
+
+    The stream is a sequence of tokens, each a whole number of bytes:
+
+        0LLLLLLL  L+1 bytes       L+1 literal bytes (1 to 128)
+        1LLLLOOO  OOOOOOOO        copy L+3 bytes (3 to 17) from O+1 bytes
+                                  back (1 to LOG_COMPRESS_WINDOW)
+        11111OOO  OOOOOOOO  E     the same, copying E+18 bytes (18 to 273)
+
+    A copy may overlap the bytes it produces, as in any LZ77. Since no
+    token spans two calls, whatever has been queued decodes completely;
+    nothing waits in the coder for more input. Matches do reach back into
+    earlier messages, which is where most of the gain comes from.
+
+    The encoder keeps the last LOG_COMPRESS_WINDOW bytes and a hash table
+    of where each 3-byte string last started, and takes the one candidate
+    the table gives if it matches (greedy, no chains): about 4 KB of RAM
+    and a few cycles per byte.
+
+    printQueueInit() sends LOG_COMPRESS_MARKER as plain text before the
+    first token, so logInflate.cpp can pass the board's earlier output
+    (the baud rate handshake) through and know where the stream starts.
+    A board reset starts a new stream, which the host cannot see inside
+    the old one: restart logInflate with the board.
+
+    The default, 0, sends plain text.
+ */
+/* ************************************************************************** */
+
+#ifndef _LOG_COMPRESS_H    /* Guard against multiple inclusion */
+#define _LOG_COMPRESS_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+#ifndef LOG_COMPRESS_ENABLE
+#define LOG_COMPRESS_ENABLE 0
+#endif
+
+    /* How far back a copy reaches; set by the 11 offset bits */
+#define LOG_COMPRESS_WINDOW 2048
+
+    /* Shortest and longest copy */
+#define LOG_COMPRESS_MIN_MATCH 3
+#define LOG_COMPRESS_MAX_MATCH 273
+
+    /* Hash table of 2^LOG_COMPRESS_HASH_BITS entries */
+#define LOG_COMPRESS_HASH_BITS 10
+
+    /* Most bytes one logCompressEncode() call takes; not above
+     * LOG_COMPRESS_WINDOW */
+#define LOG_COMPRESS_MAX_INPUT 512
+
+    /* Most bytes logCompressEncode() makes of len: all literals */
+#define LOG_COMPRESS_BOUND(len) ((len) + ((len) + 127) / 128)
+
+    /* The plain text line that starts a stream */
+#define LOG_COMPRESS_MARKER "#LZ77 2048\r\n"
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+typedef struct _logCompressEncoder
+{
+    uint8_t window[LOG_COMPRESS_WINDOW];    // byte n at n % WINDOW
+    uint16_t head[1 << LOG_COMPRESS_HASH_BITS]; // low 16 bits of a position
+    uint32_t total;                         // bytes taken so far
+} logCompressEncoder;
+
+typedef struct _logCompressDecoder
+{
+    uint8_t window[LOG_COMPRESS_WINDOW];
+    uint32_t total;                         // bytes produced so far
+    uint8_t state;
+    uint8_t token;
+    uint16_t count;                         // literals still to come
+} logCompressDecoder;
+
+    /* receives decoded bytes */
+typedef void (*logCompressSink)(void *ctx, const uint8_t *bytes, uint32_t len);
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* start a new stream */
+void logCompressEncoderInit(logCompressEncoder *e);
+
+    /**
+      @Function
+        uint32_t logCompressEncode(logCompressEncoder *e, const uint8_t *in,
+                uint32_t len, uint8_t *out)
+
+      @Summary
+        Codes len bytes of in, at most LOG_COMPRESS_MAX_INPUT, into out and
+        returns how many bytes that took.
+
+      @Remarks
+        out must have room for LOG_COMPRESS_BOUND(len) bytes. The bytes
+        out holds decode on their own, given everything coded before.
+     */
+uint32_t logCompressEncode(logCompressEncoder *e, const uint8_t *in,
+        uint32_t len, uint8_t *out);
+
+    /* start reading a new stream */
+void logCompressDecoderInit(logCompressDecoder *d);
+
+    /* decode len bytes of a stream, in any pieces, and pass what they make
+     * to sink. Returns false, and starts over, on a copy from before the
+     * start of the stream: the input is not a stream or not its start. */
+bool logCompressDecode(logCompressDecoder *d, const uint8_t *in, uint32_t len,
+        logCompressSink sink, void *ctx);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LOG_COMPRESS_H */
+
+/* *****************************************************************************
+ End of File
+ */
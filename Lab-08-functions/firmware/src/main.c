@@ -43,6 +43,21 @@
 #include "asmExterns.h"
 #include "testFuncs.h" // lab test structs
 #include "printFuncs.h"  // lab print funcs
+#include "printQueue.h"   // non-blocking DMA output queue
+#include "fmtFuncs.h"     // snprintf-free report formatting
+#include "sweepFuncs.h"  // exhaustive asmMain sweep
+#include "fuzzFuncs.h"   // seeded property-based fuzzing
+#include "testVectors.h" // test cases and their expected values
+#include "resultStore.h" // cross-boot regression record
+#include "testSchedule.h" // failure-history test ordering
+#include "testGuard.h"    // per-call timeout and fault recovery
+#include "faultCapture.h" // fault records kept across a reset
+#include "sandbox.h"      // MPU sandbox for the calls under test
+#include "aapcsCheck.h"   // callee-saved register and stack use check
+#include "benchFuncs.h"   // DWT cycle benchmark of each function
+#include "diffFuncs.h"    // multiply engines checked against each other
+#include "uartPort.h"     // baud rate handshake with the host
+#include "console.h"      // serial commands that change the settings
 
 // Define the global that gives access to the student's name
 extern uint32_t nameStrPtr;
@@ -56,6 +71,91 @@ bool doAsmMainTest = true;
 
 bool onlyPrintFails = true; // set this to false to see passing test cases, too
 
+// set to true to skip the 10ms wait between test cases
+bool turboPacing = false;
+
+// set to true to stop each group at its first failing test case. Cases that
+// failed most recently always run first, so with failFast set the first
+// failure is printed almost immediately. failFast also turns on turboPacing.
+bool failFast = false;
+
+// set to false to run the asm functions privileged with the MPU off. When
+// true, a store outside the stack and the asm output variables is reported
+// as a FAULT with the address it tried to write.
+bool useSandbox = true;
+
+// set to true to run every packed input in the range below through asmMain
+// after the normal tests. The full 32-bit range takes about an hour.
+bool doExhaustiveSweep = false;
+uint32_t sweepFirstInput = 0x00000000;
+uint32_t sweepLastInput  = 0xFFFFFFFF;
+
+// set to true to fuzz the asm functions with generated inputs after the
+// normal tests. A seed of 0 picks a random seed each run; the seed used is
+// printed so that a failing run can be repeated by pasting it here.
+// Fuzzing always runs at turbo pacing.
+bool doFuzzTest = false;
+uint32_t fuzzSeed = 0;
+uint32_t fuzzCaseCount = 1000000;
+
+// set to true to time each asm function with the cycle counter after the
+// normal tests, and print min/median/p99/max cycles per call. Functions whose
+// tests did not all pass are skipped. benchInputs can be
+// BENCH_INPUTS_TEST_VECTORS (the tc[] cases) or BENCH_INPUTS_RANDOM
+// (benchRandomCount inputs generated from benchSeed).
+bool doBenchmark = false;
+benchInputSet benchInputs = BENCH_INPUTS_TEST_VECTORS;
+uint32_t benchRandomCount = 256;
+uint32_t benchSeed = 1;
+uint32_t benchWarmup = 4;
+uint32_t benchIterations = 16;
+
+// set to true to run asmMult, asmMain and the other multiply engines listed
+// in diffFuncs.c on the same generated inputs after the normal tests, and
+// print where each first differs from the hardware multiply.
+bool doDifferential = false;
+uint32_t diffSeed = 0;
+uint32_t diffCaseCount = 1000000;
+uint32_t diffEngineMask = 0xFFFFFFFF;  // bit e runs diffEngines[e]
+
+// what the serial console (console.h) may change between runs. Type "help"
+// in the terminal for the commands, "run" to start a run with the changes.
+static const consoleFlag consoleFlags[] = {
+    { "unpack",   &doUnpackTest },
+    { "abs",      &doAbsTest },
+    { "mult",     &doMultTest },
+    { "fixsign",  &doFixSignTest },
+    { "main",     &doAsmMainTest },
+    { "fails",    &onlyPrintFails },
+    { "turbo",    &turboPacing },
+    { "failfast", &failFast },
+    { "sandbox",  &useSandbox },
+    { "sweep",    &doExhaustiveSweep },
+    { "fuzz",     &doFuzzTest },
+    { "bench",    &doBenchmark },
+    { "diff",     &doDifferential }
+};
+static const consoleNumber consoleNumbers[] = {
+    { "fuzzseed",        &fuzzSeed },
+    { "fuzzcount",       &fuzzCaseCount },
+    { "diffseed",        &diffSeed },
+    { "diffcount",       &diffCaseCount },
+    { "sweepfirst",      &sweepFirstInput },
+    { "sweeplast",       &sweepLastInput },
+    { "benchcount",      &benchRandomCount },
+    { "benchseed",       &benchSeed },
+    { "benchwarmup",     &benchWarmup },
+    { "benchiterations", &benchIterations }
+};
+static const consoleConfig consoleSettings = {
+    .flags = consoleFlags,
+    .numFlags = sizeof(consoleFlags) / sizeof(consoleFlags[0]),
+    .numbers = consoleNumbers,
+    .numNumbers = sizeof(consoleNumbers) / sizeof(consoleNumbers[0]),
+    .benchInputs = &benchInputs,
+    .diffEngineMask = &diffEngineMask
+};
+
 /* RTC Time period match values for input clock of 1 KHz */
 #define PERIOD_10MS                             10
 #define PERIOD_100MS                            102
@@ -69,49 +169,28 @@ bool onlyPrintFails = true; // set this to false to see passing test cases, too
 static volatile bool isRTCExpired = false;
 static volatile bool changeTempSamplingRate = false;
 static volatile bool isUSARTTxComplete = true;
-static uint8_t uartTxBuffer[MAX_PRINT_LEN] = {0};
-
-
-
-// the following array defines pairs of {balance, transaction} values
-// tc stands for test case
-static int32_t tc[] = {
-    0x00020003,
-    0xFFFC0003,  // -,+
-    0,  // 0,0
-    0x00000005,  // 0,+
-    0x0000FFFC,  // 0,-
-    0xFFFD0000,  // -,0
-    0x00020000,  // +,0
-    0x80008000,  // -,-
-    0xFFF3FFE0,  // -,-
-    0x7FF38001,  // +,-
-    0x7FF17FF2   // +,+
+// the print queue buffer being formatted into; each message takes a fresh
+// one, which the DMA sends in place while the next is formatted
+static uint8_t *uartTxBuffer = NULL;
+
+
+
+// the following array defines pairs of {multiplicand, multiplier} values
+// tc stands for test case. The values themselves are listed in
+// testVectors.h; add new test cases there.
+static const int32_t tc[] = {
+    TEST_VECTORS(TV_PACKED_ENTRY)
+};
+
+// expected values for each entry of tc[], computed by the compiler and
+// stored in flash. tcExpected[i] holds the expected values for tc[i].
+static const expectedValues tcExpected[] = {
+    TEST_VECTORS(TV_EXPECTED_ENTRY)
 };
 
 // static char * pass = "PASS";
 // static char * fail = "FAIL";
 
-// VB COMMENT:
-// The ARM calling convention permits the use of up to 4 registers, r0-r3
-// to pass data into a function. Only one value can be returned to the 
-// C caller. The assembly language routine stores the return value
-// in r0. The C compiler will automatically use it as the function's return
-// value.
-//
-/* These functions will be implemented by students in asmMult.s */
-/* asmUnpack: no return value */
-extern void asmUnpack(uint32_t packedValue, int32_t* a, int32_t* b);
-/* asmAbs: return abs value. Also store abs value at location absOut,
- * and sign bit at location signBit. Must b 0 for +, 1 for negative */
-extern int32_t asmAbs(int32_t input, int32_t *absOut, int32_t *signBit);
-/* return product of two positive integers guaranteed to be <= 2^16 */
-extern int32_t asmMult(int32_t a, int32_t b);
-/* return corrected product based on signs of two original input values */
-extern int32_t asmFixSign(int32_t initProduct, int32_t signBitA, int32_t signBitB);
-/* Executes student's asmMain() function that ties together all of the above */
-extern int32_t asmMain(uint32_t packedValue);
-
 #if 0
 extern int32_t a_Multiplicand;
 extern int32_t b_Multiplier;
@@ -136,13 +215,7 @@ static void rtcEventHandler (RTC_TIMER32_INT_MASK intCause, uintptr_t context)
     if (intCause & RTC_MODE0_INTENSET_CMP0_Msk)
     {            
         isRTCExpired    = true;
-    }
-}
-static void usartDmaChannelHandler(DMAC_TRANSFER_EVENT event, uintptr_t contextHandle)
-{
-    if (event == DMAC_TRANSFER_EVENT_COMPLETE)
-    {
-        isUSARTTxComplete = true;
+        testGuardTick();
     }
 }
 #endif
@@ -161,26 +234,49 @@ int main ( void )
 #if USING_HW
     /* Initialize all modules */
     SYS_Initialize ( NULL );
-    DMAC_ChannelCallbackRegister(DMAC_CHANNEL_0, usartDmaChannelHandler, 0);
+    uartPortNegotiate();    // before the print queue starts sending
+    printQueueInit();   // takes the DMAC channel 0 callback
+    consoleInit(&consoleSettings);  // RX DMA, once the handshake is done with RX
     RTC_Timer32CallbackRegister(rtcEventHandler, 0);
     RTC_Timer32Compare0Set(PERIOD_10MS);
     RTC_Timer32CounterSet(0);
     RTC_Timer32Start();
 #else // using the simulator
+    printQueueInit();
+    consoleInit(&consoleSettings);
     isRTCExpired = true;
     isUSARTTxComplete = true;
 #endif //SIMULATOR
     
+    uartTxBuffer = (uint8_t *)printQueueBufferGet();
     printGlobalAddresses((char *)uartTxBuffer, &isUSARTTxComplete);
 
     // initialize all the variables
     int32_t passCount = 0;
     int32_t failCount = 0;
+    fmtWriter fmt;      // builds the summaries in uartTxBuffer
     // int32_t x1 = sizeof(tc);
     // int32_t x2 = sizeof(tc[0]);
     uint32_t numTestCases = sizeof(tc)/sizeof(tc[0]);
     
-    static expectedValues exp;
+    const expectedValues *exp = &tcExpected[0];
+
+    // results of the last full run before this boot, and of this run
+    static resultRecord lastBootResults;
+    static resultRecord thisRunResults;
+    bool haveLastBootResults = resultStoreLoad(&lastBootResults);
+    testScheduleInit();
+    faultInit();
+    if (failFast == true)
+    {
+        turboPacing = true;
+    }
+    resultStoreInit(&thisRunResults, tc, numTestCases);
+    uint32_t cycles = 0;
+    testGuardStatus callStatus = TEST_GUARD_OK;
+    testGuardInit();
+    sandboxInit(useSandbox);
+    aapcsCheckInit();
 
     // Loop forever
     while ( true )
@@ -193,20 +289,22 @@ int main ( void )
         if (doUnpackTest == true)
         {
 
-            for (int testCase = 0; testCase < numTestCases; ++testCase)
+            testScheduleOrder(RESULT_UNPACK);
+            for (int position = 0; position < numTestCases; ++position)
             {
+                // run previously failing cases first
+                int testCase = testScheduleCase(position);
+
                 // Toggle the LED to show we're running a new test case
                 LED0_Toggle();
 
-                // reset the state variables for the timer and serial port funcs
+                // reset the state variable for the timer
                 isRTCExpired = false;
-                isUSARTTxComplete = false;
                 passCount = 0;
                 failCount = 0;
                 
-                // Get the packed value for this test case 
-                int32_t packedValue = tc[testCase];  // multiplicand and multiplier
-                calcExpectedValues(testCase,"",packedValue,&exp);
+                // Look up the expected values for this test case
+                exp = &tcExpected[testCase];
                 
                 int32_t unpackedA = 0;
                 int32_t unpackedB = 0;
@@ -214,44 +312,77 @@ int main ( void )
                 // !!!! THIS IS WHERE YOUR ASSEMBLY LANGUAGE PROGRAM GETS CALLED!!!!
                 // Call our assembly function defined in file asmMult.s
                 // Send in the test case value, see if the results are correct
-                asmUnpack(exp.packedVal, &unpackedA, &unpackedB);
+                aapcsPrepare(RESULT_UNPACK, (aapcsFunc)asmUnpack,
+                        exp->packedVal, (uint32_t)&unpackedA,
+                        (uint32_t)&unpackedB, 0);
+                AAPCS_GUARD_CALL(callStatus, RESULT_UNPACK, testCase,
+                        aapcsCall());
+                cycles = callStatus == TEST_GUARD_OK ? aapcsLastCycles() : 0;
                 
-                testAsmUnpack(testCase,
-                        "",
-                        exp.packedVal, // inputs
-                        &unpackedA,     // outputs
-                        &unpackedB,
-                        exp.inputA,    // expected values
-                        exp.inputB,
-                        &passCount,
-                        &failCount,
-                        onlyPrintFails,
-                        &isUSARTTxComplete
-                        );
+                if (callStatus != TEST_GUARD_OK)
+                {
+                    testGuardPrintFailure(callStatus, RESULT_UNPACK, testCase,
+                            &isUSARTTxComplete);
+                    failCount = TV_UNPACK_FIELDS;
+                }
+                else
+                {
+                    testAsmUnpack(testCase,
+                            "",
+                            exp->packedVal, // inputs
+                            &unpackedA,     // outputs
+                            &unpackedB,
+                            exp->inputA,    // expected values
+                            exp->inputB,
+                            &passCount,
+                            &failCount,
+                            onlyPrintFails,
+                            &isUSARTTxComplete
+                            );
+                    aapcsCheckCase(RESULT_UNPACK, testCase,
+                            &isUSARTTxComplete);
+                }
+                resultStoreAddCase(&thisRunResults, RESULT_UNPACK, testCase,
+                        failCount, cycles);
                 // print summary of tests executed so far
                 unpackTotalPassCount = unpackTotalPassCount + passCount;
                 unpackTotalFailCount = unpackTotalFailCount + failCount;
                 unpackTotalTests = unpackTotalPassCount + unpackTotalFailCount;
 
-                isUSARTTxComplete = false;
-                snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                        "========= asmUnpack In-progress test summary:\r\n"
-                        "%ld of %ld tests passed so far...\r\n"
-                        "\r\n",
-                        unpackTotalPassCount, unpackTotalTests); 
+                uartTxBuffer = (uint8_t *)printQueueBufferGet();
+                fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+                fmtStr(&fmt, "========= asmUnpack In-progress test summary:\r\n");
+                fmtDec(&fmt, unpackTotalPassCount, 0);
+                fmtStr(&fmt, " of ");
+                fmtDec(&fmt, unpackTotalTests, 0);
+                fmtStr(&fmt, " tests passed so far...\r\n"
+                        "\r\n");
+                fmtEnd(&fmt);
                 
                 printAndWait((char*)uartTxBuffer,&isUSARTTxComplete);
 
+                testScheduleRecord(RESULT_UNPACK, testCase, failCount);
+                if (failFast == true && failCount != 0)
+                {
+                    testSchedulePrintStop(RESULT_UNPACK, testCase, position + 1,
+                            &isUSARTTxComplete);
+                    break;
+                }
+
                 // spin here until the LED toggle timer has expired. This allows
                 // the test cases to be spread out in time.
-                while (isRTCExpired == false);
+                while (isRTCExpired == false && turboPacing == false);
             } // end: loop on all test cases for asmUnpack
-            isUSARTTxComplete = false;
-            snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                    "========= asmUnpack TESTS COMPLETE: \r\n"
-                    "Summary of tests: %ld of %ld tests passed\r\n"
-                    "\r\n",
-                    unpackTotalPassCount, unpackTotalTests); 
+            uartTxBuffer = (uint8_t *)printQueueBufferGet();
+            fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+            fmtStr(&fmt, "========= asmUnpack TESTS COMPLETE: \r\n"
+                    "Summary of tests: ");
+            fmtDec(&fmt, unpackTotalPassCount, 0);
+            fmtStr(&fmt, " of ");
+            fmtDec(&fmt, unpackTotalTests, 0);
+            fmtStr(&fmt, " tests passed\r\n"
+                    "\r\n");
+            fmtEnd(&fmt);
             printAndWait((char*)uartTxBuffer,&isUSARTTxComplete);
 
             // STUDENTS: put a breakpoint at the next instruction to see the 
@@ -266,21 +397,23 @@ int main ( void )
         if (doAbsTest == true)
         {
             // Do the tests for asmAbs
-            for (int testCase = 0; testCase < numTestCases; ++testCase)
+            testScheduleOrder(RESULT_ABS);
+            for (int position = 0; position < numTestCases; ++position)
             {
+                // run previously failing cases first
+                int testCase = testScheduleCase(position);
+
                 // Toggle the LED to show we're running a new test case
                 LED0_Toggle();
 
-                // reset the state variables for the timer and serial port funcs
+                // reset the state variable for the timer
                 isRTCExpired = false;
-                isUSARTTxComplete = false;
 
                 passCount = 0;
                 failCount = 0;
                 
-                // Get the packed value for this test case 
-                int32_t packedValue = tc[testCase];  // multiplicand and multiplier
-                calcExpectedValues(testCase,"",packedValue,&exp);
+                // Look up the expected values for this test case
+                exp = &tcExpected[testCase];
                 
                 int32_t absA = 0;
                 int32_t absB = 0;
@@ -288,70 +421,125 @@ int main ( void )
                 int32_t signBitB = 0;
                 
                 // test the absolute value of A
-                int32_t r0_absValA = asmAbs(exp.inputA, &absA, &signBitA);
-
-                testAsmAbs(testCase,
-                        "",
-                        exp.inputA,  //inputs
-                        &absA,        // I/O
-                        &signBitA,
-                        r0_absValA,   // outputs
-                        exp.absA,  // expected values
-                        exp.signA,
-                        &passCount,
-                        &failCount,
-                        onlyPrintFails,
-                        &isUSARTTxComplete
-                        );
+                aapcsPrepare(RESULT_ABS, (aapcsFunc)asmAbs, exp->inputA,
+                        (uint32_t)&absA, (uint32_t)&signBitA, 0);
+                int32_t r0_absValA = 0;
+                AAPCS_GUARD_CALL(callStatus, RESULT_ABS, testCase,
+                        r0_absValA = (int32_t)aapcsCall());
+                cycles = callStatus == TEST_GUARD_OK ? aapcsLastCycles() : 0;
+
+                if (callStatus != TEST_GUARD_OK)
+                {
+                    testGuardPrintFailure(callStatus, RESULT_ABS, testCase,
+                            &isUSARTTxComplete);
+                    failCount = TV_ABS_FIELDS;
+                }
+                else
+                {
+                    testAsmAbs(testCase,
+                            "",
+                            exp->inputA,  //inputs
+                            &absA,        // I/O
+                            &signBitA,
+                            r0_absValA,   // outputs
+                            exp->absA,  // expected values
+                            exp->signA,
+                            &passCount,
+                            &failCount,
+                            onlyPrintFails,
+                            &isUSARTTxComplete
+                            );
+                    aapcsCheckCase(RESULT_ABS, testCase,
+                            &isUSARTTxComplete);
+                }
      
                 absTotalPassCount = absTotalPassCount + passCount;
                 absTotalFailCount = absTotalFailCount + failCount;
+                int32_t absCaseFailCount = failCount;
 
                 passCount = 0;
                 failCount = 0;
                 
                 // test the absolute value of B
-                int32_t r0_absValB = asmAbs(exp.inputB, &absB, &signBitB);
-
-                testAsmAbs(testCase,
-                        "",
-                        exp.inputB,  //inputs
-                        &absB,        // I/O
-                        &signBitB,
-                        r0_absValB,   // outputs
-                        exp.absB,  // expected values
-                        exp.signB,
-                        &passCount,
-                        &failCount,
-                        onlyPrintFails,
-                        &isUSARTTxComplete
-                        );
+                aapcsPrepare(RESULT_ABS, (aapcsFunc)asmAbs, exp->inputB,
+                        (uint32_t)&absB, (uint32_t)&signBitB, 0);
+                int32_t r0_absValB = 0;
+                AAPCS_GUARD_CALL(callStatus, RESULT_ABS, testCase,
+                        r0_absValB = (int32_t)aapcsCall());
+                uint32_t cyclesB = callStatus == TEST_GUARD_OK ?
+                        aapcsLastCycles() : 0;
+                cycles = cycles == RESULT_STORE_UNTIMED ||
+                        cyclesB == RESULT_STORE_UNTIMED ?
+                        RESULT_STORE_UNTIMED : cycles + cyclesB;
+
+                if (callStatus != TEST_GUARD_OK)
+                {
+                    testGuardPrintFailure(callStatus, RESULT_ABS, testCase,
+                            &isUSARTTxComplete);
+                    failCount = TV_ABS_FIELDS;
+                }
+                else
+                {
+                    testAsmAbs(testCase,
+                            "",
+                            exp->inputB,  //inputs
+                            &absB,        // I/O
+                            &signBitB,
+                            r0_absValB,   // outputs
+                            exp->absB,  // expected values
+                            exp->signB,
+                            &passCount,
+                            &failCount,
+                            onlyPrintFails,
+                            &isUSARTTxComplete
+                            );
+                    aapcsCheckCase(RESULT_ABS, testCase,
+                            &isUSARTTxComplete);
+                }
 
                 // print summary of tests executed so far. Sums both A and B tests
                 absTotalPassCount = absTotalPassCount + passCount;
                 absTotalFailCount = absTotalFailCount + failCount;
                 absTotalTests = absTotalPassCount + absTotalFailCount;
-
-                isUSARTTxComplete = false;
-                snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                        "========= asmAbs In-progress test summary:\r\n"
-                        "%ld of %ld tests passed so far...\r\n"
-                        "\r\n",
-                        absTotalPassCount, absTotalTests); 
+                resultStoreAddCase(&thisRunResults, RESULT_ABS, testCase,
+                        absCaseFailCount + failCount, cycles);
+
+                uartTxBuffer = (uint8_t *)printQueueBufferGet();
+                fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+                fmtStr(&fmt, "========= asmAbs In-progress test summary:\r\n");
+                fmtDec(&fmt, absTotalPassCount, 0);
+                fmtStr(&fmt, " of ");
+                fmtDec(&fmt, absTotalTests, 0);
+                fmtStr(&fmt, " tests passed so far...\r\n"
+                        "\r\n");
+                fmtEnd(&fmt);
                 
                 printAndWait((char*)uartTxBuffer,&isUSARTTxComplete);
 
+                testScheduleRecord(RESULT_ABS, testCase,
+                        absCaseFailCount + failCount);
+                if (failFast == true && (absCaseFailCount + failCount) != 0)
+                {
+                    testSchedulePrintStop(RESULT_ABS, testCase, position + 1,
+                            &isUSARTTxComplete);
+                    break;
+                }
+
                 // spin here until the LED toggle timer has expired. This allows
                 // the test cases to be spread out in time.
-                while (isRTCExpired == false);
+                while (isRTCExpired == false && turboPacing == false);
             } // end: loop on all test cases for asmAbs A and B
             
-            isUSARTTxComplete = false;
-            snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                    "========= asmAbs TESTS COMPLETE: \r\n"
-                    "Summary of tests: %ld of %ld tests passed\r\n"
-                    "\r\n",
-                    absTotalPassCount, absTotalTests); 
+            uartTxBuffer = (uint8_t *)printQueueBufferGet();
+            fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+            fmtStr(&fmt, "========= asmAbs TESTS COMPLETE: \r\n"
+                    "Summary of tests: ");
+            fmtDec(&fmt, absTotalPassCount, 0);
+            fmtStr(&fmt, " of ");
+            fmtDec(&fmt, absTotalTests, 0);
+            fmtStr(&fmt, " tests passed\r\n"
+                    "\r\n");
+            fmtEnd(&fmt);
             printAndWait((char*)uartTxBuffer,&isUSARTTxComplete);
             
             // STUDENTS: put a breakpoint at the next instruction to see the 
@@ -368,62 +556,97 @@ int main ( void )
         if (doMultTest == true)
         {
             /* return product of two positive integers guaranteed to be <= 2^16 */
-            for (int testCase = 0; testCase < numTestCases; ++testCase)
+            testScheduleOrder(RESULT_MULT);
+            for (int position = 0; position < numTestCases; ++position)
             {
+                // run previously failing cases first
+                int testCase = testScheduleCase(position);
+
                 // Toggle the LED to show we're running a new test case
                 LED0_Toggle();
 
-                // reset the state variables for the timer and serial port funcs
+                // reset the state variable for the timer
                 isRTCExpired = false;
-                isUSARTTxComplete = false;
                 
                 passCount = 0;
                 failCount = 0;
-                    // Get the packed value for this test case 
-                int32_t packedValue = tc[testCase];  // multiplicand and multiplier
-                calcExpectedValues(testCase,"",packedValue,&exp);
+                    // Look up the expected values for this test case
+                exp = &tcExpected[testCase];
                 
                 // !!!! THIS IS WHERE YOUR ASSEMBLY LANGUAGE PROGRAM GETS CALLED!!!!
                 // Call our assembly function defined in file asmMult.s
-                // initConservedRegs(conservedRegInitValues);            // set the input values 
-                int32_t r0_initProd = asmMult(exp.absA, exp.absB);
-
-                testAsmMult(testCase,
-                        "",
-                        exp.absA, // inputs
-                        exp.absB,
-                        r0_initProd, // outputs
-                        exp.initProduct, // expected values
-                        &passCount,
-                        &failCount,
-                        onlyPrintFails,
-                        &isUSARTTxComplete
-                        );
+                // r4-r11 are seeded with known values and checked afterwards
+                aapcsPrepare(RESULT_MULT, (aapcsFunc)asmMult,
+                        exp->absA, exp->absB, 0, 0);
+                int32_t r0_initProd = 0;
+                AAPCS_GUARD_CALL(callStatus, RESULT_MULT, testCase,
+                        r0_initProd = (int32_t)aapcsCall());
+                cycles = callStatus == TEST_GUARD_OK ? aapcsLastCycles() : 0;
+
+                if (callStatus != TEST_GUARD_OK)
+                {
+                    testGuardPrintFailure(callStatus, RESULT_MULT, testCase,
+                            &isUSARTTxComplete);
+                    failCount = TV_MULT_FIELDS;
+                }
+                else
+                {
+                    testAsmMult(testCase,
+                            "",
+                            exp->absA, // inputs
+                            exp->absB,
+                            r0_initProd, // outputs
+                            exp->initProduct, // expected values
+                            &passCount,
+                            &failCount,
+                            onlyPrintFails,
+                            &isUSARTTxComplete
+                            );
+                    aapcsCheckCase(RESULT_MULT, testCase,
+                            &isUSARTTxComplete);
+                }
                 
+                resultStoreAddCase(&thisRunResults, RESULT_MULT, testCase,
+                        failCount, cycles);
                 multTotalPassCount = multTotalPassCount + passCount;
                 multTotalFailCount = multTotalFailCount + failCount;
                 multTotalTests = multTotalPassCount + multTotalFailCount;
 
-                isUSARTTxComplete = false;
-                snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                        "========= asmMult In-progress test summary:\r\n"
-                        "%ld of %ld tests passed so far...\r\n"
-                        "\r\n",
-                        multTotalPassCount, multTotalTests); 
+                uartTxBuffer = (uint8_t *)printQueueBufferGet();
+                fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+                fmtStr(&fmt, "========= asmMult In-progress test summary:\r\n");
+                fmtDec(&fmt, multTotalPassCount, 0);
+                fmtStr(&fmt, " of ");
+                fmtDec(&fmt, multTotalTests, 0);
+                fmtStr(&fmt, " tests passed so far...\r\n"
+                        "\r\n");
+                fmtEnd(&fmt);
                 
                 printAndWait((char*)uartTxBuffer,&isUSARTTxComplete);
 
+                testScheduleRecord(RESULT_MULT, testCase, failCount);
+                if (failFast == true && failCount != 0)
+                {
+                    testSchedulePrintStop(RESULT_MULT, testCase, position + 1,
+                            &isUSARTTxComplete);
+                    break;
+                }
+
                 // spin here until the LED toggle timer has expired. This allows
                 // the test cases to be spread out in time.
-                while (isRTCExpired == false);
+                while (isRTCExpired == false && turboPacing == false);
             } // end: loop on all test cases for asmMult
             
-            isUSARTTxComplete = false;
-            snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                    "========= asmMult TESTS COMPLETE: \r\n"
-                    "Summary of tests: %ld of %ld tests passed\r\n"
-                    "\r\n",
-                    multTotalPassCount, multTotalTests); 
+            uartTxBuffer = (uint8_t *)printQueueBufferGet();
+            fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+            fmtStr(&fmt, "========= asmMult TESTS COMPLETE: \r\n"
+                    "Summary of tests: ");
+            fmtDec(&fmt, multTotalPassCount, 0);
+            fmtStr(&fmt, " of ");
+            fmtDec(&fmt, multTotalTests, 0);
+            fmtStr(&fmt, " tests passed\r\n"
+                    "\r\n");
+            fmtEnd(&fmt);
             printAndWait((char*)uartTxBuffer,&isUSARTTxComplete);
             
             // STUDENTS: put a breakpoint at the next instruction to see the 
@@ -440,65 +663,98 @@ int main ( void )
         int32_t fsTotalTests = 0;
         if (doFixSignTest == true)
         {
-            for (int testCase = 0; testCase < numTestCases; ++testCase)
+            testScheduleOrder(RESULT_FIXSIGN);
+            for (int position = 0; position < numTestCases; ++position)
             {
+                // run previously failing cases first
+                int testCase = testScheduleCase(position);
+
                 // Toggle the LED to show we're running a new test case
                 LED0_Toggle();
 
-                // reset the state variables for the timer and serial port funcs
+                // reset the state variable for the timer
                 isRTCExpired = false;
-                isUSARTTxComplete = false;
                 
                 passCount = 0;
                 failCount = 0;
-                // Get the packed value for this test case 
-                int32_t packedValue = tc[testCase];  // multiplicand and multiplier
-                calcExpectedValues(testCase,"",packedValue,&exp);
+                // Look up the expected values for this test case
+                exp = &tcExpected[testCase];
                 
                 // !!!! THIS IS WHERE YOUR ASSEMBLY LANGUAGE PROGRAM GETS CALLED!!!!
                 /* return corrected product based on signs of two original input values */
                 // provide the correct value as inputs,
                 // see if the sign is adjusted correctly
-                int32_t r0_finalProduct = asmFixSign(exp.initProduct, 
-                        exp.signA, 
-                        exp.signB);
-
-                testAsmFixSign(testCase,
-                        "DEBUG",
-                        exp.initProduct, // inputs
-                        exp.signA, 
-                        exp.signB,
-                        r0_finalProduct, // outputs
-                        exp.finalProduct, // expected values
-                        &passCount,
-                        &failCount,
-                        onlyPrintFails,
-                        &isUSARTTxComplete
-                        );
+                aapcsPrepare(RESULT_FIXSIGN, (aapcsFunc)asmFixSign,
+                        exp->initProduct, exp->signA, exp->signB, 0);
+                int32_t r0_finalProduct = 0;
+                AAPCS_GUARD_CALL(callStatus, RESULT_FIXSIGN, testCase,
+                        r0_finalProduct = (int32_t)aapcsCall());
+                cycles = callStatus == TEST_GUARD_OK ? aapcsLastCycles() : 0;
+
+                if (callStatus != TEST_GUARD_OK)
+                {
+                    testGuardPrintFailure(callStatus, RESULT_FIXSIGN, testCase,
+                            &isUSARTTxComplete);
+                    failCount = TV_FIXSIGN_FIELDS;
+                }
+                else
+                {
+                    testAsmFixSign(testCase,
+                            "DEBUG",
+                            exp->initProduct, // inputs
+                            exp->signA, 
+                            exp->signB,
+                            r0_finalProduct, // outputs
+                            exp->finalProduct, // expected values
+                            &passCount,
+                            &failCount,
+                            onlyPrintFails,
+                            &isUSARTTxComplete
+                            );
+                    aapcsCheckCase(RESULT_FIXSIGN, testCase,
+                            &isUSARTTxComplete);
+                }
+                resultStoreAddCase(&thisRunResults, RESULT_FIXSIGN, testCase,
+                        failCount, cycles);
                 fsTotalPassCount = fsTotalPassCount + passCount;
                 fsTotalFailCount = fsTotalFailCount + failCount;
                 fsTotalTests = fsTotalPassCount + fsTotalFailCount;
 
-                isUSARTTxComplete = false;
-                snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                        "========= asmFixSign In-progress test summary:\r\n"
-                        "%ld of %ld tests passed so far...\r\n"
-                        "\r\n",
-                        fsTotalPassCount, fsTotalTests); 
+                uartTxBuffer = (uint8_t *)printQueueBufferGet();
+                fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+                fmtStr(&fmt, "========= asmFixSign In-progress test summary:\r\n");
+                fmtDec(&fmt, fsTotalPassCount, 0);
+                fmtStr(&fmt, " of ");
+                fmtDec(&fmt, fsTotalTests, 0);
+                fmtStr(&fmt, " tests passed so far...\r\n"
+                        "\r\n");
+                fmtEnd(&fmt);
                 
                 printAndWait((char*)uartTxBuffer,&isUSARTTxComplete);
 
+                testScheduleRecord(RESULT_FIXSIGN, testCase, failCount);
+                if (failFast == true && failCount != 0)
+                {
+                    testSchedulePrintStop(RESULT_FIXSIGN, testCase, position + 1,
+                            &isUSARTTxComplete);
+                    break;
+                }
+
                 // spin here until the LED toggle timer has expired. This allows
                 // the test cases to be spread out in time.
-                while (isRTCExpired == false);
+                while (isRTCExpired == false && turboPacing == false);
             } // end: loop on all test cases for asmFixSign
             
-            isUSARTTxComplete = false;
-            snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                    "========= asmFixSign TESTS COMPLETE: \r\n"
-                    "Summary of tests: %ld of %ld tests passed\r\n"
-                    "\r\n",
-                    fsTotalPassCount, fsTotalTests); 
+            uartTxBuffer = (uint8_t *)printQueueBufferGet();
+            fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+            fmtStr(&fmt, "========= asmFixSign TESTS COMPLETE: \r\n"
+                    "Summary of tests: ");
+            fmtDec(&fmt, fsTotalPassCount, 0);
+            fmtStr(&fmt, " of ");
+            fmtDec(&fmt, fsTotalTests, 0);
+            fmtStr(&fmt, " tests passed\r\n"
+                    "\r\n");
+            fmtEnd(&fmt);
             printAndWait((char*)uartTxBuffer,&isUSARTTxComplete);
             
             // STUDENTS: put a breakpoint at the next instruction to see the 
@@ -517,72 +773,180 @@ int main ( void )
         if (doAsmMainTest == true)
         {
             // return product of two positive integers guaranteed to be <= 2^16 
-            for (int testCase = 0; testCase < numTestCases; ++testCase)
+            testScheduleOrder(RESULT_MAIN);
+            for (int position = 0; position < numTestCases; ++position)
             {
+                // run previously failing cases first
+                int testCase = testScheduleCase(position);
+
                 // Toggle the LED to show we're running a new test case
                 LED0_Toggle();
 
-                // reset the state variables for the timer and serial port funcs
+                // reset the state variable for the timer
                 isRTCExpired = false;
-                isUSARTTxComplete = false;
                 passCount = 0;
                 failCount = 0;
 
                 // Get the packed value for this test case 
                 int32_t packedValue = tc[testCase];  // multiplicand and multiplier
-                calcExpectedValues(testCase,"",packedValue,&exp);
+                exp = &tcExpected[testCase];
                 
                 // !!!! THIS IS WHERE YOUR ASSEMBLY LANGUAGE PROGRAM GETS CALLED!!!!
                 // Call our assembly function defined in file asmMult.s
                 
-                int32_t r0_mainFinalProd = asmMain(packedValue);
-                testAsmMain(testCase,
-                        "",
-                        exp.packedVal, // inputs
-                        r0_mainFinalProd, // outputs
-                        a_Multiplicand, // val stored in mem
-                        b_Multiplier,  // val stored in mem
-                        a_Abs, a_Sign, b_Abs, b_Sign,
-                        init_Product,
-                        final_Product,
-                        &exp, // expected values
-                        &passCount,
-                        &failCount,
-                        onlyPrintFails,
-                        &isUSARTTxComplete
-                        );
+                aapcsPrepare(RESULT_MAIN, (aapcsFunc)asmMain,
+                        packedValue, 0, 0, 0);
+                int32_t r0_mainFinalProd = 0;
+                AAPCS_GUARD_CALL(callStatus, RESULT_MAIN, testCase,
+                        r0_mainFinalProd = (int32_t)aapcsCall());
+                cycles = callStatus == TEST_GUARD_OK ? aapcsLastCycles() : 0;
+                if (callStatus != TEST_GUARD_OK)
+                {
+                    testGuardPrintFailure(callStatus, RESULT_MAIN, testCase,
+                            &isUSARTTxComplete);
+                    failCount = TV_MAIN_FIELDS;
+                }
+                else
+                {
+                    testAsmMain(testCase,
+                            "",
+                            exp->packedVal, // inputs
+                            r0_mainFinalProd, // outputs
+                            a_Multiplicand, // val stored in mem
+                            b_Multiplier,  // val stored in mem
+                            a_Abs, a_Sign, b_Abs, b_Sign,
+                            init_Product,
+                            final_Product,
+                            exp, // expected values
+                            &passCount,
+                            &failCount,
+                            onlyPrintFails,
+                            &isUSARTTxComplete
+                            );
+                    aapcsCheckCase(RESULT_MAIN, testCase,
+                            &isUSARTTxComplete);
+                }
 
                             
+                resultStoreAddCase(&thisRunResults, RESULT_MAIN, testCase,
+                        failCount, cycles);
                 mainTotalPassCount = mainTotalPassCount + passCount;
                 mainTotalFailCount = mainTotalFailCount + failCount;
                 mainTotalTests = mainTotalPassCount + mainTotalFailCount;
 
-                isUSARTTxComplete = false;
-                snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                        "========= asmMain In-progress test summary:\r\n"
-                        "%ld of %ld tests passed so far...\r\n"
-                        "\r\n",
-                        mainTotalPassCount, mainTotalTests); 
+                uartTxBuffer = (uint8_t *)printQueueBufferGet();
+                fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+                fmtStr(&fmt, "========= asmMain In-progress test summary:\r\n");
+                fmtDec(&fmt, mainTotalPassCount, 0);
+                fmtStr(&fmt, " of ");
+                fmtDec(&fmt, mainTotalTests, 0);
+                fmtStr(&fmt, " tests passed so far...\r\n"
+                        "\r\n");
+                fmtEnd(&fmt);
                 
                 printAndWait((char*)uartTxBuffer,&isUSARTTxComplete);
 
+                testScheduleRecord(RESULT_MAIN, testCase, failCount);
+                if (failFast == true && failCount != 0)
+                {
+                    testSchedulePrintStop(RESULT_MAIN, testCase, position + 1,
+                            &isUSARTTxComplete);
+                    break;
+                }
+
                 // spin here until the LED toggle timer has expired. This allows
                 // the test cases to be spread out in time.
-                while (isRTCExpired == false);
+                while (isRTCExpired == false && turboPacing == false);
             } // end: loop on all test cases for asmMult
             
-            isUSARTTxComplete = false;
-            snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                    "========= asmMain TESTS COMPLETE: \r\n"
-                    "Summary of tests: %ld of %ld tests passed\r\n"
-                    "\r\n",
-                    mainTotalPassCount, mainTotalTests); 
+            uartTxBuffer = (uint8_t *)printQueueBufferGet();
+            fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+            fmtStr(&fmt, "========= asmMain TESTS COMPLETE: \r\n"
+                    "Summary of tests: ");
+            fmtDec(&fmt, mainTotalPassCount, 0);
+            fmtStr(&fmt, " of ");
+            fmtDec(&fmt, mainTotalTests, 0);
+            fmtStr(&fmt, " tests passed\r\n"
+                    "\r\n");
+            fmtEnd(&fmt);
             printAndWait((char*)uartTxBuffer,&isUSARTTxComplete);
 
             // STUDENTS: put a breakpoint at the next instruction to see the 
             // results of the asmMain tests!
             isUSARTTxComplete = false;
         } // end -- if doAsmMainTest == true
+
+        // callee-saved registers and stack use of each function
+        aapcsPrintSummary(&isUSARTTxComplete);
+
+        // compare against the run stored before this boot, then replace it
+        resultStoreReport(haveLastBootResults ? &lastBootResults : NULL,
+                &thisRunResults, &isUSARTTxComplete);
+        resultStoreSave(&thisRunResults,
+                haveLastBootResults ? &lastBootResults : NULL);
+
+        if (doExhaustiveSweep == true)
+        {
+            static sweepResult sweep;
+            runExhaustiveSweep(sweepFirstInput, sweepLastInput, &sweep,
+                    &isRTCExpired, &isUSARTTxComplete);
+        } // end -- if doExhaustiveSweep == true
+
+        if (doFuzzTest == true)
+        {
+            static fuzzResult fuzz;
+            runFuzz(fuzzSeed, fuzzCaseCount, &fuzz,
+                    &isRTCExpired, &isUSARTTxComplete);
+        } // end -- if doFuzzTest == true
+
+        if (doBenchmark == true)
+        {
+            // the benchmark calls are not guarded; only time functions that
+            // ran every test case without a failure
+            uint32_t skipMask = 0;
+            if (unpackTotalFailCount != 0 || unpackTotalTests == 0)
+            {
+                skipMask |= 1u << RESULT_UNPACK;
+            }
+            if (absTotalFailCount != 0 || absTotalTests == 0)
+            {
+                skipMask |= 1u << RESULT_ABS;
+            }
+            if (multTotalFailCount != 0 || multTotalTests == 0)
+            {
+                skipMask |= 1u << RESULT_MULT;
+            }
+            if (fsTotalFailCount != 0 || fsTotalTests == 0)
+            {
+                skipMask |= 1u << RESULT_FIXSIGN;
+            }
+            if (mainTotalFailCount != 0 || mainTotalTests == 0)
+            {
+                skipMask |= 1u << RESULT_MAIN;
+            }
+            benchConfig bench = {
+                .inputSet = benchInputs,
+                .randomCount = benchRandomCount,
+                .randomSeed = benchSeed,
+                .warmup = benchWarmup,
+                .iterations = benchIterations
+            };
+            runBenchmark(&bench, tc, numTestCases, skipMask,
+                    &isUSARTTxComplete);
+        } // end -- if doBenchmark == true
+
+        if (doDifferential == true)
+        {
+            static diffResult diff;
+            runDifferential(diffSeed, diffCaseCount, diffEngineMask, &diff,
+                    &isRTCExpired, &isUSARTTxComplete);
+        } // end -- if doDifferential == true
+
+        // list the cases and modes that faulted (and reset the board) during
+        // this run, then forget them so that the next reset tests them
+        // again; after the modes, which a fault stops across the reset
+        faultPrintSummary(&isUSARTTxComplete);
+        faultClear();
         
         // When all test cases are complete, print the pass/fail statistics
         // Keep looping so that students can see code is still running.
@@ -600,51 +964,73 @@ int main ( void )
         mainPts = 5*mainTotalPassCount/mainTotalTests;
         totalPts = unpackPts + absPts + multPts + fsPts + mainPts;
         
-        while(true)      // post-test forever loop
+        // post-test loop, until a new run is asked for on the console
+        while (consolePoll() == false)
         {
             isRTCExpired = false;
-            isUSARTTxComplete = false;
             if (doUnpackTest == true && 
                     doAbsTest == true && 
                     doMultTest == true &&
                     doFixSignTest == true &&
                     doAsmMainTest == true)
             {
-                snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                    "========= %s: Functions Lab ALL TESTS COMPLETE: Post-test Idle Cycle Number: %ld\r\n"
-                    "Summary of tests: asmUnpack:  %ld of %ld tests passed; %ld pts\r\n"
-                    "Summary of tests: asmAbs:     %ld of %ld tests passed; %ld pts\r\n"
-                    "Summary of tests: asmMult:    %ld of %ld tests passed; %ld pts\r\n"
-                    "Summary of tests: asmFixSign: %ld of %ld tests passed; %ld pts\r\n"
-                    "Summary of tests: asmMain:    %ld of %ld tests passed; %ld pts\r\n"
-                    " Total point score: %ld\r\n"
-                    "\r\n",
-                    (char *) nameStrPtr, idleCount, 
-                    unpackTotalPassCount, unpackTotalTests, unpackPts,
-                    absTotalPassCount, absTotalTests, absPts,
-                    multTotalPassCount, multTotalTests, multPts,
-                    fsTotalPassCount, fsTotalTests, fsPts,
-                    mainTotalPassCount, mainTotalTests, mainPts,
-                    totalPts
-                    ); 
+                uartTxBuffer = (uint8_t *)printQueueBufferGet();
+                const struct
+                {
+                    const char *name;
+                    int32_t passed, tests, pts;
+                } summary[] = {
+                    { "asmUnpack:  ", unpackTotalPassCount, unpackTotalTests, unpackPts },
+                    { "asmAbs:     ", absTotalPassCount, absTotalTests, absPts },
+                    { "asmMult:    ", multTotalPassCount, multTotalTests, multPts },
+                    { "asmFixSign: ", fsTotalPassCount, fsTotalTests, fsPts },
+                    { "asmMain:    ", mainTotalPassCount, mainTotalTests, mainPts }
+                };
+                fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+                fmtStr(&fmt, "========= ");
+                fmtStr(&fmt, (char *) nameStrPtr);
+                fmtStr(&fmt, ": Functions Lab ALL TESTS COMPLETE: Post-test Idle Cycle Number: ");
+                fmtDec(&fmt, (int32_t)idleCount, 0);
+                fmtStr(&fmt, "\r\n");
+                for (uint32_t i = 0; i < sizeof(summary) / sizeof(summary[0]); ++i)
+                {
+                    fmtStr(&fmt, "Summary of tests: ");
+                    fmtStr(&fmt, summary[i].name);
+                    fmtDec(&fmt, summary[i].passed, 0);
+                    fmtStr(&fmt, " of ");
+                    fmtDec(&fmt, summary[i].tests, 0);
+                    fmtStr(&fmt, " tests passed; ");
+                    fmtDec(&fmt, summary[i].pts, 0);
+                    fmtStr(&fmt, " pts\r\n");
+                }
+                fmtStr(&fmt, " Total point score: ");
+                fmtDec(&fmt, totalPts, 0);
+                fmtStr(&fmt, "\r\n"
+                        "\r\n");
+                fmtEnd(&fmt);
             }
             else
             {
-                snprintf((char*)uartTxBuffer, MAX_PRINT_LEN,
-                    "========= %s: PARTIAL tests complete, make sure to rerun with all tests enabled!!!\r\n"
-                    "Post-test Idle Cycle Number: %ld\r\n",
-                    (char *) nameStrPtr, idleCount);
+                uartTxBuffer = (uint8_t *)printQueueBufferGet();
+                fmtBegin(&fmt, (char*)uartTxBuffer, MAX_PRINT_LEN);
+                fmtStr(&fmt, "========= ");
+                fmtStr(&fmt, (char *) nameStrPtr);
+                fmtStr(&fmt, ": PARTIAL tests complete, make sure to rerun with all tests enabled!!!\r\n"
+                        "Post-test Idle Cycle Number: ");
+                fmtDec(&fmt, (int32_t)idleCount, 0);
+                fmtStr(&fmt, "\r\n");
+                fmtEnd(&fmt);
             }
 
 #if USING_HW 
-            isUSARTTxComplete = false;
-            // spin here, waiting for UART to complete
+            // queue the idle message; the DMA sends it while we wait below
             printAndWait((char*)uartTxBuffer, &isUSARTTxComplete);
             LED0_Toggle();
             ++idleCount;
 
-            // spin here, waiting for LED toggle timer to complete
-            while (isRTCExpired == false);
+            // spin here, waiting for LED toggle timer to complete, and
+            // take console commands meanwhile
+            while (isRTCExpired == false && consolePoll() == false);
 
             // slow down the blink rate after the tests have been executed
             if (firstTime == true)
@@ -654,10 +1040,22 @@ int main ( void )
                 RTC_Timer32CounterSet(0); // reset timer to start at 0
             }
 #endif
-        } // end - post-test forever loop
-        
-        // Should never get here...
-        break;
+        } // end - post-test loop
+
+        // a new run from the console: start it as the first one started
+        consoleRunStarted();
+        haveLastBootResults = resultStoreLoad(&lastBootResults);
+        if (failFast == true)
+        {
+            turboPacing = true;
+        }
+        resultStoreInit(&thisRunResults, tc, numTestCases);
+        sandboxInit(useSandbox);
+        aapcsCheckInit();
+#if USING_HW
+        RTC_Timer32Compare0Set(PERIOD_10MS);
+        RTC_Timer32CounterSet(0);
+#endif
     } // while ...
             
     /* Execution should not come here during normal operation */
@@ -34,6 +34,7 @@
 #include "asmExterns.h"
 #include "testFuncs.h" // lab test structs
 #include "printFuncs.h"  // lab print funcs
+#include "printQueue.h"
 
 #define MAX_PRINT_LEN 1000
 
@@ -65,28 +66,21 @@
 
 /** 
   @Function
-    int ExampleInterfaceFunctionName ( int param1, int param2 ) 
+    void printAndWait(char *txBuffer, volatile bool *txCompletePtr)
 
   @Summary
-    Brief one-line description of the function.
+    Queues txBuffer for the UART; see printQueue.h.
 
   @Remarks
-    Refer to the example_file.h interface header for function usage details.
+    Despite the name, this only waits when the print queue is full. A
+    buffer from printQueueBufferGet() is handed to the DMA as it is; any
+    other is copied and may be reused at once. *txCompletePtr is cleared
+    now and set when the last byte has gone to the UART.
  */
 void printAndWait(char *txBuffer, volatile bool *txCompletePtr)
 {
-    *txCompletePtr = false;
-
-#if USING_HW 
-    DMAC_ChannelTransfer(DMAC_CHANNEL_0, txBuffer, \
-        (const void *)&(SERCOM5_REGS->USART_INT.SERCOM_DATA), \
-        strlen((const char*)txBuffer));
-    // spin here, waiting for timer and UART to complete
-    while (*txCompletePtr == false); // wait for print to finish
-    /* reset it for the next print */
-    *txCompletePtr = false;
-#endif
-
+    printQueueBufferSend(txBuffer, strlen((const char*)txBuffer),
+            txCompletePtr);
 }
 
 // print the mem addresses of the global vars at startup
@@ -156,6 +156,8 @@ extern "C" {
         }
      */
 
+    // queues txBuffer and returns; it only waits when the print queue is
+    // full. *txCompletePtr is set once the text has gone to the UART.
     void printAndWait(char *txBuffer, volatile bool *txCompletePtr);
     void printGlobalAddresses(char *uartTxBuffer, volatile bool *txCompletePtr);
     /* Provide C++ Compatibility */
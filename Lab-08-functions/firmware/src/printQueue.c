@@ -0,0 +1,739 @@
+/* ************************************************************************** */
+/** Non-blocking UART output queue
+
+  @File Name
+    printQueue.c
+
+  @Summary
+    Queues messages for the SERCOM5 UART and sends them with DMAC channel 0
+    as a chain of linked descriptors, so that a print returns at once.
+
+  @Description
+    See printQueue.h.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <string.h>
+#include "definitions.h"                // SYS function prototypes
+#include "printQueue.h"
+#include "logCompress.h"
+
+#ifndef USING_HW
+#define USING_HW 1
+#endif
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+typedef struct _printQueueSegment
+{
+    const uint8_t *data;
+    uint32_t len;
+    uint32_t ringBytes;        // len if data is in printQueueBytes, else 0
+    int32_t buffer;            // the pool buffer holding data, or -1
+    volatile bool *done;       // set once this segment is sent; may be NULL
+} printQueueSegment;
+
+typedef enum
+{
+    PRINT_QUEUE_BUFFER_FREE = 0,
+    PRINT_QUEUE_BUFFER_HELD,       // being formatted into
+    PRINT_QUEUE_BUFFER_QUEUED      // owned by the DMA until sent
+} printQueueBufferState;
+
+static uint8_t printQueueBytes[PRINT_QUEUE_BYTES];
+static printQueueSegment printQueueSegments[PRINT_QUEUE_SEGMENTS];
+
+static uint8_t printQueueBuffers[PRINT_QUEUE_TX_BUFFERS][PRINT_QUEUE_TX_BUFFER_LEN];
+static volatile printQueueBufferState printQueueBufferStates[PRINT_QUEUE_TX_BUFFERS];
+static int32_t printQueueHeld = -1;
+
+/* Free-running counts; the ring index is the count modulo the ring size.
+ * Bytes and segments from tail up to sent are in the running chain, from
+ * sent up to head they wait for the next one. head is only moved by the
+ * thread, tail and sent only by the completion handler or with
+ * interrupts masked. */
+static volatile uint32_t printQueueByteHead;
+static volatile uint32_t printQueueByteTail;
+static volatile uint32_t printQueueSegHead;
+static volatile uint32_t printQueueSegSent;
+static volatile uint32_t printQueueSegTail;
+static volatile uint32_t printQueueChainRingBytes;
+static volatile bool printQueueBusy;
+static volatile uint32_t printQueueErrorCount;
+
+/* the running chain; the DMAC reads every descriptor after the first
+ * straight from here */
+static dmac_descriptor_registers_t printQueueChain[PRINT_QUEUE_DESCRIPTORS]
+        __ALIGNED(8);
+
+#if PRINT_QUEUE_FRAMES
+/* a chain is one frame, and the trailer has 16 bits for its length */
+_Static_assert(PRINT_QUEUE_BYTES +
+        PRINT_QUEUE_TX_BUFFERS * PRINT_QUEUE_TX_BUFFER_LEN <= 0xFFFF,
+        "a chain can be longer than a frame trailer can say");
+
+static uint8_t printQueueTrailer[PRINT_QUEUE_TRAILER_LEN];
+static uint16_t printQueueFrameSeq;
+static uint32_t printQueueFrameLen;
+static volatile bool printQueueTrailerBusy;
+static volatile bool printQueueCrcHeld;     // printQueueCrc32() has the engine
+
+#if USING_HW
+/* channel 0 feeds the CRC engine; the trailer goes out on one it does not */
+static DMAC_CHANNEL printQueueTrailerChannel = DMAC_CHANNEL_NONE;
+
+static const DMAC_CRC_SETUP printQueueFrameCrcSetup = {
+    .polynomial_type = DMAC_CRC_TYPE_32,
+    .crc_mode = DMAC_CRC_MODE_DEFAULT,
+    .seed = 0xFFFFFFFF
+};
+#else
+static uint32_t printQueueSimCrc;
+#endif
+#endif
+
+#if LOG_COMPRESS_ENABLE
+/* the coder sees every message in the order it is queued; thread use only */
+static logCompressEncoder printQueueEncoder;
+static uint8_t printQueueCoded[LOG_COMPRESS_BOUND(LOG_COMPRESS_MAX_INPUT)];
+#endif
+
+#if !USING_HW
+static printQueueSimSink printQueueSink = NULL;
+static dmac_descriptor_registers_t *printQueueSimDesc = NULL;
+#endif
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#if !USING_HW
+/* CRC-32 (IEEE 802.3) a bit at a time, for want of the CRC engine: start
+ * from 0xFFFFFFFF and complement the end result */
+static uint32_t printQueueCrcUpdate(uint32_t crc, const uint8_t *p,
+        uint32_t len)
+{
+    while (len-- > 0)
+    {
+        crc ^= *p++;
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return crc;
+}
+#endif
+
+/* link the pending segments into a chain and start it. Runs in the
+ * completion handler or with interrupts masked, and only when idle. */
+static void printQueueStart(void)
+{
+    uint32_t n = printQueueSegHead - printQueueSegSent;
+    uint32_t ringBytes = 0;
+    uint32_t frameLen = 0;
+
+    if (n == 0)
+    {
+        return;
+    }
+#if PRINT_QUEUE_FRAMES
+    if (printQueueCrcHeld == true)
+    {
+        return;     // printQueueCrc32() starts it when it is done
+    }
+#endif
+    if (n > PRINT_QUEUE_DESCRIPTORS)
+    {
+        n = PRINT_QUEUE_DESCRIPTORS;
+    }
+
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        const printQueueSegment *s = &printQueueSegments[
+                (printQueueSegSent + i) % PRINT_QUEUE_SEGMENTS];
+        dmac_descriptor_registers_t *d = &printQueueChain[i];
+        bool last = i + 1 == n;
+
+        // only the end of the chain interrupts; the DMAC goes straight on
+        // from the other blocks to the next descriptor
+        d->DMAC_BTCTRL = (uint16_t)(DMAC_BTCTRL_VALID_Msk |
+                DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_SRCINC_Msk |
+                (last ? DMAC_BTCTRL_BLOCKACT_INT : DMAC_BTCTRL_BLOCKACT_NOACT));
+        d->DMAC_BTCNT = (uint16_t)s->len;
+        // with SRCINC the source address is that of the end of the block
+        d->DMAC_SRCADDR = (uint32_t)(uintptr_t)(s->data + s->len);
+#if USING_HW
+        d->DMAC_DSTADDR = (uint32_t)(uintptr_t)&(SERCOM5_REGS->USART_INT.SERCOM_DATA);
+#else
+        d->DMAC_DSTADDR = 0;
+#endif
+        d->DMAC_DESCADDR = last ? 0 : (uint32_t)(uintptr_t)&printQueueChain[i + 1];
+        ringBytes += s->ringBytes;
+        frameLen += s->len;
+    }
+
+    printQueueSegSent += n;
+    printQueueChainRingBytes = ringBytes;
+    printQueueBusy = true;
+
+#if PRINT_QUEUE_FRAMES
+    printQueueFrameLen = frameLen;
+#if USING_HW
+    // reseeds the checksum; the engine then sees every beat channel 0 moves
+    DMAC_ChannelCRCSetup(DMAC_CHANNEL_0, printQueueFrameCrcSetup);
+#else
+    printQueueSimCrc = 0xFFFFFFFF;
+#endif
+#else
+    (void)frameLen;
+#endif
+
+#if USING_HW
+    DMAC_ChannelLinkedListTransfer(DMAC_CHANNEL_0, &printQueueChain[0]);
+#else
+    printQueueSimDesc = &printQueueChain[0];
+#endif
+}
+
+#if PRINT_QUEUE_FRAMES
+/* the trailer is out: the frame is done, start the next */
+static void printQueueTrailerComplete(DMAC_TRANSFER_EVENT event,
+        uintptr_t context)
+{
+    (void)context;
+
+    if (printQueueTrailerBusy == false)
+    {
+        return;
+    }
+    if (event != DMAC_TRANSFER_EVENT_COMPLETE)
+    {
+        ++printQueueErrorCount;
+    }
+    printQueueTrailerBusy = false;
+    ++printQueueFrameSeq;
+    printQueueBusy = false;
+
+    printQueueStart();
+}
+
+/* the chain is out and the engine holds its CRC: send the trailer */
+static void printQueueTrailerSend(void)
+{
+    uint8_t *t = printQueueTrailer;
+    uint8_t check = 0;
+#if USING_HW
+    uint32_t crc = DMAC_CRCRead();
+#else
+    uint32_t crc = ~printQueueSimCrc;
+#endif
+
+    t[0] = PRINT_QUEUE_FRAME_SYNC0;
+    t[1] = PRINT_QUEUE_FRAME_SYNC1;
+    t[2] = (uint8_t)printQueueFrameSeq;
+    t[3] = (uint8_t)(printQueueFrameSeq >> 8);
+    t[4] = (uint8_t)printQueueFrameLen;
+    t[5] = (uint8_t)(printQueueFrameLen >> 8);
+    t[6] = (uint8_t)crc;
+    t[7] = (uint8_t)(crc >> 8);
+    t[8] = (uint8_t)(crc >> 16);
+    t[9] = (uint8_t)(crc >> 24);
+    for (uint32_t i = 0; i < PRINT_QUEUE_TRAILER_LEN - 1; ++i)
+    {
+        check += t[i];
+    }
+    t[PRINT_QUEUE_TRAILER_LEN - 1] = (uint8_t)~check;
+
+    printQueueTrailerBusy = true;
+#if USING_HW
+    if (printQueueTrailerChannel != DMAC_CHANNEL_NONE)
+    {
+        DMAC_ChannelTransfer(printQueueTrailerChannel, printQueueTrailer,
+                (const void *)&SERCOM5_REGS->USART_INT.SERCOM_DATA,
+                PRINT_QUEUE_TRAILER_LEN);
+        return;
+    }
+    // no channel to spare: unframed output is better than none
+#else
+    if (printQueueSink != NULL)
+    {
+        printQueueSink(printQueueTrailer, PRINT_QUEUE_TRAILER_LEN);
+    }
+#endif
+    printQueueTrailerComplete(DMAC_TRANSFER_EVENT_COMPLETE, 0);
+}
+#endif
+
+/* the running chain has ended: free its segments and start the next */
+static void printQueueComplete(DMAC_TRANSFER_EVENT event, uintptr_t context)
+{
+    (void)context;
+
+    if (printQueueBusy == false)
+    {
+        return;
+    }
+    if (event != DMAC_TRANSFER_EVENT_COMPLETE)
+    {
+        ++printQueueErrorCount;
+    }
+
+    for (uint32_t s = printQueueSegTail; s != printQueueSegSent; ++s)
+    {
+        const printQueueSegment *seg =
+                &printQueueSegments[s % PRINT_QUEUE_SEGMENTS];
+        if (seg->buffer >= 0)
+        {
+            printQueueBufferStates[seg->buffer] = PRINT_QUEUE_BUFFER_FREE;
+        }
+        if (seg->done != NULL)
+        {
+            *seg->done = true;
+        }
+    }
+    printQueueSegTail = printQueueSegSent;
+    printQueueByteTail += printQueueChainRingBytes;
+    printQueueChainRingBytes = 0;
+
+#if PRINT_QUEUE_FRAMES
+    printQueueTrailerSend();    // busy until the trailer is out too
+#else
+    printQueueBusy = false;
+    printQueueStart();
+#endif
+}
+
+/* append a segment; the thread makes sure there is room first */
+static void printQueuePush(const uint8_t *data, uint32_t len,
+        uint32_t ringBytes, int32_t buffer, volatile bool *done)
+{
+    printQueueSegment *s =
+            &printQueueSegments[printQueueSegHead % PRINT_QUEUE_SEGMENTS];
+    s->data = data;
+    s->len = len;
+    s->ringBytes = ringBytes;
+    s->buffer = buffer;
+    s->done = done;
+    // the segment is complete before the handler can see it: the stores
+    // above are not volatile, so without the barrier the compiler may
+    // move them after the increment
+#if USING_HW
+    __DMB();
+#else
+    __asm volatile ("" ::: "memory");
+#endif
+    ++printQueueSegHead;
+}
+
+/* start a chain from the thread if the DMA is idle */
+static void printQueueKick(void)
+{
+#if USING_HW
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (printQueueBusy == false)
+    {
+        printQueueStart();
+    }
+    __set_PRIMASK(primask);
+#else
+    if (printQueueBusy == false)
+    {
+        printQueueStart();
+    }
+#endif
+}
+
+#if USING_HW
+/* complete a channel's transfer from its flags, without the interrupt */
+static void printQueuePollChannel(DMAC_CHANNEL channel,
+        DMAC_CHANNEL_CALLBACK handler)
+{
+    DMAC_TRANSFER_EVENT event = DMAC_ChannelTransferStatusGet(channel);
+    if (event == DMAC_TRANSFER_EVENT_NONE)
+    {
+        return;
+    }
+    // clears the plib's busy flag; the channel has already stopped
+    DMAC_ChannelDisable(channel);
+    DMAC_REGS->CHANNEL[channel].DMAC_CHINTFLAG =
+            DMAC_CHINTENCLR_TCMPL_Msk | DMAC_CHINTENCLR_TERR_Msk;
+    // channels 4 and up share a line whose handler checks the flags
+    if (channel < DMAC_CHANNEL_4)
+    {
+        NVIC_ClearPendingIRQ((IRQn_Type)(DMAC_0_IRQn + channel));
+    }
+    handler(event, 0);
+}
+
+/* complete the running chain, and its trailer, without the interrupts */
+static void printQueuePoll(void)
+{
+    printQueuePollChannel(DMAC_CHANNEL_0, printQueueComplete);
+#if PRINT_QUEUE_FRAMES
+    if (printQueueTrailerChannel != DMAC_CHANNEL_NONE)
+    {
+        printQueuePollChannel(printQueueTrailerChannel,
+                printQueueTrailerComplete);
+    }
+#endif
+}
+#endif
+
+/* let the running chain make progress while the thread waits */
+static void printQueueWaitStep(void)
+{
+#if USING_HW
+    // the completion interrupt cannot run with interrupts masked
+    if (__get_PRIMASK() != 0)
+    {
+        printQueuePoll();
+    }
+#else
+    if (printQueueSimRun(1) == 0)
+    {
+        printQueueKick();
+    }
+#endif
+}
+
+/* wait for room for count more segments */
+static void printQueueWaitSegments(uint32_t count)
+{
+    while (PRINT_QUEUE_SEGMENTS - (printQueueSegHead - printQueueSegTail) <
+            count)
+    {
+        printQueueWaitStep();
+    }
+}
+
+/* copy len bytes into the ring, as they are */
+static void printQueueRingPut(const char *msg, uint32_t len,
+        volatile bool *done)
+{
+    if (done != NULL)
+    {
+        *done = len == 0;
+    }
+
+    while (len > 0)
+    {
+        // a message longer than the ring goes in ring-sized pieces
+        uint32_t n = len < PRINT_QUEUE_BYTES ? len : PRINT_QUEUE_BYTES;
+        uint32_t head = printQueueByteHead;
+        uint32_t start = head % PRINT_QUEUE_BYTES;
+        uint32_t first = PRINT_QUEUE_BYTES - start;
+        uint32_t segments = n > first ? 2 : 1;
+
+        while (PRINT_QUEUE_BYTES - (head - printQueueByteTail) < n)
+        {
+            printQueueWaitStep();
+        }
+        printQueueWaitSegments(segments);
+
+        if (segments == 1)
+        {
+            first = n;
+        }
+        memcpy(&printQueueBytes[start], msg, first);
+        memcpy(&printQueueBytes[0], msg + first, n - first);
+
+        volatile bool *lastDone = n == len ? done : NULL;
+        printQueuePush(&printQueueBytes[start], first, first, -1,
+                segments == 1 ? lastDone : NULL);
+        if (segments == 2)
+        {
+            printQueuePush(&printQueueBytes[0], n - first, n - first, -1,
+                    lastDone);
+        }
+        printQueueByteHead = head + n;
+
+        msg += n;
+        len -= n;
+        printQueueKick();
+    }
+}
+
+/* the pool buffer txBuffer points to the start of, or -1 */
+static int32_t printQueueBufferIndex(const char *txBuffer)
+{
+    for (int32_t b = 0; b < PRINT_QUEUE_TX_BUFFERS; ++b)
+    {
+        if ((const uint8_t *)txBuffer == printQueueBuffers[b])
+        {
+            return b;
+        }
+    }
+    return -1;
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void printQueueInit(void)
+{
+    printQueueByteHead = 0;
+    printQueueByteTail = 0;
+    printQueueSegHead = 0;
+    printQueueSegSent = 0;
+    printQueueSegTail = 0;
+    printQueueChainRingBytes = 0;
+    printQueueBusy = false;
+    printQueueErrorCount = 0;
+    for (int32_t b = 0; b < PRINT_QUEUE_TX_BUFFERS; ++b)
+    {
+        printQueueBufferStates[b] = PRINT_QUEUE_BUFFER_FREE;
+    }
+    printQueueHeld = -1;
+#if USING_HW
+    DMAC_ChannelCallbackRegister(DMAC_CHANNEL_0, printQueueComplete, 0);
+#else
+    printQueueSimDesc = NULL;
+#endif
+#if PRINT_QUEUE_FRAMES
+    printQueueFrameSeq = 0;
+    printQueueFrameLen = 0;
+    printQueueTrailerBusy = false;
+    printQueueCrcHeld = false;
+#if USING_HW
+    if (printQueueTrailerChannel == DMAC_CHANNEL_NONE)
+    {
+        static const DMAC_CHANNEL_SETUP setup = {
+            .trigger_source = SERCOM5_DMAC_ID_TX,
+            .trigger_action = DMAC_CHCTRLA_TRIGACT_BURST_Val,  // as channel 0
+            .beat_size = DMAC_BEAT_SIZE_BYTE,
+            .source_increment = true,
+            .destination_increment = false,
+            .priority_level = 0
+        };
+        printQueueTrailerChannel = DMAC_ChannelAllocate(&setup);
+        if (printQueueTrailerChannel != DMAC_CHANNEL_NONE)
+        {
+            DMAC_ChannelCallbackRegister(printQueueTrailerChannel,
+                    printQueueTrailerComplete, 0);
+        }
+    }
+#endif
+#endif
+#if LOG_COMPRESS_ENABLE
+    logCompressEncoderInit(&printQueueEncoder);
+    printQueueRingPut(LOG_COMPRESS_MARKER, sizeof(LOG_COMPRESS_MARKER) - 1,
+            NULL);
+#endif
+}
+
+void printQueuePut(const char *msg, uint32_t len, volatile bool *done)
+{
+#if LOG_COMPRESS_ENABLE
+    if (done != NULL)
+    {
+        *done = len == 0;
+    }
+
+    while (len > 0)
+    {
+        uint32_t n = len < LOG_COMPRESS_MAX_INPUT ? len : LOG_COMPRESS_MAX_INPUT;
+        uint32_t coded = logCompressEncode(&printQueueEncoder,
+                (const uint8_t *)msg, n, printQueueCoded);
+        printQueueRingPut((const char *)printQueueCoded, coded,
+                n == len ? done : NULL);
+        msg += n;
+        len -= n;
+    }
+#else
+    printQueueRingPut(msg, len, done);
+#endif
+}
+
+char *printQueueBufferGet(void)
+{
+    if (printQueueHeld < 0)
+    {
+        int32_t b = 0;
+        // the oldest queued buffer is the first to come back
+        while (printQueueBufferStates[b] != PRINT_QUEUE_BUFFER_FREE)
+        {
+            if (++b == PRINT_QUEUE_TX_BUFFERS)
+            {
+                b = 0;
+                printQueueWaitStep();
+            }
+        }
+        printQueueBufferStates[b] = PRINT_QUEUE_BUFFER_HELD;
+        printQueueHeld = b;
+    }
+    return (char *)printQueueBuffers[printQueueHeld];
+}
+
+void printQueueBufferSend(char *txBuffer, uint32_t len, volatile bool *done)
+{
+    int32_t b = printQueueBufferIndex(txBuffer);
+
+    if (b < 0 || b != printQueueHeld)
+    {
+        // not a buffer from printQueueBufferGet(): send a copy
+        printQueuePut(txBuffer, len, done);
+        return;
+    }
+    if (len > PRINT_QUEUE_TX_BUFFER_LEN)
+    {
+        len = PRINT_QUEUE_TX_BUFFER_LEN;
+    }
+    if (done != NULL)
+    {
+        *done = len == 0;
+    }
+    if (len == 0)
+    {
+        return;     // still held; the next get returns it again
+    }
+
+#if LOG_COMPRESS_ENABLE
+    // the coded bytes go out of the ring, so the buffer is free at once
+    printQueuePut(txBuffer, len, done);
+    printQueueHeld = -1;
+    printQueueBufferStates[b] = PRINT_QUEUE_BUFFER_FREE;
+    return;
+#endif
+
+    printQueueWaitSegments(1);
+    printQueueHeld = -1;
+    printQueueBufferStates[b] = PRINT_QUEUE_BUFFER_QUEUED;
+    printQueuePush(printQueueBuffers[b], len, 0, b, done);
+    printQueueKick();
+}
+
+void printQueueFlush(void)
+{
+    while (printQueueBusy == true || printQueueSegHead != printQueueSegSent)
+    {
+        printQueueWaitStep();
+    }
+}
+
+void printQueueFlushPolled(void)
+{
+#if USING_HW
+#if PRINT_QUEUE_FRAMES
+    // a fault in printQueueCrc32() must not keep the frames back
+    printQueueCrcHeld = false;
+#endif
+    while (printQueueBusy == true || printQueueSegHead != printQueueSegSent)
+    {
+        if (printQueueBusy == false)
+        {
+            printQueueStart();
+        }
+        printQueuePoll();
+    }
+#else
+    printQueueFlush();
+#endif
+}
+
+uint32_t printQueuePending(void)
+{
+    return printQueueByteHead - printQueueByteTail;
+}
+
+uint32_t printQueueErrors(void)
+{
+    return printQueueErrorCount;
+}
+
+uint32_t printQueueCrc32(const void *buffer, uint32_t length)
+{
+#if USING_HW
+    static const DMAC_CRC_SETUP setup = {
+        .polynomial_type = DMAC_CRC_TYPE_32,
+        .crc_mode = DMAC_CRC_MODE_DEFAULT,
+        .seed = 0xFFFFFFFF
+    };
+    uint32_t crc;
+
+#if PRINT_QUEUE_FRAMES
+    // the engine holds the running frame's CRC: let that frame finish and
+    // start no other until this is done
+    printQueueCrcHeld = true;
+    while (printQueueBusy == true)
+    {
+        printQueueWaitStep();
+    }
+#endif
+    crc = DMAC_CRCCalculate((void *)buffer, length, setup);
+#if PRINT_QUEUE_FRAMES
+    printQueueCrcHeld = false;
+    printQueueKick();
+#endif
+    return crc;
+#else
+    return ~printQueueCrcUpdate(0xFFFFFFFF, (const uint8_t *)buffer, length);
+#endif
+}
+
+void printQueueSimSinkRegister(printQueueSimSink sink)
+{
+#if USING_HW
+    (void)sink;
+#else
+    printQueueSink = sink;
+#endif
+}
+
+uint32_t printQueueSimRun(uint32_t maxBlocks)
+{
+#if USING_HW
+    (void)maxBlocks;
+    return 0;
+#else
+    uint32_t moved = 0;
+
+    while (moved < maxBlocks && printQueueSimDesc != NULL)
+    {
+        dmac_descriptor_registers_t *d = printQueueSimDesc;
+        const uint8_t *src = (const uint8_t *)(uintptr_t)
+                (d->DMAC_SRCADDR - d->DMAC_BTCNT);
+        if (printQueueSink != NULL)
+        {
+            printQueueSink(src, d->DMAC_BTCNT);
+        }
+#if PRINT_QUEUE_FRAMES
+        printQueueSimCrc = printQueueCrcUpdate(printQueueSimCrc, src,
+                d->DMAC_BTCNT);
+#endif
+        ++moved;
+
+        printQueueSimDesc = (dmac_descriptor_registers_t *)(uintptr_t)
+                d->DMAC_DESCADDR;
+        if (printQueueSimDesc == NULL)
+        {
+            printQueueComplete(DMAC_TRANSFER_EVENT_COMPLETE, 0);
+        }
+    }
+    return moved;
+#endif
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,220 @@
+/* ************************************************************************** */
+/** Non-blocking UART output queue
+
+  @File Name
+    printQueue.h
+
+  @Summary
+    Queues messages for the SERCOM5 UART and sends them with DMAC channel 0
+    as a chain of linked descriptors, so that a print returns at once.
+
+  @Description
+    printAndWait() used to start one DMA transfer and spin until it was
+    done, which at 115200 baud is about 87 us per character of CPU time.
+    It now queues the message and returns at once; printQueuePut() copies
+    it into a ring of PRINT_QUEUE_BYTES and waits only when that has no
+    room.
+
+    Each message is one segment of the ring (two if it wraps around the
+    end). When the DMA is idle, up to PRINT_QUEUE_DESCRIPTORS pending
+    segments are turned into descriptors linked through DESCADDR and sent
+    as one chain; only the last descriptor raises the transfer complete
+    interrupt. A chain is never changed while the DMAC runs it: messages
+    queued meanwhile wait for its completion interrupt, which frees the
+    ring space it used and starts the next chain from everything pending.
+
+    Callers may reuse their buffer as soon as printQueuePut() returns. The
+    done flag, if given, is set to false when the message is queued and to
+    true once its last byte has been handed to the UART.
+
+    To skip the copy, format into a buffer from printQueueBufferGet() and
+    pass it to printQueueBufferSend() (or printAndWait(), which sends pool
+    buffers this way). The buffer then belongs to the DMA, which sends it
+    from where it is; the completion handler gives it back to the pool.
+    With PRINT_QUEUE_TX_BUFFERS buffers the next message is formatted
+    while the previous ones are still going out, and only a get with
+    every buffer in flight waits. A buffer that is got but not sent stays
+    with the caller and is returned again by the next get.
+
+    Built with -DLOG_COMPRESS_ENABLE=1, every message is coded by
+    logCompress.h on its way into the ring, and the ring holds the coded
+    bytes; pool buffers are then coded and given back at once instead of
+    being sent from where they are. printQueuePending() counts coded
+    bytes.
+
+    Built with -DPRINT_QUEUE_FRAMES=1, each chain goes out as a frame: the
+    DMAC CRC engine takes its CRC-32 from channel 0 as the bytes pass, and
+    when the chain is done its completion handler queues a
+    PRINT_QUEUE_TRAILER_LEN byte trailer on a second channel, which the
+    engine does not see:
+
+        sync (PRINT_QUEUE_FRAME_SYNC0, _SYNC1)
+        frame sequence number (2 bytes, little-endian, from 0 at reset)
+        frame length (2 bytes, little-endian; the bytes since the last
+            trailer)
+        CRC-32 of the frame (4 bytes, little-endian; IEEE 802.3, as zlib)
+        check: the sum of the 10 bytes before it, inverted
+
+    host/logFrames.cpp finds the trailers and reports frames that are
+    missing or damaged. The CPU writes 11 bytes per frame and reads the
+    checksum register; it never touches the frame's bytes. The next chain
+    waits for the trailer, a few bytes' time.
+
+    The CRC engine is shared. printQueueCrc32() runs it for anyone else
+    (sweepFuncs.c's signature). With frames on, it first waits for the
+    running frame to finish, then holds the next one back until it is
+    done.
+
+    Without the hardware (USING_HW 0) the same descriptor chains are run
+    by a simulated DMAC: printQueueSimRun() walks the chain, passes each
+    block to the sink registered with printQueueSimSinkRegister(), and
+    calls the completion handler at the end of the chain. The waiting
+    functions run it themselves, so a host build sees the same output in
+    the same order as the board would send it.
+    ../host/simCheck.cpp builds this file that way and checks what the
+    sink gets.
+ */
+/* ************************************************************************** */
+
+#ifndef _PRINT_QUEUE_H    /* Guard against multiple inclusion */
+#define _PRINT_QUEUE_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* Bytes of queued output; a power of two */
+#define PRINT_QUEUE_BYTES 4096
+
+    /* Queued segments; each message takes one, or two if it wraps */
+#define PRINT_QUEUE_SEGMENTS 32
+
+    /* Descriptors, and so segments, in one DMA chain */
+#define PRINT_QUEUE_DESCRIPTORS 16
+
+    /* Buffers handed to the DMA without a copy, and their size: one being
+     * formatted into while the others are sent */
+#define PRINT_QUEUE_TX_BUFFERS 3
+#define PRINT_QUEUE_TX_BUFFER_LEN 2000
+
+#ifndef PRINT_QUEUE_FRAMES
+#define PRINT_QUEUE_FRAMES 0
+#endif
+
+    /* The trailer that ends each frame, and its first two bytes */
+#define PRINT_QUEUE_TRAILER_LEN 11
+#define PRINT_QUEUE_FRAME_SYNC0 0xC3
+#define PRINT_QUEUE_FRAME_SYNC1 0x3C
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* receives the bytes the simulated DMAC moves to the UART */
+typedef void (*printQueueSimSink)(const uint8_t *bytes, uint32_t len);
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* empty the queue and take over the DMAC channel 0 callback (and, with
+     * PRINT_QUEUE_FRAMES, allocate the trailer's channel); call once after
+     * SYS_Initialize() */
+void printQueueInit(void);
+
+    /**
+      @Function
+        void printQueuePut(const char *msg, uint32_t len, volatile bool *done)
+
+      @Summary
+        Copies len bytes of msg into the queue and starts sending them if
+        the DMA is idle.
+
+      @Remarks
+        Waits only while the queue is too full to take the message. done
+        may be NULL.
+     */
+void printQueuePut(const char *msg, uint32_t len, volatile bool *done);
+
+    /**
+      @Function
+        char *printQueueBufferGet(void)
+
+      @Summary
+        Returns a PRINT_QUEUE_TX_BUFFER_LEN byte buffer to format the next
+        message into.
+
+      @Remarks
+        Waits while every buffer is queued. Returns the same buffer until
+        it is sent. Thread use only.
+     */
+char *printQueueBufferGet(void);
+
+    /* queue len bytes of the buffer from printQueueBufferGet() without a
+     * copy; it must not be written again. Any other buffer is copied as
+     * by printQueuePut(). */
+void printQueueBufferSend(char *txBuffer, uint32_t len, volatile bool *done);
+
+    /* wait until every queued byte has been sent */
+void printQueueFlush(void);
+
+    /* printQueueFlush() for code running with interrupts masked or at a
+     * higher priority than the DMAC, such as a fault handler: polls the
+     * channel's completion flag instead of waiting for its interrupt */
+void printQueueFlushPolled(void);
+
+    /* bytes queued or being sent */
+uint32_t printQueuePending(void);
+
+    /* chains that ended with a DMAC transfer error; their bytes are lost */
+uint32_t printQueueErrors(void);
+
+    /* CRC-32 (IEEE 802.3) of length bytes on the DMAC CRC engine, which
+     * it shares with the frames; word beats if length is a multiple of 4
+     * and buffer is aligned. Thread use only. */
+uint32_t printQueueCrc32(const void *buffer, uint32_t length);
+
+    /* where the simulated DMAC writes; NULL discards the output */
+void printQueueSimSinkRegister(printQueueSimSink sink);
+
+    /* move up to maxBlocks descriptors of the running chain through the
+     * simulated DMAC; returns how many were moved. Does nothing on the
+     * hardware. */
+uint32_t printQueueSimRun(uint32_t maxBlocks);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PRINT_QUEUE_H */
+
+/* *****************************************************************************
+ End of File
+ */
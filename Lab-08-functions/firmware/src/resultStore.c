@@ -0,0 +1,316 @@
+/* ************************************************************************** */
+/** Cross-boot result store in SmartEEPROM
+
+  @File Name
+    resultStore.c
+
+  @Summary
+    Keeps a compact record of the last full test run in SmartEEPROM and
+    reports regressions against it on the next boot.
+
+  @Description
+    See resultStore.h for what is stored and what counts as a regression.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <string.h>
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "printFuncs.h"  // lab print funcs
+#include "resultStore.h"
+
+#define MAX_PRINT_LEN 400
+
+#ifndef USING_HW
+#define USING_HW 1
+#endif
+
+_Static_assert(sizeof(resultRecord) <= RESULT_STORE_NVM_SIZE,
+        "resultRecord does not fit in the SmartEEPROM area");
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint8_t storeTxBuffer[MAX_PRINT_LEN] = {0};
+
+const char * const resultTestNames[RESULT_NUM_GROUPS] = {
+    "asmUnpack", "asmAbs", "asmMult", "asmFixSign", "asmMain", "none",
+    "sweep", "fuzz", "diff"
+};
+
+#if !USING_HW
+uint8_t resultStoreSimNvm[RESULT_STORE_NVM_SIZE];
+volatile uint32_t resultStoreSimCycles = 0;
+#endif
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* FNV-1a step over one 32-bit word */
+static uint32_t resultStoreFold(uint32_t signature, uint32_t value)
+{
+    return (signature ^ value) * 16777619UL;
+}
+
+static uint32_t resultStoreChecksum(const resultRecord *r)
+{
+    const uint32_t *words = (const uint32_t *)r;
+    uint32_t checksum = 2166136261UL;
+    for (uint32_t i = 0; i < offsetof(resultRecord, checksum)/sizeof(uint32_t); ++i)
+    {
+        checksum = resultStoreFold(checksum, words[i]);
+    }
+    return checksum;
+}
+
+#if USING_HW
+/* true if the fuses have allocated any flash to SmartEEPROM */
+static bool resultStoreAvailable(void)
+{
+    return (NVMCTRL_REGS->NVMCTRL_SEESTAT & NVMCTRL_SEESTAT_SBLK_Msk) != 0;
+}
+#endif
+
+static void resultStoreReadNvm(resultRecord *r)
+{
+#if USING_HW
+    volatile const uint32_t *see = (volatile const uint32_t *)SEEPROM_ADDR;
+    uint32_t *words = (uint32_t *)r;
+    while (NVMCTRL_SmartEEPROM_IsBusy());
+    for (uint32_t i = 0; i < sizeof(*r)/sizeof(uint32_t); ++i)
+    {
+        words[i] = see[i];
+    }
+#else
+    memcpy(r, resultStoreSimNvm, sizeof(*r));
+#endif
+}
+
+static void resultStoreWriteNvm(const resultRecord *r)
+{
+#if USING_HW
+    volatile uint32_t *see = (volatile uint32_t *)SEEPROM_ADDR;
+    const uint32_t *words = (const uint32_t *)r;
+
+    if (NVMCTRL_SmartEEPROM_IsActiveSectorFull())
+    {
+        NVMCTRL_SmartEEPROMSectorReallocate();
+    }
+    for (uint32_t i = 0; i < sizeof(*r)/sizeof(uint32_t); ++i)
+    {
+        while (NVMCTRL_SmartEEPROM_IsBusy());
+        // unchanged words are skipped to save flash wear
+        if (see[i] != words[i])
+        {
+            see[i] = words[i];
+        }
+    }
+    while (NVMCTRL_SmartEEPROM_IsBusy());
+    NVMCTRL_SmartEEPROMFlushPageBuffer();
+    while (NVMCTRL_SmartEEPROM_IsBusy());
+#else
+    memcpy(resultStoreSimNvm, r, sizeof(*r));
+#endif
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void resultStoreInit(resultRecord *r, const int32_t *tc, uint32_t numCases)
+{
+#if USING_HW
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    memset(r, 0, sizeof(*r));
+    r->magic = RESULT_STORE_MAGIC;
+    r->version = RESULT_STORE_VERSION;
+    r->numCases = numCases;
+    r->corpusSignature = 2166136261UL;
+    for (uint32_t i = 0; i < numCases; ++i)
+    {
+        r->corpusSignature = resultStoreFold(r->corpusSignature, (uint32_t)tc[i]);
+    }
+}
+
+uint32_t resultStoreCycles(void)
+{
+#if USING_HW
+    return DWT->CYCCNT;
+#else
+    return resultStoreSimCycles;
+#endif
+}
+
+void resultStoreAddCase(resultRecord *r,
+        resultTestId test,
+        uint32_t testCase,
+        int32_t failCount,
+        uint32_t cycles)
+{
+    resultEntry *e = &r->entry[test];
+
+    ++e->casesRun;
+    if (cycles == RESULT_STORE_UNTIMED)
+    {
+        ++e->untimed;
+    }
+    else
+    {
+        e->cycles += cycles;
+    }
+    if (failCount != 0)
+    {
+        e->failCount += failCount;
+        // summed, not folded, so the schedule may run cases in any order
+        e->signature += resultStoreFold(resultStoreFold(2166136261UL, testCase),
+                failCount);
+    }
+}
+
+bool resultStoreLoad(resultRecord *r)
+{
+#if USING_HW
+    if (resultStoreAvailable() == false)
+    {
+        return false;
+    }
+#endif
+    resultStoreReadNvm(r);
+    return r->magic == RESULT_STORE_MAGIC &&
+            r->version == RESULT_STORE_VERSION &&
+            r->checksum == resultStoreChecksum(r);
+}
+
+void resultStoreSave(const resultRecord *current, const resultRecord *previous)
+{
+    resultRecord r = *current;
+
+#if USING_HW
+    if (resultStoreAvailable() == false)
+    {
+        return;
+    }
+#endif
+    if (previous != NULL && previous->corpusSignature == current->corpusSignature)
+    {
+        for (uint32_t test = 0; test < RESULT_NUM_TESTS; ++test)
+        {
+            if (r.entry[test].casesRun != r.numCases)
+            {
+                r.entry[test] = previous->entry[test];
+            }
+        }
+    }
+    r.checksum = resultStoreChecksum(&r);
+    resultStoreWriteNvm(&r);
+}
+
+uint32_t resultStoreReport(const resultRecord *previous,
+        const resultRecord *current,
+        volatile bool *txComplete)
+{
+    uint32_t regressions = 0;
+
+#if USING_HW
+    if (resultStoreAvailable() == false)
+    {
+        printAndWait("========= RESULT STORE: SmartEEPROM is not enabled "
+                "(NVMCTRL_SEESBLK fuse is 0); nothing stored\r\n\r\n",
+                txComplete);
+        return 0;
+    }
+#endif
+    if (previous == NULL)
+    {
+        printAndWait("========= RESULT STORE: no results from a previous boot; "
+                "storing these as the baseline\r\n\r\n",
+                txComplete);
+        return 0;
+    }
+    if (previous->corpusSignature != current->corpusSignature)
+    {
+        printAndWait("========= RESULT STORE: test vectors changed since the "
+                "last boot; storing these as the new baseline\r\n\r\n",
+                txComplete);
+        return 0;
+    }
+
+    for (uint32_t test = 0; test < RESULT_NUM_TESTS; ++test)
+    {
+        const resultEntry *was = &previous->entry[test];
+        const resultEntry *now = &current->entry[test];
+
+        // nothing to compare unless the group ran every case both times
+        if (was->casesRun != previous->numCases ||
+                now->casesRun != current->numCases)
+        {
+            continue;
+        }
+
+        if (now->failCount > was->failCount)
+        {
+            snprintf((char*)storeTxBuffer, MAX_PRINT_LEN,
+                    "REGRESSION: %s: %lu failed checks, was %lu\r\n",
+                    resultTestNames[test], now->failCount, was->failCount);
+            printAndWait((char*)storeTxBuffer, txComplete);
+            ++regressions;
+        }
+        else if (now->failCount == was->failCount &&
+                now->signature != was->signature)
+        {
+            snprintf((char*)storeTxBuffer, MAX_PRINT_LEN,
+                    "REGRESSION: %s: %lu failed checks as before, "
+                    "but in different test cases\r\n",
+                    resultTestNames[test], now->failCount);
+            printAndWait((char*)storeTxBuffer, txComplete);
+            ++regressions;
+        }
+
+        // a total missing some cases is not comparable
+        if (now->untimed == 0 && was->untimed == 0 &&
+                (uint64_t)now->cycles * 100 >
+                (uint64_t)was->cycles * (100 + RESULT_STORE_CYCLE_TOLERANCE_PCT))
+        {
+            snprintf((char*)storeTxBuffer, MAX_PRINT_LEN,
+                    "REGRESSION: %s: %lu cycles, was %lu\r\n",
+                    resultTestNames[test], now->cycles, was->cycles);
+            printAndWait((char*)storeTxBuffer, txComplete);
+            ++regressions;
+        }
+    }
+
+    snprintf((char*)storeTxBuffer, MAX_PRINT_LEN,
+            "========= RESULT STORE: %lu regressions since the last boot\r\n"
+            "\r\n",
+            regressions);
+    printAndWait((char*)storeTxBuffer, txComplete);
+    return regressions;
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,204 @@
+/* ************************************************************************** */
+/** Cross-boot result store in SmartEEPROM
+
+  @File Name
+    resultStore.h
+
+  @Summary
+    Keeps a compact record of the last full test run in SmartEEPROM and
+    reports regressions against it on the next boot.
+
+  @Description
+    For each test group (asmUnpack, asmAbs, ...) the record holds the number
+    of cases run, the number of failed checks, a signature folded from which
+    cases failed, and the total CPU cycles spent inside the asm calls (from
+    the DWT cycle counter). After the first full run following a boot, main.c
+    compares the new record against the stored one and prints only the
+    groups that got worse. Only groups that ran every case both times are
+    compared, so a group cut short by fail-fast mode is ignored:
+      - correctness: more failed checks, or the same number of failures in
+        different cases
+      - performance: more than RESULT_STORE_CYCLE_TOLERANCE_PCT percent
+        more cycles
+    and then stores the new record. Groups that were skipped or cut short in
+    this run keep their stored values.
+
+    SmartEEPROM needs the NVMCTRL_SEESBLK and NVMCTRL_SEEPSZ fuses set (see
+    config/sam_e51_cnano/initialization.c). When USING_HW is 0 the store is
+    a RAM array, resultStoreSimNvm, and the cycle counter is
+    resultStoreSimCycles. ../host/simCheck.cpp copies the array out and
+    back in to simulate a reboot, and advances the counter to simulate
+    slow code.
+ */
+/* ************************************************************************** */
+
+#ifndef _RESULT_STORE_H    /* Guard against multiple inclusion */
+#define _RESULT_STORE_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* first word of a valid record: "LB08" */
+#define RESULT_STORE_MAGIC 0x4C423038UL
+
+    /* bump when resultRecord, or what it measures, changes so old records
+     * are ignored. 3: cycles include the aapcsCall.s wrapper. 4: cycles
+     * are the calls alone (aapcsLastCycles()). 5: untimed */
+#define RESULT_STORE_VERSION 5
+
+    /* a group is reported as slower only if it takes more than this many
+     * percent extra cycles, so flash cache noise is not reported */
+#define RESULT_STORE_CYCLE_TOLERANCE_PCT 5
+
+    /* the cycles of a case whose call an interrupt landed in, which would
+     * count the handler too (see aapcsLastCycles()) */
+#define RESULT_STORE_UNTIMED 0xFFFFFFFFUL
+
+    /* bytes of SmartEEPROM used by the store; must not exceed the virtual
+     * size selected by the fuses (512 bytes for SEESBLK = 1, SEEPSZ = 0) */
+#define RESULT_STORE_NVM_SIZE 512
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* one entry per test group, in the order main.c runs them. The modes
+     * after RESULT_NUM_TESTS store no results; they are groups only to
+     * TEST_GUARD_CALL() and the fault log, and their test case is the
+     * packed value the call was given. */
+typedef enum
+{
+    RESULT_UNPACK = 0,
+    RESULT_ABS,
+    RESULT_MULT,
+    RESULT_FIXSIGN,
+    RESULT_MAIN,
+    RESULT_NUM_TESTS,   // also "no test"
+    RESULT_MODE_SWEEP,
+    RESULT_MODE_FUZZ,
+    RESULT_MODE_DIFF,
+    RESULT_NUM_GROUPS
+} resultTestId;
+
+    /* true for a mode's group */
+#define RESULT_IS_MODE(group) \
+    ((group) > RESULT_NUM_TESTS && (group) < RESULT_NUM_GROUPS)
+
+typedef struct _resultEntry
+{
+    uint32_t casesRun;   // test cases run; less than numCases if the group
+                         // was skipped or stopped early
+    uint32_t failCount;  // failed checks over all cases
+    uint32_t signature;  // sum of hash{case number, failed checks} over failing
+                         // cases, so it does not depend on the run order
+    uint32_t cycles;     // CPU cycles spent inside the asm calls
+    uint32_t untimed;    // cases left out of cycles: an interrupt was
+                         // taken during one of their calls
+} resultEntry;
+
+typedef struct _resultRecord
+{
+    uint32_t magic;            // RESULT_STORE_MAGIC
+    uint32_t version;          // RESULT_STORE_VERSION
+    uint32_t corpusSignature;  // fold of the tc[] values the run used
+    uint32_t numCases;         // number of tc[] values
+    resultEntry entry[RESULT_NUM_TESTS];
+    uint32_t checksum;         // fold of every word above
+} resultRecord;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* names of the test groups and modes, indexed by resultTestId */
+extern const char * const resultTestNames[RESULT_NUM_GROUPS];
+
+    /* start the DWT cycle counter and clear r for a new run on the corpus
+     * of numCases packed values in tc */
+void resultStoreInit(resultRecord *r, const int32_t *tc, uint32_t numCases);
+
+    /* current value of the free-running CPU cycle counter */
+uint32_t resultStoreCycles(void);
+
+    /* add one test case's outcome to a group's entry; cycles may be
+     * RESULT_STORE_UNTIMED */
+void resultStoreAddCase(resultRecord *r,
+        resultTestId test,
+        uint32_t testCase,
+        int32_t failCount,
+        uint32_t cycles);
+
+    /* read the stored record. Returns false if there is none, or it is
+     * corrupt or from a different RESULT_STORE_VERSION. */
+bool resultStoreLoad(resultRecord *r);
+
+    /* write current to the store. Any group that did not run every case
+     * in current keeps its entry from previous, which may be NULL. */
+void resultStoreSave(const resultRecord *current, const resultRecord *previous);
+
+    /**
+      @Function
+        uint32_t resultStoreReport(const resultRecord *previous,
+                                   const resultRecord *current,
+                                   volatile bool *txComplete)
+
+      @Summary
+        Prints the groups that regressed between previous and current.
+
+      @Parameters
+        @param previous  record loaded at boot, or NULL if there was none
+
+      @Returns
+        The number of regressions printed.
+     */
+uint32_t resultStoreReport(const resultRecord *previous,
+        const resultRecord *current,
+        volatile bool *txComplete);
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Simulator hooks (only defined when USING_HW is 0)
+    // *****************************************************************************
+    // *****************************************************************************
+
+extern uint8_t resultStoreSimNvm[RESULT_STORE_NVM_SIZE];
+extern volatile uint32_t resultStoreSimCycles;
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RESULT_STORE_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,272 @@
+/* ************************************************************************** */
+/** MPU sandbox for the functions under test
+
+  @File Name
+    sandbox.c
+
+  @Summary
+    Runs each guarded asm call unprivileged with the MPU on, so that a store
+    anywhere except the stack and the asm output variables traps.
+
+  @Description
+    See sandbox.h for the region layout.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "asmExterns.h"
+#include "faultCapture.h"
+#include "excEntry.h"
+#include "sandbox.h"
+
+#define USING_HW 1
+
+/* immediate of the one SVC that regains privilege; see sandboxLeave() */
+#define SANDBOX_SVC_LEAVE 0x53
+#define SANDBOX_STR(x) SANDBOX_XSTR(x)
+#define SANDBOX_XSTR(x) #x
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static bool sandboxEnabled = false;
+static volatile bool sandboxRunning = false;
+
+/* stack pointer the stack regions were last computed for */
+static uint32_t sandboxStackSp = 0;
+
+/* extra regions handed out by sandboxAllow() for the next call */
+static uint32_t sandboxExtraUsed = 0;
+
+/* set by sandboxDeferDrop() for the next sandboxBegin() */
+static bool sandboxDropDeferred = false;
+
+/* sandboxBegin() left the drop to unprivileged to aapcsCall() */
+volatile bool sandboxDropPending = false;
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#if USING_HW
+/* writable, never executable, normal memory of 2^(sizeLog2) bytes */
+#define SANDBOX_RASR_RW(sizeLog2) \
+    ARM_MPU_RASR(1, ARM_MPU_AP_FULL, 0, 0, 1, 1, 0, (sizeLog2) - 1)
+
+/* Cover [start, start + len) with at most maxRegions aligned blocks of one
+ * power-of-two size, the smallest that works, starting at region number
+ * region. Unused regions of the allowance are disabled. Returns the number
+ * of regions used. */
+static uint32_t sandboxCover(uint32_t region,
+        uint32_t maxRegions,
+        uint32_t start,
+        uint32_t len)
+{
+    uint32_t last = start + len - 1;
+    uint32_t used = 0;
+
+    for (uint32_t sizeLog2 = 5; sizeLog2 < 32; ++sizeLog2)
+    {
+        uint32_t base = start >> sizeLog2;
+        uint32_t blocks = (last >> sizeLog2) - base + 1;
+        if (blocks <= maxRegions)
+        {
+            for (used = 0; used < blocks; ++used)
+            {
+                ARM_MPU_SetRegion(
+                        ARM_MPU_RBAR(region + used, (base + used) << sizeLog2),
+                        SANDBOX_RASR_RW(sizeLog2));
+            }
+            break;
+        }
+    }
+    for (uint32_t r = used; r < maxRegions; ++r)
+    {
+        ARM_MPU_ClrRegion(region + r);
+    }
+    return used;
+}
+
+/* The only way back to privileged thread mode. The label marks the
+ * return address SVCall_Handler() expects on the stack. */
+__attribute__((naked, noinline)) void sandboxLeave(void)
+{
+    __asm volatile (
+        "    svc    #" SANDBOX_STR(SANDBOX_SVC_LEAVE) "   \n"
+        "sandboxLeaveReturn:            \n"
+        "    bx     lr                  \n"
+    );
+}
+
+extern const uint16_t sandboxLeaveReturn[];
+
+/* where sandboxLeave() may return to: after its calls in sandboxEnd() and
+ * in aapcsCall.s */
+extern const uint16_t sandboxEndReturn[];
+extern const uint16_t aapcsLeaveReturn[];
+
+/* called from SVCall_Handler with the caller's frame. The code under test
+ * runs unprivileged too and can issue SVC itself, or call sandboxLeave():
+ * only the SVC in sandboxLeave(), called by the runner, returns
+ * privilege, and any other ends the guarded call as a fault. */
+__attribute__((used)) static void sandboxSvc(uint32_t *frame)
+{
+    // stacked frame: r0, r1, r2, r3, r12, lr, pc, xpsr; pc follows the SVC
+    const uint16_t *pc = (const uint16_t *)frame[6];
+    const uint16_t *lr = (const uint16_t *)(frame[5] & ~1UL);
+
+    if (pc == sandboxLeaveReturn && (pc[-1] & 0xFF) == SANDBOX_SVC_LEAVE &&
+            (lr == sandboxEndReturn || lr == aapcsLeaveReturn))
+    {
+        __set_CONTROL(__get_CONTROL() & ~CONTROL_nPRIV_Msk);
+        return;
+    }
+    if (sandboxRunning == true)
+    {
+        faultRecoverSandbox(frame, FAULT_TYPE_SVC);
+    }
+}
+
+__attribute__((naked)) void SVCall_Handler(void)
+{
+    EXC_ENTRY(sandboxSvc, "");
+}
+#endif
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void sandboxInit(bool enabled)
+{
+    sandboxEnabled = enabled;
+#if USING_HW
+    MPU->CTRL = 0;
+
+    // flash and SRAM: read and execute for everyone, write for privileged
+    // code only. Peripherals are not mapped for unprivileged code.
+    ARM_MPU_SetRegion(ARM_MPU_RBAR(SANDBOX_REGION_BACKGROUND, 0x00000000),
+            ARM_MPU_RASR(0, ARM_MPU_AP_URO, 0, 0, 1, 1, 0,
+                    ARM_MPU_REGION_SIZE_1GB));
+
+    // the asm output variables are declared in order in asmMult.s
+    uint32_t first = (uint32_t)&a_Multiplicand;
+    uint32_t last = (uint32_t)&final_Product + sizeof(final_Product);
+    sandboxCover(SANDBOX_REGION_GLOBALS, 2, first, last - first);
+
+    for (uint32_t r = SANDBOX_REGION_STACK; r < SANDBOX_NUM_REGIONS; ++r)
+    {
+        ARM_MPU_ClrRegion(r);
+    }
+    sandboxStackSp = 0;
+    sandboxExtraUsed = 0;
+#endif
+}
+
+void sandboxDeferDrop(void)
+{
+    sandboxDropDeferred = true;
+}
+
+bool sandboxAllow(const volatile void *addr, uint32_t len)
+{
+#if USING_HW
+    if (sandboxExtraUsed >= SANDBOX_NUM_REGIONS - SANDBOX_REGION_EXTRA)
+    {
+        return false;
+    }
+    sandboxExtraUsed += sandboxCover(SANDBOX_REGION_EXTRA + sandboxExtraUsed,
+            1, (uint32_t)addr, len);
+#endif
+    return true;
+}
+
+void sandboxBegin(void)
+{
+    if (sandboxEnabled == false)
+    {
+        return;
+    }
+#if USING_HW
+    uint32_t sp = __get_MSP();
+    if (sp != sandboxStackSp)
+    {
+        sandboxCover(SANDBOX_REGION_STACK, 2, sp - SANDBOX_STACK_BELOW,
+                SANDBOX_STACK_BELOW + SANDBOX_STACK_ABOVE);
+        sandboxStackSp = sp;
+    }
+
+    sandboxRunning = true;
+    __DMB();
+    MPU->CTRL = MPU_CTRL_PRIVDEFENA_Msk | MPU_CTRL_ENABLE_Msk;
+    if (sandboxDropDeferred == true)
+    {
+        sandboxDropPending = true;
+    }
+    else
+    {
+        __set_CONTROL(__get_CONTROL() | CONTROL_nPRIV_Msk);
+    }
+    __DSB();
+    __ISB();
+#endif
+}
+
+/* not inlined: the label must exist once */
+__attribute__((noinline)) void sandboxEnd(void)
+{
+#if USING_HW
+    if ((__get_CONTROL() & CONTROL_nPRIV_Msk) != 0)
+    {
+        // sandboxLeave() keeps every register but lr
+        __asm volatile (
+            "    bl     sandboxLeave    \n"
+            "sandboxEndReturn:          \n"
+            ::: "lr", "memory"
+        );
+    }
+    sandboxDropDeferred = false;
+    sandboxDropPending = false;
+    if (sandboxRunning == false && sandboxExtraUsed == 0)
+    {
+        return;
+    }
+    __DMB();
+    MPU->CTRL = 0;
+    __DSB();
+    __ISB();
+    for (uint32_t r = 0; r < sandboxExtraUsed; ++r)
+    {
+        ARM_MPU_ClrRegion(SANDBOX_REGION_EXTRA + r);
+    }
+    sandboxExtraUsed = 0;
+    sandboxRunning = false;
+#endif
+}
+
+bool sandboxActive(void)
+{
+    return sandboxRunning;
+}
+
+/* *****************************************************************************
+ End of File
+ */
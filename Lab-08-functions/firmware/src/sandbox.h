@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/** MPU sandbox for the functions under test
+
+  @File Name
+    sandbox.h
+
+  @Summary
+    Runs each guarded asm call unprivileged with the MPU on, so that a store
+    anywhere except the stack and the asm output variables traps.
+
+  @Description
+    While a call runs, the MPU allows:
+      - reads and instruction fetches from flash and SRAM (region 0),
+      - writes to the asm output variables, a_Multiplicand through
+        final_Product in asmMult.s (regions 1-2),
+      - writes to a window of SANDBOX_STACK_BELOW bytes below and
+        SANDBOX_STACK_ABOVE bytes above the caller's stack pointer, which
+        covers the callee's pushes and the caller's out-pointer targets
+        (regions 3-4),
+      - writes to anything passed to sandboxAllow() for this call
+        (regions 5-7).
+    Everything else, including the peripherals, faults. Regions are rounded
+    out to power-of-two blocks (at least 32 bytes), so a store just beside
+    an allowed variable may not be caught.
+
+    The MPU is only enabled for the duration of the call; interrupt handlers
+    stay privileged and keep the default memory map. A blocked access
+    raises MemManage; faultCapture.c records the faulting PC and the address
+    (MMFAR) and unwinds to TEST_GUARD_CALL(), which reports FAULT. Nothing
+    was written, so no reset is needed.
+
+    A call made through aapcsCall() (aapcsCheck.h) drops to unprivileged
+    itself, just before its BLX, and regains privilege through
+    sandboxLeave() just after, so that it can read the DWT cycle counter
+    on both sides: the PPB is out of reach of unprivileged code.
+    aapcsPrepare() asks for that with sandboxDeferDrop().
+
+    The constant regions are programmed once by sandboxInit(); per call only
+    the two stack regions are recomputed, and only when the stack pointer
+    has moved. sandboxEnd() regains privilege with an SVC that
+    SVCall_Handler() recognizes by its return address and immediate; any
+    other SVC, such as one the code under test issues itself, is reported
+    as TEST_GUARD_FAULT.
+
+    When USING_HW is 0 the sandbox does nothing.
+ */
+/* ************************************************************************** */
+
+#ifndef _SANDBOX_H    /* Guard against multiple inclusion */
+#define _SANDBOX_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* writable stack window around the caller's stack pointer */
+#define SANDBOX_STACK_BELOW 1024
+#define SANDBOX_STACK_ABOVE 512
+
+    /* MPU region numbers; higher numbers take priority where they overlap */
+#define SANDBOX_REGION_BACKGROUND 0
+#define SANDBOX_REGION_GLOBALS    1   // 2 regions
+#define SANDBOX_REGION_STACK      3   // 2 regions
+#define SANDBOX_REGION_EXTRA      5   // 3 regions
+#define SANDBOX_NUM_REGIONS       8
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* program the constant regions. If enabled is false, guarded calls run
+     * privileged with the MPU off, as before. */
+void sandboxInit(bool enabled);
+
+    /* also allow writes to len bytes at addr during the next guarded call.
+     * Returns false if all the extra regions are in use. */
+bool sandboxAllow(const volatile void *addr, uint32_t len);
+
+    /* make the next sandboxBegin() leave the drop to unprivileged to
+     * aapcsCall(): it sets sandboxDropPending instead */
+void sandboxDeferDrop(void);
+
+    /* enable the MPU and drop to unprivileged; called by testGuardBegin() */
+void sandboxBegin(void);
+
+    /* true while sandboxBegin() has left the drop to aapcsCall(); read by
+     * aapcsCall.s */
+extern volatile bool sandboxDropPending;
+
+    /* regain privilege with the sandbox's SVC; for aapcsCall.s, which
+     * calls it unprivileged after the function under test returns. The
+     * SVC is refused from any other caller but sandboxEnd(). */
+void sandboxLeave(void);
+
+    /* regain privilege, disable the MPU and clear the extra regions and
+     * any deferred drop; safe to call when the sandbox is not active */
+void sandboxEnd(void);
+
+    /* true between sandboxBegin() and sandboxEnd() */
+bool sandboxActive(void);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SANDBOX_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,245 @@
+/* ************************************************************************** */
+/** Shrinking of failing packed inputs
+
+  @File Name
+    shrinkFuncs.c
+
+  @Summary
+    Turns a failing packed value found by the fuzz or sweep mode into the
+    simplest packed value that still fails, and prints both.
+
+  @Description
+    See shrinkFuncs.h.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <string.h>
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "printFuncs.h"  // lab print funcs
+#include "shrinkFuncs.h"
+#include "fuzzFuncs.h"
+#include "testVectors.h"
+
+#define MAX_PRINT_LEN 600
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint8_t shrinkTxBuffer[MAX_PRINT_LEN] = {0};
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static inline uint32_t shrinkPack(int32_t a, int32_t b)
+{
+    return ((uint32_t)(uint16_t)a << 16) | (uint16_t)b;
+}
+
+static uint32_t shrinkBitCount(uint32_t x)
+{
+    uint32_t n = 0;
+    for (; x != 0; x &= x - 1)
+    {
+        ++n;
+    }
+    return n;
+}
+
+/* true if x is simpler than y: smaller |A| + |B|, then fewer negative
+ * lanes, then fewer set bits */
+static bool shrinkSimpler(uint32_t x, uint32_t y)
+{
+    int32_t magX = TV_ABS(TV_A(x)) + TV_ABS(TV_B(x));
+    int32_t magY = TV_ABS(TV_A(y)) + TV_ABS(TV_B(y));
+    if (magX != magY)
+    {
+        return magX < magY;
+    }
+    int32_t negX = TV_SIGN(TV_A(x)) + TV_SIGN(TV_B(x));
+    int32_t negY = TV_SIGN(TV_A(y)) + TV_SIGN(TV_B(y));
+    if (negX != negY)
+    {
+        return negX < negY;
+    }
+    return shrinkBitCount(x) < shrinkBitCount(y);
+}
+
+/* stillFails() for value; false, and the shrink stops, if its call timed
+ * out or faulted */
+static bool shrinkTry(uint32_t value, shrinkStillFails stillFails,
+        void *context, shrinkResult *r)
+{
+    testGuardStatus status;
+    bool fails = stillFails(value, context, &status);
+
+    if (status != TEST_GUARD_OK)
+    {
+        r->guardStatus = status;
+        r->guardInput = value;
+        return false;
+    }
+    return fails;
+}
+
+/* candidate number k for a lane holding v, simplest kinds first; false
+ * once k is past the last one */
+static bool shrinkCandidate(int32_t v, uint32_t k, int32_t *candidate)
+{
+    if (k == 0)
+    {
+        *candidate = 0;
+    }
+    else if (k == 1)
+    {
+        // -0x8000 has no positive twin in a lane
+        *candidate = (v < 0 && v != -0x8000) ? -v : v;
+    }
+    else if (k == 2)
+    {
+        *candidate = v / 2;
+    }
+    else if (k < 3 + 16)
+    {
+        *candidate = (int16_t)((uint16_t)v & ~(1u << (k - 3)));
+    }
+    else if (k == 3 + 16)
+    {
+        *candidate = v > 0 ? v - 1 : (v < 0 ? v + 1 : 0);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+uint32_t shrinkPacked(uint32_t original,
+        shrinkStillFails stillFails,
+        void *context,
+        shrinkResult *r)
+{
+    uint32_t best = original;
+    bool progress = true;
+
+    r->original = original;
+    r->tries = 0;
+    r->guardStatus = TEST_GUARD_OK;
+    r->guardInput = 0;
+
+    while (progress == true && r->tries < SHRINK_MAX_TRIES &&
+            r->guardStatus == TEST_GUARD_OK)
+    {
+        progress = false;
+        for (uint32_t lane = 0; lane < 2 && progress == false; ++lane)
+        {
+            int32_t v = lane == 0 ? TV_A(best) : TV_B(best);
+            int32_t c;
+            for (uint32_t k = 0; progress == false &&
+                    r->tries < SHRINK_MAX_TRIES &&
+                    r->guardStatus == TEST_GUARD_OK &&
+                    shrinkCandidate(v, k, &c) == true; ++k)
+            {
+                uint32_t next = lane == 0 ? shrinkPack(c, TV_B(best)) :
+                        shrinkPack(TV_A(best), c);
+                if (shrinkSimpler(next, best) == false)
+                {
+                    continue;
+                }
+                ++r->tries;
+                if (shrinkTry(next, stillFails, context, r) == true)
+                {
+                    best = next;
+                    progress = true;
+                }
+            }
+        }
+    }
+    r->shrunk = best;
+
+    // hold each lane and vary the other
+    uint32_t state = original ^ 0x9E3779B9UL;
+    if (state == 0)
+    {
+        state = 0x2545F491;     // xorshift must not start at 0
+    }
+    r->failsWithA = 0;
+    r->failsWithB = 0;
+    for (uint32_t i = 0; i < SHRINK_GENERALIZE_TRIES &&
+            r->guardStatus == TEST_GUARD_OK; ++i)
+    {
+        uint32_t other = fuzzPackedValue(&state);
+        if (shrinkTry(shrinkPack(TV_A(best), TV_B(other)), stillFails,
+                context, r) == true)
+        {
+            ++r->failsWithA;
+        }
+        if (r->guardStatus == TEST_GUARD_OK &&
+                shrinkTry(shrinkPack(TV_A(other), TV_B(best)), stillFails,
+                context, r) == true)
+        {
+            ++r->failsWithB;
+        }
+    }
+    return best;
+}
+
+void shrinkPrint(const char *mode,
+        const shrinkResult *r,
+        volatile bool *txComplete)
+{
+    snprintf((char*)shrinkTxBuffer, MAX_PRINT_LEN,
+            "========= SHRINK %s failure 0x%08lx (A = %ld, B = %ld)\r\n"
+            "simplest reproducer: 0x%08lx (A = %ld, B = %ld) after %lu tries\r\n"
+            "A = 0x%04lx held: %lu of %d other B values fail%s\r\n"
+            "B = 0x%04lx held: %lu of %d other A values fail%s\r\n"
+            "\r\n",
+            mode, r->original, TV_A(r->original), TV_B(r->original),
+            r->shrunk, TV_A(r->shrunk), TV_B(r->shrunk), r->tries,
+            r->shrunk >> 16, r->failsWithA, SHRINK_GENERALIZE_TRIES,
+            r->failsWithA == SHRINK_GENERALIZE_TRIES ?
+                    ": fails whenever A is this value" : "",
+            r->shrunk & 0xFFFF, r->failsWithB, SHRINK_GENERALIZE_TRIES,
+            r->failsWithB == SHRINK_GENERALIZE_TRIES ?
+                    ": fails whenever B is this value" : "");
+    printAndWait((char*)shrinkTxBuffer, txComplete);
+
+    if (r->guardStatus != TEST_GUARD_OK)
+    {
+        snprintf((char*)shrinkTxBuffer, MAX_PRINT_LEN,
+                "shrink stopped: 0x%08lx (A = %ld, B = %ld) %s\r\n"
+                "\r\n",
+                r->guardInput, TV_A(r->guardInput), TV_B(r->guardInput),
+                r->guardStatus == TEST_GUARD_TIMEOUT ?
+                        "timed out" : "faulted");
+        printAndWait((char*)shrinkTxBuffer, txComplete);
+    }
+}
+
+/* *****************************************************************************
+ End of File
+ */
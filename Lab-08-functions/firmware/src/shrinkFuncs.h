@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/** Shrinking of failing packed inputs
+
+  @File Name
+    shrinkFuncs.h
+
+  @Summary
+    Turns a failing packed value found by the fuzz or sweep mode into the
+    simplest packed value that still fails, and prints both.
+
+  @Description
+    A random failure like 0xC3A1F07E says little about the bug. The shrink
+    step tries, one lane at a time, simpler values for the multiplicand
+    and the multiplier:
+      - 0
+      - the lane with its sign flipped, if it is negative
+      - half the lane, rounded towards 0
+      - the lane with one of its 16 bits cleared
+      - the lane one step closer to 0
+    and keeps the first that still fails and is simpler: a smaller
+    |A| + |B|, then fewer negative lanes, then fewer set bits. It starts
+    again from the new value until nothing simpler fails, in the manner of
+    delta debugging.
+
+    Then each lane of the result is held while the other is set to
+    SHRINK_GENERALIZE_TRIES generated values. A lane that fails with every
+    one of them is reported as failing on its own, which turns the random
+    0xC3A1F07E into "fails whenever B = 0x8000".
+
+    The predicate makes its calls through TEST_GUARD_CALL() under the
+    caller's mode group. The shrink stops at the first value whose call
+    times out or faults and keeps it in the result, for the caller to
+    report with testGuardPrintFailure(); the values tried before it stand.
+ */
+/* ************************************************************************** */
+
+#ifndef _SHRINK_FUNCS_H    /* Guard against multiple inclusion */
+#define _SHRINK_FUNCS_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "testGuard.h"
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* Calls of the predicate a shrink may make before it settles for the
+     * simplest value found so far */
+#define SHRINK_MAX_TRIES 4000
+
+    /* Other-lane values tried with each lane of the shrunk value held */
+#define SHRINK_GENERALIZE_TRIES 16
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* true if packedValue still shows the failure being shrunk; sets
+     * status to how its guarded calls ended, and is not believed unless
+     * that is TEST_GUARD_OK */
+typedef bool (*shrinkStillFails)(uint32_t packedValue, void *context,
+        testGuardStatus *status);
+
+typedef struct _shrinkResult
+{
+    uint32_t original;         // the failing packed value given
+    uint32_t shrunk;           // the simplest failing value found
+    uint32_t tries;            // predicate calls made while shrinking
+    uint32_t failsWithA;       // of SHRINK_GENERALIZE_TRIES multipliers
+                               // tried with the shrunk A, how many failed
+    uint32_t failsWithB;       // the same for the shrunk B
+    testGuardStatus guardStatus;  // TEST_GUARD_OK, or how the call that
+                               // stopped the shrink ended
+    uint32_t guardInput;       // the packed value of that call
+} shrinkResult;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* shrink original, which must fail, and fill r; returns r->shrunk */
+uint32_t shrinkPacked(uint32_t original,
+        shrinkStillFails stillFails,
+        void *context,
+        shrinkResult *r);
+
+    /* print r; mode names the run that found the failure ("fuzz", ...) */
+void shrinkPrint(const char *mode,
+        const shrinkResult *r,
+        volatile bool *txComplete);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SHRINK_FUNCS_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,220 @@
+/* ************************************************************************** */
+/** Exhaustive sweep of the packed input space
+
+  @File Name
+    sweepFuncs.c
+
+  @Summary
+    Runs every 32-bit packed input through asmMain and folds the results
+    into a CRC signature.
+
+  @Description
+    See sweepFuncs.h for the signature definition.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <string.h>
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "asmExterns.h"
+#include "printFuncs.h"  // lab print funcs
+#include "printQueue.h"
+#include "sweepFuncs.h"
+#include "shrinkFuncs.h"
+#include "testVectors.h"
+#include "testGuard.h"
+
+#define MAX_PRINT_LEN 400
+
+#define USING_HW 1
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint8_t sweepTxBuffer[MAX_PRINT_LEN] = {0};
+
+/* asmMain results waiting to be CRC'd. Word aligned so the CRC engine
+ * can consume them with word beats. */
+static uint32_t sweepBlock[SWEEP_BLOCK_LEN] __attribute__((aligned(4)));
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* standard CRC-32 (IEEE 802.3), seeded with 0xFFFFFFFF. The print queue
+ * shares the DMAC CRC engine with its frames, so it runs it; the simulator
+ * gets the same value bit by bit. */
+static uint32_t sweepCrc32(const void *buffer, uint32_t length)
+{
+    return printQueueCrc32(buffer, length);
+}
+
+/* CRC the collected block and fold it into the running signature */
+static uint32_t sweepFold(uint32_t signature, uint32_t blockLen)
+{
+    uint32_t fold[2];
+
+    fold[0] = signature;
+    fold[1] = sweepCrc32(sweepBlock, blockLen * sizeof(sweepBlock[0]));
+    return sweepCrc32(fold, sizeof(fold));
+}
+
+/* reference product for a packed value: sign-extended A times sign-extended B */
+static inline int32_t sweepReference(uint32_t packedValue)
+{
+    return TV_A(packedValue) * TV_B(packedValue);
+}
+
+
+/* shrink predicate: asmMain still returns the wrong product */
+static bool sweepStillFails(uint32_t packedValue, void *context,
+        testGuardStatus *status)
+{
+    int32_t actual = 0;
+    (void)context;
+    TEST_GUARD_CALL(*status, RESULT_MODE_SWEEP, packedValue,
+            actual = asmMain(packedValue));
+    return actual != sweepReference(packedValue);
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void runExhaustiveSweep(uint32_t firstInput,
+        uint32_t lastInput,
+        sweepResult *r,
+        volatile bool *tick,
+        volatile bool *txComplete)
+{
+    uint32_t packedValue = firstInput;
+    uint32_t blockLen = 0;
+    uint32_t ticks = 0;
+
+    r->firstInput = firstInput;
+    r->lastInput = lastInput;
+    r->casesRun = 0;
+    r->failCount = 0;
+    r->firstFailInput = 0;
+    r->firstFailActual = 0;
+    r->firstFailExpected = 0;
+    r->firstFailShrunk = 0;
+    r->signature = SWEEP_SIGNATURE_SEED;
+    r->stopped = false;
+
+    snprintf((char*)sweepTxBuffer, MAX_PRINT_LEN,
+            "========= EXHAUSTIVE SWEEP of asmMain: 0x%08lx to 0x%08lx\r\n"
+            "\r\n",
+            firstInput, lastInput);
+    printAndWait((char*)sweepTxBuffer, txComplete);
+    *tick = false;
+
+    while (true)
+    {
+        int32_t actual = 0;
+        testGuardStatus status;
+        TEST_GUARD_CALL(status, RESULT_MODE_SWEEP, packedValue,
+                actual = asmMain(packedValue));
+        if (status != TEST_GUARD_OK)
+        {
+            testGuardPrintFailure(status, RESULT_MODE_SWEEP, packedValue,
+                    txComplete);
+            r->stopped = true;
+            break;
+        }
+        int32_t expected = sweepReference(packedValue);
+
+        if (actual != expected)
+        {
+            if (r->failCount == 0)
+            {
+                r->firstFailInput = packedValue;
+                r->firstFailActual = actual;
+                r->firstFailExpected = expected;
+            }
+            ++r->failCount;
+        }
+        sweepBlock[blockLen++] = (uint32_t)actual;
+        ++r->casesRun;
+
+        if (blockLen == SWEEP_BLOCK_LEN || packedValue == lastInput)
+        {
+            r->signature = sweepFold(r->signature, blockLen);
+            blockLen = 0;
+
+            // only look at the clock once per block to keep the loop tight
+            if (*tick == true)
+            {
+                *tick = false;
+                if (++ticks >= SWEEP_PROGRESS_TICKS)
+                {
+                    ticks = 0;
+                    LED0_Toggle();
+                    snprintf((char*)sweepTxBuffer, MAX_PRINT_LEN,
+                            "sweep progress: at 0x%08lx; %lu cases run; "
+                            "%lu failures; signature so far 0x%08lx\r\n",
+                            packedValue, r->casesRun, r->failCount,
+                            r->signature);
+                    printAndWait((char*)sweepTxBuffer, txComplete);
+                }
+            }
+        }
+
+        if (packedValue == lastInput)
+        {
+            break;
+        }
+        ++packedValue;
+    }
+
+    snprintf((char*)sweepTxBuffer, MAX_PRINT_LEN,
+            "========= EXHAUSTIVE SWEEP %s: 0x%08lx to 0x%08lx\r\n"
+            "cases run (mod 2^32): %lu\r\n"
+            "failures:             %lu\r\n"
+            "first failure input:  0x%08lx; returned %ld, expected %ld\r\n"
+            "result signature:     0x%08lx (compare with host/sweepGolden)\r\n"
+            "\r\n",
+            r->stopped == true ? "STOPPED" : "COMPLETE",
+            r->firstInput, r->lastInput,
+            r->casesRun,
+            r->failCount,
+            r->firstFailInput, r->firstFailActual, r->firstFailExpected,
+            r->signature);
+    printAndWait((char*)sweepTxBuffer, txComplete);
+
+    if (r->failCount != 0)
+    {
+        shrinkResult shrink;
+        r->firstFailShrunk = shrinkPacked(r->firstFailInput, sweepStillFails,
+                NULL, &shrink);
+        shrinkPrint("sweep", &shrink, txComplete);
+        if (shrink.guardStatus != TEST_GUARD_OK)
+        {
+            testGuardPrintFailure(shrink.guardStatus, RESULT_MODE_SWEEP,
+                    shrink.guardInput, txComplete);
+        }
+    }
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/** Exhaustive sweep of the packed input space
+
+  @File Name
+    sweepFuncs.h
+
+  @Summary
+    Runs every 32-bit packed input through asmMain and folds the results
+    into a CRC signature.
+
+  @Description
+    The hand-picked tc[] cases in main.c only touch a handful of operand
+    combinations. The sweep mode calls asmMain for every packed value in a
+    range (by default all 2^32 of them), compares each result against the
+    reference product, and folds every returned value into a running CRC-32
+    computed by the DMAC CRC engine. Nothing is printed per case; progress is
+    printed every few seconds and the final signature can be compared against
+    the value printed by host/sweepGolden.c for the same range. The first
+    mismatch is shrunk (see shrinkFuncs.h) to the simplest input asmMain
+    also gets wrong.
+ */
+/* ************************************************************************** */
+
+#ifndef _SWEEP_FUNCS_H    /* Guard against multiple inclusion */
+#define _SWEEP_FUNCS_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* Number of asmMain results collected before they are CRC'd as one block.
+     * host/sweepGolden.c must use the same value to reproduce the signature. */
+#define SWEEP_BLOCK_LEN 256
+
+    /* Progress is printed after this many RTC ticks (10 ms each) */
+#define SWEEP_PROGRESS_TICKS 300
+
+    /* Starting value of the folded signature */
+#define SWEEP_SIGNATURE_SEED 0xFFFFFFFFUL
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+typedef struct _sweepResult
+{
+    uint32_t firstInput;       // first packed value of the range
+    uint32_t lastInput;        // last packed value of the range (inclusive)
+    uint32_t casesRun;         // number of packed values executed, mod 2^32
+    uint32_t failCount;        // number of results that differed from the reference
+    uint32_t firstFailInput;   // details of the first mismatch, if any
+    int32_t  firstFailActual;
+    int32_t  firstFailExpected;
+    uint32_t firstFailShrunk;  // simplest input asmMain also gets wrong
+    uint32_t signature;        // CRC-folded signature over every asmMain result
+    bool stopped;              // a call timed out or faulted; casesRun
+                               // values from firstInput were checked
+} sweepResult;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /**
+      @Function
+        void runExhaustiveSweep(uint32_t firstInput, uint32_t lastInput,
+                                sweepResult *r, volatile bool *tick,
+                                volatile bool *txComplete)
+
+      @Summary
+        Calls asmMain for every packed value from firstInput to lastInput
+        (inclusive) and checks it against the reference product.
+
+      @Description
+        Results are gathered in blocks of SWEEP_BLOCK_LEN words. Each block
+        is CRC-32'd, and the block CRC is folded into the signature as
+        signature = CRC32(signature || blockCrc), both words little-endian.
+        The last block of the range may be shorter than SWEEP_BLOCK_LEN.
+
+      @Parameters
+        @param tick  flag set by the RTC callback every 10 ms; the sweep
+                     clears it and counts ticks to pace the progress output
+
+      @Remarks
+        Each call is guarded (testGuard.h) as RESULT_MODE_SWEEP, and the
+        sweep stops at the first that times out or faults; the signature
+        then covers only the whole blocks before it. The guard costs more
+        than a fast asmMain, so a full 2^32 sweep takes a few hours.
+     */
+void runExhaustiveSweep(uint32_t firstInput,
+        uint32_t lastInput,
+        sweepResult *r,
+        volatile bool *tick,
+        volatile bool *txComplete);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SWEEP_FUNCS_H */
+
+/* *****************************************************************************
+ End of File
+ */
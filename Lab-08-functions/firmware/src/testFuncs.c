@@ -31,16 +31,51 @@
 #include "definitions.h"                // SYS function prototypes
 #include "testFuncs.h" // lab test structs
 #include "printFuncs.h"  // lab print funcs
+#include "printQueue.h"
+#include "fmtFuncs.h"   // snprintf-free report formatting
+#include "binLog.h"     // binary report records
+#include "testVectors.h" // shared reference macros
 
 
 #define MAX_PRINT_LEN 2000
 
-static uint8_t txBuffer[MAX_PRINT_LEN] = {0};
+// the print queue buffer being formatted into; see printQueue.h. It holds
+// PRINT_QUEUE_TX_BUFFER_LEN bytes, at least MAX_PRINT_LEN.
+static uint8_t *txBuffer = NULL;
 
 
-static char * pass = "PASS";
-static char * fail = "FAIL";
-static char * oops = "OOPS!!!";
+static const char * const pass = "PASS";
+static const char * const fail = "FAIL";
+
+/* the p/f lines of the testAsmMain report, in print order */
+static const struct
+{
+    const char *label;
+    uint32_t field;
+} mainChecks[] = {
+    { "a check p/f:           ", TV_FIELD_INPUT_A },
+    { "b check p/f:           ", TV_FIELD_INPUT_B },
+    { "sign bit a check p/f:  ", TV_FIELD_SIGN_A },
+    { "sign bit b check p/f:  ", TV_FIELD_SIGN_B },
+    { "abs a check p/f:       ", TV_FIELD_ABS_A },
+    { "abs b check p/f:       ", TV_FIELD_ABS_B },
+    { "initial product p/f:   ", TV_FIELD_INIT_PRODUCT },
+    { "final product p/f:     ", TV_FIELD_FINAL_PRODUCT },
+    { "returned result p/f:   ", TV_FIELD_R0 }
+};
+
+/* the expected/actual rows of the testAsmMain report */
+static const char * const mainDebugLabels[] = {
+    "a_Multiplicand:..",
+    "b_Multiplier:....",
+    "a_Sign:..........",
+    "b_Sign:..........",
+    "a_Abs:...........",
+    "b_Abs:...........",
+    "init_Product:....",
+    "final_Product:...",
+    "returned value:.."
+};
 
 
 
@@ -84,66 +119,20 @@ static char * oops = "OOPS!!!";
 
 /* ************************************************************************** */
 
-/** 
-  @Function
-    int ExampleLocalFunctionName ( int param1, int param2 ) 
-
-  @Summary
-    Brief one-line description of the function.
-
-  @Description
-    Full description, explaining the purpose and usage of the function.
-    <p>
-    Additional description in consecutive paragraphs separated by HTML 
-    paragraph breaks, as necessary.
-    <p>
-    Type "JavaDoc" in the "How Do I?" IDE toolbar for more information on tags.
-
-  @Precondition
-    List and describe any required preconditions. If there are no preconditions,
-    enter "None."
-
-  @Parameters
-    @param param1 Describe the first parameter to the function.
-    
-    @param param2 Describe the second parameter to the function.
-
-  @Returns
-    List (if feasible) and describe the return values of the function.
-    <ul>
-      <li>1   Indicates an error occurred
-      <li>0   Indicates an error did not occur
-    </ul>
-
-  @Remarks
-    Describe any special behavior not described above.
-    <p>
-    Any additional remarks.
+/* bit field of mask as a PASS/FAIL string; only called when printing */
+static inline const char *pfString(uint32_t mask, uint32_t field)
+{
+    return ((mask >> field) & 1) != 0 ? pass : fail;
+}
 
-  @Example
-    @code
-    if(ExampleFunctionName(1, 2) == 0)
-    {
-        return 3;
-    }
- */
-static void check(int32_t in1, 
-        int32_t in2, 
-        int32_t *goodCount, 
-        int32_t *badCount,
-        char **pfString )
+/* set the pass and fail counts of a case from its compare mask */
+static inline void countFields(uint32_t mask,
+        uint32_t numFields,
+        int32_t *passCount,
+        int32_t *failCount)
 {
-    if (in1 == in2)
-    {
-        *goodCount += 1;
-        *pfString = pass;
-    }
-    else
-    {
-        *badCount += 1;
-        *pfString = fail;        
-    }
-    return;
+    *passCount = __builtin_popcount(mask);
+    *failCount = numFields - *passCount;
 }
 
 /* ************************************************************************** */
@@ -174,43 +163,41 @@ int32_t calcExpectedValues(
             uint32_t packedValue,
             expectedValues *e)
 {
-    e->packedVal = packedValue;
-    // calculate sign-extended A and B
-    
-    // Multiplicand A
-    e->inputA = 0;
-    e->inputB = 0;
-    // unpack A
-    e->inputA =  packedValue>>16;
-    e->signA = e->inputA & 0x8000;
-    if (e->signA != 0)
-    {
-        e->signA = 1;
-        e->inputA = e->inputA | 0xFFFF8000;
-    }
-    e->absA = abs(e->inputA);
-    
-    // Multiplicand B
-    // unpack B
-    e->signB = packedValue & 0x8000;
-    if (e->signB != 0)
-    {
-        e->signB = 1;
-        e->inputB = packedValue | 0xFFFF8000;
-    }
-    else
-    {
-        e->inputB = packedValue & 0x0000FFFF;
-    }
-    e->absB = abs(e->inputB);
-    
-    e->initProduct = e->absA * e->absB;
-    e->finalProduct = e->inputA * e->inputB;
+    // same macros that build the tcExpected[] table in flash, so values
+    // computed here always match the compile-time table
+    const expectedValues v = TV_EXPECTED(packedValue);
+    *e = v;
 
     return 0;
 }
 
 
+/** 
+  @Function
+    uint32_t compareExpectedValues(const expectedValues *actual,
+            const expectedValues *expected)
+
+  @Summary
+    Compare all result fields at once; bit TV_FIELD_x is set if field x
+    matched.
+
+  @Remarks
+    Refer to the example_file.h interface header for function usage details.
+ */
+uint32_t compareExpectedValues(const expectedValues *actual,
+        const expectedValues *expected)
+{
+    return ((uint32_t)(actual->inputA == expected->inputA) << TV_FIELD_INPUT_A) |
+            ((uint32_t)(actual->inputB == expected->inputB) << TV_FIELD_INPUT_B) |
+            ((uint32_t)(actual->signA == expected->signA) << TV_FIELD_SIGN_A) |
+            ((uint32_t)(actual->signB == expected->signB) << TV_FIELD_SIGN_B) |
+            ((uint32_t)(actual->absA == expected->absA) << TV_FIELD_ABS_A) |
+            ((uint32_t)(actual->absB == expected->absB) << TV_FIELD_ABS_B) |
+            ((uint32_t)(actual->initProduct == expected->initProduct) << TV_FIELD_INIT_PRODUCT) |
+            ((uint32_t)(actual->finalProduct == expected->finalProduct) << TV_FIELD_FINAL_PRODUCT);
+}
+
+
 /** 
   @Function
     int ExampleInterfaceFunctionName ( int param1, int param2 ) 
@@ -235,39 +222,54 @@ void testAsmUnpack(
         volatile bool * txComplete
         )
 {
-    *failCount = 0;
-    *passCount = 0;
-    char *aCheck = oops;
-    char *bCheck = oops;
-    
-    check(inputA, *unpackedA, passCount, failCount, &aCheck);
-    check(inputB, *unpackedB, passCount, failCount, &bCheck);
+    uint32_t mask = ((uint32_t)(*unpackedA == inputA) << 0) |
+            ((uint32_t)(*unpackedB == inputB) << 1);
+    countFields(mask, TV_UNPACK_FIELDS, passCount, failCount);
 
     if( onlyPrintFails == false || ((onlyPrintFails == true) && (*failCount != 0)))
     {
+#if BIN_LOG_ENABLE
+    binLogRecord r;
+    binLogBegin(&r, BIN_LOG_UNPACK);
+    binLogStr(&r, desc);
+    binLogSigned(&r, testNum);
+    binLogUnsigned(&r, packedVal);
+    binLogSigned(&r, *unpackedA);
+    binLogSigned(&r, inputA);
+    binLogSigned(&r, *unpackedB);
+    binLogSigned(&r, inputB);
+    binLogUnsigned(&r, (mask >> 0) & 1);
+    binLogUnsigned(&r, (mask >> 1) & 1);
+    binLogSend(&r, txComplete);
+#else
     // build the string to be sent out over the serial lines
-    snprintf((char*)txBuffer, MAX_PRINT_LEN,
-            "========= testAsmUnpack %s test number: %ld\r\n"
-            "packed (input) value:    0x%08lx\r\n"
-            "unpacked A (multiplicand) value: %11ld; 0x%08lx\r\n"
-            "expected A (multiplicand) value: %11ld; 0x%08lx\r\n"
-            "unpacked B (multiplier) value:   %11ld; 0x%08lx\r\n"
-            "expected B (multiplier) value:   %11ld; 0x%08lx\r\n"
-            "unpacked A pass/fail:            %s\r\n"
-            "unpacked B pass/fail:            %s\r\n"
-            "========= END -- testAsmUnpack() debug output\r\n"
-            "\r\n",
-            desc,
-            testNum,
-            packedVal, 
-            *unpackedA,*unpackedA,
-            inputA,inputA,
-            *unpackedB,*unpackedB,
-            inputB,inputB,
-            aCheck,bCheck
-            ); 
+    txBuffer = (uint8_t *)printQueueBufferGet();
+    fmtWriter w;
+    fmtBegin(&w, (char*)txBuffer, MAX_PRINT_LEN);
+    fmtStr(&w, "========= testAsmUnpack ");
+    fmtStr(&w, desc);
+    fmtStr(&w, " test number: ");
+    fmtDec(&w, testNum, 0);
+    fmtStr(&w, "\r\npacked (input) value:    0x");
+    fmtHex(&w, packedVal, 8);
+    fmtStr(&w, "\r\nunpacked A (multiplicand) value: ");
+    fmtDecHex(&w, *unpackedA);
+    fmtStr(&w, "\r\nexpected A (multiplicand) value: ");
+    fmtDecHex(&w, inputA);
+    fmtStr(&w, "\r\nunpacked B (multiplier) value:   ");
+    fmtDecHex(&w, *unpackedB);
+    fmtStr(&w, "\r\nexpected B (multiplier) value:   ");
+    fmtDecHex(&w, inputB);
+    fmtStr(&w, "\r\nunpacked A pass/fail:            ");
+    fmtStr(&w, pfString(mask, 0));
+    fmtStr(&w, "\r\nunpacked B pass/fail:            ");
+    fmtStr(&w, pfString(mask, 1));
+    fmtStr(&w, "\r\n========= END -- testAsmUnpack() debug output\r\n"
+            "\r\n");
+    fmtEnd(&w);
 
     printAndWait((char *)txBuffer, txComplete);
+#endif
     }
     return ;
 };
@@ -287,40 +289,61 @@ void testAsmAbs(
         volatile bool * txComplete
         )
 {
-    *failCount = 0;
-    *passCount = 0;
-    char *absMemCheck = oops;
-    char *sbMemCheck = oops;
-    char *r0Check = oops;
-    
-    check(expAbs, *absVal, passCount, failCount, &absMemCheck);
-    check(expAbs, r0_absVal, passCount, failCount, &r0Check);
-    check(expSignBit, *signBit, passCount, failCount, &sbMemCheck);
+    uint32_t mask = ((uint32_t)(*absVal == expAbs) << 0) |
+            ((uint32_t)(r0_absVal == expAbs) << 1) |
+            ((uint32_t)(*signBit == expSignBit) << 2);
+    countFields(mask, TV_ABS_FIELDS, passCount, failCount);
 
     if( onlyPrintFails == false || ((onlyPrintFails == true) && (*failCount != 0)))
     {
+#if BIN_LOG_ENABLE
+    binLogRecord r;
+    binLogBegin(&r, BIN_LOG_ABS);
+    binLogStr(&r, desc);
+    binLogSigned(&r, testNum);
+    binLogUnsigned(&r, (uint32_t)signedInput);
+    binLogSigned(&r, *absVal);
+    binLogUnsigned(&r, (mask >> 0) & 1);
+    binLogSigned(&r, r0_absVal);
+    binLogUnsigned(&r, (mask >> 1) & 1);
+    binLogSigned(&r, *signBit);
+    binLogUnsigned(&r, (mask >> 2) & 1);
+    binLogSigned(&r, expAbs);
+    binLogSigned(&r, expSignBit);
+    binLogSend(&r, txComplete);
+#else
     // build the string to be sent out over the serial lines
-    snprintf((char*)txBuffer, MAX_PRINT_LEN,
-            "========= testAsmAbs %s test number: %ld\r\n"
-            "signed input value:    0x%08lx\r\n"
-            "abs value stored in mem:  %11ld; 0x%08lx; %s\r\n"
-            "abs value returned in r0: %11ld; 0x%08lx; %s\r\n"
-            "sign bit stored in mem:   %11ld; 0x%08lx; %s\r\n"
-            "expected abs value:   %11ld; 0x%08lx\r\n"
-            "expected sign bit:    %11ld\r\n"
-            "========= END -- testAsmAbs() debug output\r\n"
-            "\r\n",
-            desc,
-            testNum,
-            signedInput, 
-            *absVal,*absVal,absMemCheck,
-            r0_absVal,r0_absVal,r0Check,
-            *signBit,*signBit,sbMemCheck,
-            expAbs,expAbs,
-            expSignBit
-            ); 
+    txBuffer = (uint8_t *)printQueueBufferGet();
+    fmtWriter w;
+    fmtBegin(&w, (char*)txBuffer, MAX_PRINT_LEN);
+    fmtStr(&w, "========= testAsmAbs ");
+    fmtStr(&w, desc);
+    fmtStr(&w, " test number: ");
+    fmtDec(&w, testNum, 0);
+    fmtStr(&w, "\r\nsigned input value:    0x");
+    fmtHex(&w, (uint32_t)signedInput, 8);
+    fmtStr(&w, "\r\nabs value stored in mem:  ");
+    fmtDecHex(&w, *absVal);
+    fmtStr(&w, "; ");
+    fmtStr(&w, pfString(mask, 0));
+    fmtStr(&w, "\r\nabs value returned in r0: ");
+    fmtDecHex(&w, r0_absVal);
+    fmtStr(&w, "; ");
+    fmtStr(&w, pfString(mask, 1));
+    fmtStr(&w, "\r\nsign bit stored in mem:   ");
+    fmtDecHex(&w, *signBit);
+    fmtStr(&w, "; ");
+    fmtStr(&w, pfString(mask, 2));
+    fmtStr(&w, "\r\nexpected abs value:   ");
+    fmtDecHex(&w, expAbs);
+    fmtStr(&w, "\r\nexpected sign bit:    ");
+    fmtDec(&w, expSignBit, 11);
+    fmtStr(&w, "\r\n========= END -- testAsmAbs() debug output\r\n"
+            "\r\n");
+    fmtEnd(&w);
 
     printAndWait((char *)txBuffer, txComplete);
+#endif
     }
     return ;
 }
@@ -339,34 +362,49 @@ void testAsmMult(
         volatile bool * txComplete
         )
 {
-    *failCount = 0;
-    *passCount = 0;
-    char *prodCheck = oops;
-    
-    check(expectedInitProduct, r0_initProd, passCount, failCount, &prodCheck);
+    uint32_t mask = (uint32_t)(r0_initProd == expectedInitProduct);
+    countFields(mask, TV_MULT_FIELDS, passCount, failCount);
 
     if( onlyPrintFails == false || ((onlyPrintFails == true) && (*failCount != 0)))
     {
+#if BIN_LOG_ENABLE
+    binLogRecord r;
+    binLogBegin(&r, BIN_LOG_MULT);
+    binLogStr(&r, desc);
+    binLogSigned(&r, testNum);
+    binLogSigned(&r, absA);
+    binLogSigned(&r, absB);
+    binLogSigned(&r, r0_initProd);
+    binLogUnsigned(&r, mask & 1);
+    binLogSigned(&r, expectedInitProduct);
+    binLogSend(&r, txComplete);
+#else
     // build the string to be sent out over the serial lines
-    snprintf((char*)txBuffer, MAX_PRINT_LEN,
-            "========= testAsmMult %s test number: %ld\r\n"
-            "Inputs:\r\n"
-            "abs value A:             %11ld; 0x%08lx\r\n"
-            "abs value B:             %11ld; 0x%08lx\r\n"
-            "Output:\r\n"
-            "product abs(A) * abs(B): %11ld; 0x%08lx; %s\r\n"
-            "Expected product:        %11ld; 0x%08lx\r\n"
-            "========= END -- testAsmMult() debug output\r\n"
-            "\r\n",
-            desc,
-            testNum,
-            absA,absA,
-            absB,absB,
-            r0_initProd,r0_initProd,prodCheck,
-            expectedInitProduct,expectedInitProduct
-            ); 
+    txBuffer = (uint8_t *)printQueueBufferGet();
+    fmtWriter w;
+    fmtBegin(&w, (char*)txBuffer, MAX_PRINT_LEN);
+    fmtStr(&w, "========= testAsmMult ");
+    fmtStr(&w, desc);
+    fmtStr(&w, " test number: ");
+    fmtDec(&w, testNum, 0);
+    fmtStr(&w, "\r\nInputs:\r\n"
+            "abs value A:             ");
+    fmtDecHex(&w, absA);
+    fmtStr(&w, "\r\nabs value B:             ");
+    fmtDecHex(&w, absB);
+    fmtStr(&w, "\r\nOutput:\r\n"
+            "product abs(A) * abs(B): ");
+    fmtDecHex(&w, r0_initProd);
+    fmtStr(&w, "; ");
+    fmtStr(&w, pfString(mask, 0));
+    fmtStr(&w, "\r\nExpected product:        ");
+    fmtDecHex(&w, expectedInitProduct);
+    fmtStr(&w, "\r\n========= END -- testAsmMult() debug output\r\n"
+            "\r\n");
+    fmtEnd(&w);
 
     printAndWait((char *)txBuffer, txComplete);
+#endif
     }
     return;
 }
@@ -385,36 +423,52 @@ void testAsmFixSign(
         volatile bool * txComplete
         )
 {
-    *failCount = 0;
-    *passCount = 0;
-    char *prodCheck = oops;
-    
-    check(expectedFinalProduct, r0_finalProduct, passCount, failCount, &prodCheck);
+    uint32_t mask = (uint32_t)(r0_finalProduct == expectedFinalProduct);
+    countFields(mask, TV_FIXSIGN_FIELDS, passCount, failCount);
 
     if( onlyPrintFails == false || ((onlyPrintFails == true) && (*failCount != 0)))
     {
+#if BIN_LOG_ENABLE
+    binLogRecord r;
+    binLogBegin(&r, BIN_LOG_FIXSIGN);
+    binLogStr(&r, desc);
+    binLogSigned(&r, testNum);
+    binLogSigned(&r, (int32_t)initProduct);
+    binLogSigned(&r, signA);
+    binLogSigned(&r, signB);
+    binLogSigned(&r, r0_finalProduct);
+    binLogUnsigned(&r, mask & 1);
+    binLogSigned(&r, expectedFinalProduct);
+    binLogSend(&r, txComplete);
+#else
     // build the string to be sent out over the serial lines
-    snprintf((char*)txBuffer, MAX_PRINT_LEN,
-            "========= testAsmFixSign %s test number: %ld\r\n"
-            "Inputs:\r\n"
-            "Initial (unsigned) product: %11ld; 0x%08lx\r\n"
-            "sign bit A:                 %ld\r\n"
-            "sign bit B:                 %ld\r\n"
-            "Output:\r\n"
-            "Final (signed) product:     %11ld; 0x%08lx; %s\r\n"
-            "Expected product:           %11ld; 0x%08lx\r\n"
-            "========= END -- testAsmFixSign() debug output\r\n"
-            "\r\n",
-            desc,
-            testNum,
-            initProduct,initProduct,
-            signA,
-            signB,
-            r0_finalProduct,r0_finalProduct,prodCheck,
-            expectedFinalProduct,expectedFinalProduct
-            ); 
+    txBuffer = (uint8_t *)printQueueBufferGet();
+    fmtWriter w;
+    fmtBegin(&w, (char*)txBuffer, MAX_PRINT_LEN);
+    fmtStr(&w, "========= testAsmFixSign ");
+    fmtStr(&w, desc);
+    fmtStr(&w, " test number: ");
+    fmtDec(&w, testNum, 0);
+    fmtStr(&w, "\r\nInputs:\r\n"
+            "Initial (unsigned) product: ");
+    fmtDecHex(&w, (int32_t)initProduct);
+    fmtStr(&w, "\r\nsign bit A:                 ");
+    fmtDec(&w, signA, 0);
+    fmtStr(&w, "\r\nsign bit B:                 ");
+    fmtDec(&w, signB, 0);
+    fmtStr(&w, "\r\nOutput:\r\n"
+            "Final (signed) product:     ");
+    fmtDecHex(&w, r0_finalProduct);
+    fmtStr(&w, "; ");
+    fmtStr(&w, pfString(mask, 0));
+    fmtStr(&w, "\r\nExpected product:           ");
+    fmtDecHex(&w, expectedFinalProduct);
+    fmtStr(&w, "\r\n========= END -- testAsmFixSign() debug output\r\n"
+            "\r\n");
+    fmtEnd(&w);
 
     printAndWait((char *)txBuffer, txComplete);
+#endif
     }
     return;
 }
@@ -434,87 +488,85 @@ void testAsmMain(
         int32_t bSign,
         int32_t initProduct,
         int32_t finalProduct,
-        expectedValues * exp, // expected values
+        const expectedValues * exp, // expected values
         int32_t * passCount,
         int32_t * failCount,
         bool onlyPrintFails,
         volatile bool * txComplete
         )
 {
-    *failCount = 0;
-    *passCount = 0;
-    char *aCheck = oops;
-    char *bCheck = oops;
-    char *aSignCheck = oops;
-    char *bSignCheck = oops;
-    char *aAbsCheck = oops;
-    char *bAbsCheck = oops;
-    char *initProdCheck = oops;
-    char *finalProdCheck = oops;
-    char *r0Check = oops;
-
-    check(exp->inputA, a, passCount, failCount, &aCheck);
-    check(exp->inputB, b, passCount, failCount, &bCheck);
-    check(exp->signA, aSign, passCount, failCount, &aSignCheck);
-    check(exp->signB, bSign, passCount, failCount, &bSignCheck);
-    check(exp->absA, aAbs, passCount, failCount, &aAbsCheck);
-    check(exp->absB, bAbs, passCount, failCount, &bAbsCheck);
-    check(exp->initProduct, initProduct, passCount, failCount, &initProdCheck);
-    check(exp->finalProduct, finalProduct, passCount, failCount, &finalProdCheck);
-    check(exp->finalProduct, r0_mainFinalProd, passCount, failCount, &r0Check);
+    const expectedValues actual = {
+        exp->packedVal, a, b, aAbs, bAbs, aSign, bSign, initProduct, finalProduct
+    };
+    uint32_t mask = compareExpectedValues(&actual, exp) |
+            ((uint32_t)(r0_mainFinalProd == exp->finalProduct) << TV_FIELD_R0);
+    countFields(mask, TV_MAIN_FIELDS, passCount, failCount);
  
     if( onlyPrintFails == false || ((onlyPrintFails == true) && (*failCount != 0)))
     {
-    snprintf((char*)txBuffer, MAX_PRINT_LEN,
-            "========= testAsmMain %s test number: %ld\r\n"
-            "test case INPUT: packed value:    0x%08lx\r\n"
-            "test case INPUT: multiplier (a):   %11ld; 0x%08lx\r\n"
-            "test case INPUT: multiplicand (b): %11ld; 0x%08lx\r\n"
-            "a check p/f:           %s\r\n"
-            "b check p/f:           %s\r\n"
-            "sign bit a check p/f:  %s\r\n"
-            "sign bit b check p/f:  %s\r\n"
-            "abs a check p/f:       %s\r\n"
-            "abs b check p/f:       %s\r\n"
-            "initial product p/f:   %s\r\n"
-            "final product p/f:     %s\r\n"
-            "returned result p/f:   %s\r\n"
-            "debug values        expected        actual\r\n"
-            "a_Multiplicand:..%11ld   %11ld\r\n"
-            "b_Multiplier:....%11ld   %11ld\r\n"
-            "a_Sign:..........%11ld   %11ld\r\n"
-            "b_Sign:..........%11ld   %11ld\r\n"
-            "a_Abs:...........%11ld   %11ld\r\n"
-            "b_Abs:...........%11ld   %11ld\r\n"
-            "init_Product:....%11ld   %11ld\r\n"
-            "final_Product:...%11ld   %11ld\r\n"
-            "returned value:..%11ld   %11ld\r\n",
-            desc,
-            testNum,
-            exp->packedVal,
-            exp->inputA, exp->inputA,
-            exp->inputB, exp->inputB,
-            aCheck,
-            bCheck,
-            aSignCheck,
-            bSignCheck,
-            aAbsCheck,
-            bAbsCheck,
-            initProdCheck,
-            finalProdCheck,
-            r0Check,
-            exp->inputA, a,
-            exp->inputB, b,
-            exp->signA, aSign,
-            exp->signB, bSign,
-            exp->absA, aAbs,
-            exp->absB, bAbs,
-            exp->initProduct, initProduct,
-            exp->finalProduct, finalProduct,
-            exp->finalProduct, r0_mainFinalProd
-            );
+    const int32_t debugValues[][2] = {
+        { exp->inputA, a },
+        { exp->inputB, b },
+        { exp->signA, aSign },
+        { exp->signB, bSign },
+        { exp->absA, aAbs },
+        { exp->absB, bAbs },
+        { exp->initProduct, initProduct },
+        { exp->finalProduct, finalProduct },
+        { exp->finalProduct, r0_mainFinalProd }
+    };
+#if BIN_LOG_ENABLE
+    binLogRecord r;
+    binLogBegin(&r, BIN_LOG_MAIN);
+    binLogStr(&r, desc);
+    binLogSigned(&r, testNum);
+    binLogUnsigned(&r, exp->packedVal);
+    binLogSigned(&r, exp->inputA);
+    binLogSigned(&r, exp->inputB);
+    for (uint32_t i = 0; i < sizeof(mainChecks) / sizeof(mainChecks[0]); ++i)
+    {
+        binLogUnsigned(&r, (mask >> mainChecks[i].field) & 1);
+    }
+    for (uint32_t i = 0; i < sizeof(debugValues) / sizeof(debugValues[0]); ++i)
+    {
+        binLogSigned(&r, debugValues[i][0]);
+        binLogSigned(&r, debugValues[i][1]);
+    }
+    binLogSend(&r, txComplete);
+#else
+    txBuffer = (uint8_t *)printQueueBufferGet();
+    fmtWriter w;
+    fmtBegin(&w, (char*)txBuffer, MAX_PRINT_LEN);
+    fmtStr(&w, "========= testAsmMain ");
+    fmtStr(&w, desc);
+    fmtStr(&w, " test number: ");
+    fmtDec(&w, testNum, 0);
+    fmtStr(&w, "\r\ntest case INPUT: packed value:    0x");
+    fmtHex(&w, exp->packedVal, 8);
+    fmtStr(&w, "\r\ntest case INPUT: multiplier (a):   ");
+    fmtDecHex(&w, exp->inputA);
+    fmtStr(&w, "\r\ntest case INPUT: multiplicand (b): ");
+    fmtDecHex(&w, exp->inputB);
+    fmtStr(&w, "\r\n");
+    for (uint32_t i = 0; i < sizeof(mainChecks) / sizeof(mainChecks[0]); ++i)
+    {
+        fmtStr(&w, mainChecks[i].label);
+        fmtStr(&w, pfString(mask, mainChecks[i].field));
+        fmtStr(&w, "\r\n");
+    }
+    fmtStr(&w, "debug values        expected        actual\r\n");
+    for (uint32_t i = 0; i < sizeof(debugValues) / sizeof(debugValues[0]); ++i)
+    {
+        fmtStr(&w, mainDebugLabels[i]);
+        fmtDec(&w, debugValues[i][0], 11);
+        fmtStr(&w, "   ");
+        fmtDec(&w, debugValues[i][1], 11);
+        fmtStr(&w, "\r\n");
+    }
+    fmtEnd(&w);
     
     printAndWait((char *)txBuffer, txComplete);
+#endif
     }
     return;
 }
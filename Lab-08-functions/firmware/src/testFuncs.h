@@ -89,6 +89,30 @@ typedef struct _expectedValues
     int32_t finalProduct;
 } expectedValues;
 
+// bits of the compareExpectedValues() mask, in the order testAsmMain() prints
+// them. TV_FIELD_R0 is the value asmMain returned, checked by the caller.
+enum
+{
+    TV_FIELD_INPUT_A = 0,
+    TV_FIELD_INPUT_B,
+    TV_FIELD_SIGN_A,
+    TV_FIELD_SIGN_B,
+    TV_FIELD_ABS_A,
+    TV_FIELD_ABS_B,
+    TV_FIELD_INIT_PRODUCT,
+    TV_FIELD_FINAL_PRODUCT,
+    TV_FIELD_R0,
+    TV_NUM_FIELDS
+};
+
+// fields each testAsmX() counts per call; main.c fails all of them for a
+// call that timed out or faulted
+#define TV_UNPACK_FIELDS  2     // inputA, inputB
+#define TV_ABS_FIELDS     3     // abs value, returned abs value, sign bit
+#define TV_MULT_FIELDS    1     // returned initial product
+#define TV_FIXSIGN_FIELDS 1     // returned final product
+#define TV_MAIN_FIELDS    TV_NUM_FIELDS
+
 
     // *****************************************************************************
 
@@ -174,6 +198,10 @@ int32_t calcExpectedValues(
         uint32_t packedValue, // test case input
         expectedValues *e);   // ptr to struct where values will be stored
 
+// compare every field but packedVal; bit TV_FIELD_x set if field x matched
+uint32_t compareExpectedValues(const expectedValues *actual,
+        const expectedValues *expected);
+
 
 void testAsmUnpack(
         int32_t testNum, // test number
@@ -248,7 +276,7 @@ void testAsmMain(
         int32_t bSign,
         int32_t init_Product,
         int32_t final_Product,
-        expectedValues * exp, // expected values
+        const expectedValues * exp, // expected values
         int32_t * passCount,
         int32_t * failCount,
         bool onlyPrintFails,
@@ -0,0 +1,238 @@
+/* ************************************************************************** */
+/** Per-call timeout for the functions under test
+
+  @File Name
+    testGuard.c
+
+  @Summary
+    Recovers from an asm function that never returns or that faults, so one
+    bad case is reported as TIMEOUT or FAULT instead of stopping the run.
+
+  @Description
+    See testGuard.h for how a timeout unwinds back to the runner.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <setjmp.h>
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "printFuncs.h"  // lab print funcs
+#include "testGuard.h"
+#include "faultCapture.h"
+#include "sandbox.h"
+#include "excEntry.h"
+
+#define MAX_PRINT_LEN 200
+
+#define USING_HW 1
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint8_t guardTxBuffer[MAX_PRINT_LEN] = {0};
+
+jmp_buf testGuardJmp;
+
+/* RTC ticks left before the armed call is abandoned; 0 when disarmed */
+static volatile uint32_t guardTicksLeft = 0;
+
+/* RTC ticks seen since testGuardInit() */
+static volatile uint32_t guardTickCount = 0;
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* exception return lands here, in thread mode, in place of the abandoned
+ * function; see testGuardRedirect() */
+__attribute__((used, noreturn)) static void testGuardTimeoutTrampoline(void)
+{
+    testGuardAbandon(TEST_GUARD_TIMEOUT);
+}
+
+__attribute__((used, noreturn)) static void testGuardFaultTrampoline(void)
+{
+    testGuardAbandon(TEST_GUARD_FAULT);
+}
+
+#if USING_HW
+/* called from PendSV_Handler with the interrupted thread's frame */
+__attribute__((used)) static void testGuardPendSV(uint32_t *frame)
+{
+    testGuardRedirect(frame, TEST_GUARD_TIMEOUT);
+}
+
+__attribute__((naked)) void PendSV_Handler(void)
+{
+    EXC_ENTRY(testGuardPendSV, "");
+}
+#endif
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void testGuardInit(void)
+{
+#if USING_HW
+    NVIC_SetPriority(PendSV_IRQn, (1UL << __NVIC_PRIO_BITS) - 1);
+#endif
+    guardTicksLeft = 0;
+    guardTickCount = 0;
+}
+
+uint32_t testGuardTickCount(void)
+{
+    return guardTickCount;
+}
+
+bool testGuardBegin(resultTestId group, uint32_t testCase)
+{
+    if (faultSeen(group, testCase) == true)
+    {
+        // drop any sandboxAllow() made for this call
+        sandboxEnd();
+        return false;
+    }
+    faultSetCurrentTest(group, testCase);
+    guardTicksLeft = TEST_GUARD_TIMEOUT_TICKS;
+    // last: unprivileged code cannot write the variables above
+    sandboxBegin();
+    return true;
+}
+
+void testGuardEnd(void)
+{
+    sandboxEnd();
+    guardTicksLeft = 0;
+    faultClearCurrentTest();
+}
+
+void testGuardAbandon(testGuardStatus status)
+{
+    sandboxEnd();
+    guardTicksLeft = 0;
+    faultClearCurrentTest();
+    longjmp(testGuardJmp, status);
+}
+
+void testGuardRedirect(uint32_t *frame, testGuardStatus status)
+{
+    // stacked frame: r0, r1, r2, r3, r12, lr, pc, xpsr; the same in the
+    // basic and the FPU frame
+    frame[6] = (status == TEST_GUARD_TIMEOUT ?
+            (uint32_t)testGuardTimeoutTrampoline :
+            (uint32_t)testGuardFaultTrampoline) & ~1UL;
+    // the IT/ICI bits belong to the abandoned instruction stream
+    frame[7] &= ~0x0600FC00UL;
+}
+
+void testGuardTick(void)
+{
+    ++guardTickCount;
+    if (guardTicksLeft == 0)
+    {
+        return;
+    }
+    if (--guardTicksLeft == 0)
+    {
+#if USING_HW
+        // tail-chains after the RTC handler, before the thread resumes
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+#else
+        // the simulated timer is ticked from inside the hung code itself
+        testGuardAbandon(TEST_GUARD_TIMEOUT);
+#endif
+    }
+}
+
+void testGuardPrintFailure(testGuardStatus status,
+        resultTestId group,
+        uint32_t testCase,
+        volatile bool *txComplete)
+{
+    const faultRecord *f = faultLastRecovered();
+    char name[40];
+
+    if (f == NULL || f->group != group || f->testCase != testCase)
+    {
+        f = faultFind(group, testCase);
+    }
+    // a mode's record is for the packed value that faulted, which after a
+    // reset is not the one it was asked for
+    faultCaseName(name, sizeof(name), group,
+            f != NULL ? f->testCase : testCase);
+
+    if (status == TEST_GUARD_TIMEOUT)
+    {
+        snprintf((char*)guardTxBuffer, MAX_PRINT_LEN,
+                "========= TIMEOUT: %s did not return within %d ms; "
+                "abandoned\r\n"
+                "\r\n",
+                name, TEST_GUARD_TIMEOUT_TICKS * 10);
+    }
+    else if (f != NULL && f->type == FAULT_TYPE_MEMMANAGE &&
+            (f->cfsr & SCB_CFSR_MMARVALID_Msk) != 0)
+    {
+        snprintf((char*)guardTxBuffer, MAX_PRINT_LEN,
+                "========= FAULT: %s: sandbox blocked access to 0x%08lx at "
+                "PC 0x%08lx\r\n"
+                "\r\n",
+                name, f->mmfar, f->pc);
+    }
+    else if (f != NULL && f->type == FAULT_TYPE_SVC)
+    {
+        snprintf((char*)guardTxBuffer, MAX_PRINT_LEN,
+                "========= FAULT: %s: SVC at PC 0x%08lx is not allowed in "
+                "the sandbox\r\n"
+                "\r\n",
+                name, f->pc - 2);
+    }
+    else if (f != NULL)
+    {
+        snprintf((char*)guardTxBuffer, MAX_PRINT_LEN,
+                "========= FAULT: %s faulted at PC 0x%08lx; skipped "
+                "(details in the fault summary)\r\n"
+                "\r\n",
+                name, f->pc);
+    }
+    else if (RESULT_IS_MODE(group))
+    {
+        snprintf((char*)guardTxBuffer, MAX_PRINT_LEN,
+                "========= FAULT: %s faulted before the last reset; stopped "
+                "(the fault log was full, so no details)\r\n"
+                "\r\n",
+                resultTestNames[group]);
+    }
+    else
+    {
+        snprintf((char*)guardTxBuffer, MAX_PRINT_LEN,
+                "========= FAULT: %s faulted; skipped (the fault log was "
+                "full, so no details)\r\n"
+                "\r\n",
+                name);
+    }
+    printAndWait((char*)guardTxBuffer, txComplete);
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/** Per-call timeout for the functions under test
+
+  @File Name
+    testGuard.h
+
+  @Summary
+    Recovers from an asm function that never returns or that faults, so one
+    bad case is reported as TIMEOUT or FAULT instead of stopping the run.
+
+  @Description
+    TEST_GUARD_CALL() saves the runner's context with setjmp, names the
+    running case for faultCapture.c, arms a timeout and makes the call.
+    rtcEventHandler() in main.c calls testGuardTick() every 10 ms; once an
+    armed guard has seen TEST_GUARD_TIMEOUT_TICKS ticks, testGuardTick()
+    pends PendSV. PendSV runs at the lowest priority, so it
+    always interrupts the thread code (the hung function), never another
+    handler. It rewrites the stacked return address (testGuardRedirect())
+    so that exception return lands in a trampoline that longjmps back to
+    TEST_GUARD_CALL(), which then reports TEST_GUARD_TIMEOUT.
+
+    The call runs in the MPU sandbox (see sandbox.h). A store it makes
+    outside the sandbox is redirected the same way and reported as
+    TEST_GUARD_FAULT without a reset.
+
+    A case that faulted before the last reset is not called again;
+    TEST_GUARD_CALL() reports TEST_GUARD_FAULT for it (see faultCapture.h).
+
+    RTC compare 1 cannot be used for the timeout because compare 0 clears
+    the counter every 10 ms, so the guard counts compare 0 ticks instead.
+
+    Usage:
+        int32_t r0 = 0;
+        testGuardStatus status;
+        TEST_GUARD_CALL(status, RESULT_MULT, testCase, r0 = asmMult(a, b));
+        if (status != TEST_GUARD_OK) ...   // r0 is not valid
+
+    The modes guard their calls the same way, with a mode's group (see
+    resultStore.h) and the packed value in place of the test case:
+        TEST_GUARD_CALL(status, RESULT_MODE_SWEEP, packedValue,
+                r0 = asmMain(packedValue));
+    The call may only write its locals: the sandbox blocks stores to the
+    caller's static data, so copy results there after the call.
+
+    A function that hangs with interrupts disabled cannot be recovered.
+
+    When USING_HW is 0 there is no RTC or PendSV; the code under test (or a
+    host harness) calls testGuardTick() to advance a simulated timer, and
+    testGuardTick() longjmps directly on expiry.
+ */
+/* ************************************************************************** */
+
+#ifndef _TEST_GUARD_H    /* Guard against multiple inclusion */
+#define _TEST_GUARD_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <setjmp.h>
+#include "resultStore.h"  // resultTestId
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+    /* Section: Constants                                                         */
+    /* ************************************************************************** */
+    /* ************************************************************************** */
+
+    /* RTC ticks (10 ms each) a guarded call may take before it is abandoned.
+     * The first tick can come at any time, so the real limit is between
+     * (TICKS - 1) * 10 ms and TICKS * 10 ms. */
+#define TEST_GUARD_TIMEOUT_TICKS 10
+
+    /* Run call as test case testCase of group under a timeout, and set
+     * status to how it ended. Variables assigned by call are not valid
+     * unless status is TEST_GUARD_OK. */
+#define TEST_GUARD_CALL(status, group, testCase, call)              \
+    do                                                              \
+    {                                                               \
+        switch (setjmp(testGuardJmp))                               \
+        {                                                           \
+            case 0:                                                 \
+                if (testGuardBegin((group), (testCase)) == false)   \
+                {                                                   \
+                    (status) = TEST_GUARD_FAULT;                    \
+                    break;                                          \
+                }                                                   \
+                call;                                               \
+                testGuardEnd();                                     \
+                (status) = TEST_GUARD_OK;                           \
+                break;                                              \
+            case TEST_GUARD_TIMEOUT:                                \
+                (status) = TEST_GUARD_TIMEOUT;                      \
+                break;                                              \
+            default:                                                \
+                (status) = TEST_GUARD_FAULT;                        \
+                break;                                              \
+        }                                                           \
+    } while (0)
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Data Types
+    // *****************************************************************************
+    // *****************************************************************************
+
+typedef enum
+{
+    TEST_GUARD_OK = 0,    // the call returned
+    TEST_GUARD_TIMEOUT,   // the call was abandoned after the timeout
+    TEST_GUARD_FAULT      // the call faulted, now or before the last reset
+} testGuardStatus;
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* context TEST_GUARD_CALL() returns to on a timeout or fault */
+extern jmp_buf testGuardJmp;
+
+    /* set PendSV to the lowest priority. Call once before any guarded call. */
+void testGuardInit(void);
+
+    /* mark a case as running and arm the timeout. Returns false, without
+     * arming, if the case has a fault record and must not be called. */
+bool testGuardBegin(resultTestId group, uint32_t testCase);
+
+    /* the guarded call returned: stop the timeout and clear the running case */
+void testGuardEnd(void);
+
+    /* leave the guarded call and make TEST_GUARD_CALL() report status */
+void testGuardAbandon(testGuardStatus status) __attribute__((noreturn));
+
+    /* make exception return from a handler resume in a trampoline that
+     * calls testGuardAbandon(status) instead of at the stacked PC */
+void testGuardRedirect(uint32_t *frame, testGuardStatus status);
+
+    /* advance the timeout; called every 10 ms from the RTC callback */
+void testGuardTick(void);
+
+    /* ticks seen so far; a change across a call means the RTC interrupt
+     * was taken during it */
+uint32_t testGuardTickCount(void);
+
+    /* print the TIMEOUT or FAULT line for a case of a group, or for a
+     * mode's packed value */
+void testGuardPrintFailure(testGuardStatus status,
+        resultTestId group,
+        uint32_t testCase,
+        volatile bool *txComplete);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TEST_GUARD_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/** Failure-history test ordering
+
+  @File Name
+    testSchedule.c
+
+  @Summary
+    Chooses the order in which each test group runs the tc[] cases, putting
+    the cases that failed most recently first.
+
+  @Description
+    See testSchedule.h for how the history is kept.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <string.h>
+#include <inttypes.h>
+#include "definitions.h"                // SYS function prototypes
+#include "printFuncs.h"  // lab print funcs
+#include "testVectors.h" // TEST_VECTOR_COUNT
+#include "testSchedule.h"
+
+#define MAX_PRINT_LEN 200
+
+#define USING_HW 1
+
+/* first word of valid history: "SCHD" */
+#define SCHEDULE_MAGIC 0x53434844UL
+
+_Static_assert(TEST_VECTOR_COUNT <= 0xFFFF,
+        "testSchedule stores case numbers in 16 bits");
+
+/* xc32 leaves persistent variables alone at startup, so they survive a reset */
+#if USING_HW
+#define SCHEDULE_PERSISTENT __attribute__((persistent))
+#else
+#define SCHEDULE_PERSISTENT
+#endif
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint8_t scheduleTxBuffer[MAX_PRINT_LEN] = {0};
+
+typedef struct _scheduleHistory
+{
+    uint32_t magic;       // SCHEDULE_MAGIC once initialized
+    uint32_t numCases;    // TEST_VECTOR_COUNT when the history was made
+    uint8_t failed[RESULT_NUM_TESTS][TEST_VECTOR_COUNT];  // see testSchedule.h
+} scheduleHistory;
+
+static scheduleHistory history SCHEDULE_PERSISTENT;
+
+/* tc[] indexes in run order for the group most recently ordered */
+static uint16_t scheduleOrder[TEST_VECTOR_COUNT];
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void testScheduleInit(void)
+{
+    if (history.magic != SCHEDULE_MAGIC || history.numCases != TEST_VECTOR_COUNT)
+    {
+        memset(&history, 0, sizeof(history));
+        history.magic = SCHEDULE_MAGIC;
+        history.numCases = TEST_VECTOR_COUNT;
+    }
+}
+
+void testScheduleOrder(resultTestId group)
+{
+    // counting sort on the history byte, highest first. It is stable, so
+    // cases with equal history stay in tc[] order.
+    static uint16_t start[256];
+    const uint8_t *failed = history.failed[group];
+
+    memset(start, 0, sizeof(start));
+    for (uint32_t i = 0; i < TEST_VECTOR_COUNT; ++i)
+    {
+        ++start[failed[i]];
+    }
+    uint32_t position = 0;
+    for (int32_t h = 255; h >= 0; --h)
+    {
+        uint32_t count = start[h];
+        start[h] = position;
+        position += count;
+    }
+    for (uint32_t i = 0; i < TEST_VECTOR_COUNT; ++i)
+    {
+        scheduleOrder[start[failed[i]]++] = i;
+    }
+}
+
+uint32_t testScheduleCase(uint32_t position)
+{
+    return scheduleOrder[position];
+}
+
+void testScheduleRecord(resultTestId group, uint32_t testCase, int32_t failCount)
+{
+    uint8_t *failed = &history.failed[group][testCase];
+    *failed = (*failed >> 1) | (failCount != 0 ? 0x80 : 0);
+}
+
+void testSchedulePrintStop(resultTestId group,
+        uint32_t testCase,
+        uint32_t casesRun,
+        volatile bool *txComplete)
+{
+    snprintf((char*)scheduleTxBuffer, MAX_PRINT_LEN,
+            "========= FAIL FAST: %s stopped at test case %lu "
+            "after %lu of %lu cases\r\n"
+            "\r\n",
+            resultTestNames[group], testCase, casesRun,
+            (uint32_t)TEST_VECTOR_COUNT);
+    printAndWait((char*)scheduleTxBuffer, txComplete);
+}
+
+/* *****************************************************************************
+ End of File
+ */
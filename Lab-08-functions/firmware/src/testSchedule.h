@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/** Failure-history test ordering
+
+  @File Name
+    testSchedule.h
+
+  @Summary
+    Chooses the order in which each test group runs the tc[] cases, putting
+    the cases that failed most recently first.
+
+  @Description
+    Every test case of every group has an 8-bit failure history. After a
+    case runs, its history is shifted right one bit and the top bit is set
+    if the case failed, so a case that failed last time sorts ahead of one
+    that failed several runs ago, which sorts ahead of one that has never
+    failed. Cases with equal history keep their tc[] order.
+
+    The history lives in RAM that the startup code does not clear, so it
+    survives a reset as long as the board stays powered; it is discarded if
+    the number of test vectors changes.
+
+    Combined with failFast in main.c, which stops a group at its first
+    failing case, this gets the first meaningful failure on the terminal
+    almost immediately after a reset.
+ */
+/* ************************************************************************** */
+
+#ifndef _TEST_SCHEDULE_H    /* Guard against multiple inclusion */
+#define _TEST_SCHEDULE_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "resultStore.h"  // resultTestId
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* keep the failure history from before the last reset if it is valid,
+     * otherwise clear it */
+void testScheduleInit(void);
+
+    /* sort the cases of one group by failure history. Call before the
+     * group's loop; testScheduleCase() then returns cases in that order. */
+void testScheduleOrder(resultTestId group);
+
+    /* index into tc[] of the case to run at position in the current order */
+uint32_t testScheduleCase(uint32_t position);
+
+    /* record whether a case of a group failed */
+void testScheduleRecord(resultTestId group, uint32_t testCase, int32_t failCount);
+
+    /* print the fail-fast message for a group that stopped at testCase */
+void testSchedulePrintStop(resultTestId group,
+        uint32_t testCase,
+        uint32_t casesRun,
+        volatile bool *txComplete);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TEST_SCHEDULE_H */
+
+/* *****************************************************************************
+ End of File
+ */
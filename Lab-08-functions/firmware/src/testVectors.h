@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/** Test vectors and compile-time expected values
+
+  @File Name
+    testVectors.h
+
+  @Summary
+    The list of packed test inputs, and macros that compute every expected
+    value for a packed input as a constant expression.
+
+  @Description
+    TEST_VECTORS(X) expands X(packedValue) once per test case. main.c uses it
+    twice: once to build tc[], the packed inputs, and once to build
+    tcExpected[], the matching expectedValues structs. Because TV_EXPECTED()
+    is a constant expression, the compiler computes the whole table and
+    places it in flash, indexed the same way as tc[]; nothing is computed
+    at run time and a large corpus costs no RAM.
+
+    To add a test case, add a line to TEST_VECTORS_BASE. To add a large
+    generated corpus, put "#define TEST_VECTORS_EXTRA(X) X(...) X(...) ..."
+    in a header and build with -DTEST_VECTORS_EXTRA_FILE='"thatHeader.h"'.
+
+    testVectorsPairwise.h, written by host/pairwiseVectors.c, holds 256
+    edge-case inputs that cover every pair of lane boundary classes (0, 1,
+    powers of two, MAX, MIN, ...) and lane signs. Build with
+    -DTEST_VECTORS_USE_PAIRWISE=1 to add them after TEST_VECTORS_BASE.
+
+    calcExpectedValues() in testFuncs.c uses the same macros, so run-time
+    and compile-time reference values cannot drift apart. The host tools
+    include this header to get the same corpus and reference.
+ */
+/* ************************************************************************** */
+
+#ifndef _TEST_VECTORS_H    /* Guard against multiple inclusion */
+#define _TEST_VECTORS_H
+
+#include <stdint.h>
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Reference Values                                                  */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* sign-extended multiplicand (upper 16 bits) and multiplier (lower 16 bits) */
+#define TV_A(p)       ((int32_t)(int16_t)((uint32_t)(p) >> 16))
+#define TV_B(p)       ((int32_t)(int16_t)((uint32_t)(p) & 0xFFFF))
+
+/* sign bit (0 for +, 1 for -) and absolute value of a sign-extended lane */
+#define TV_SIGN(x)    ((x) < 0 ? 1 : 0)
+#define TV_ABS(x)     ((x) < 0 ? -(x) : (x))
+
+/* initializer for an expectedValues struct (see testFuncs.h); the member
+ * order must match the struct */
+#define TV_EXPECTED(p) {                        \
+        (uint32_t)(p),                          \
+        TV_A(p),                                \
+        TV_B(p),                                \
+        TV_ABS(TV_A(p)),                        \
+        TV_ABS(TV_B(p)),                        \
+        TV_SIGN(TV_A(p)),                       \
+        TV_SIGN(TV_B(p)),                       \
+        TV_ABS(TV_A(p)) * TV_ABS(TV_B(p)),      \
+        TV_A(p) * TV_B(p)                       \
+    }
+
+/* X() helpers for building tables from TEST_VECTORS */
+#define TV_PACKED_ENTRY(p)    (int32_t)(p),
+#define TV_EXPECTED_ENTRY(p)  TV_EXPECTED(p),
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Test Vectors                                                      */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+/* each entry is a packed pair of {multiplicand, multiplier} values */
+#define TEST_VECTORS_BASE(X)                    \
+    X(0x00020003)                               \
+    X(0xFFFC0003)  /* -,+ */                    \
+    X(0x00000000)  /* 0,0 */                    \
+    X(0x00000005)  /* 0,+ */                    \
+    X(0x0000FFFC)  /* 0,- */                    \
+    X(0xFFFD0000)  /* -,0 */                    \
+    X(0x00020000)  /* +,0 */                    \
+    X(0x80008000)  /* -,- */                    \
+    X(0xFFF3FFE0)  /* -,- */                    \
+    X(0x7FF38001)  /* +,- */                    \
+    X(0x7FF17FF2)  /* +,+ */
+
+#ifndef TEST_VECTORS_USE_PAIRWISE
+#define TEST_VECTORS_USE_PAIRWISE 0
+#endif
+#if TEST_VECTORS_USE_PAIRWISE
+#include "testVectorsPairwise.h"
+#else
+#define TEST_VECTORS_PAIRWISE(X)
+#endif
+
+#ifdef TEST_VECTORS_EXTRA_FILE
+#include TEST_VECTORS_EXTRA_FILE
+#endif
+#ifndef TEST_VECTORS_EXTRA
+#define TEST_VECTORS_EXTRA(X)
+#endif
+
+#define TEST_VECTORS(X) \
+    TEST_VECTORS_BASE(X) TEST_VECTORS_PAIRWISE(X) TEST_VECTORS_EXTRA(X)
+
+/* number of entries in TEST_VECTORS, as a constant expression */
+#define TV_COUNT_ENTRY(p)     + 1
+#define TEST_VECTOR_COUNT     (0 TEST_VECTORS(TV_COUNT_ENTRY))
+
+#endif /* _TEST_VECTORS_H */
+
+/* *****************************************************************************
+ End of File
+ */
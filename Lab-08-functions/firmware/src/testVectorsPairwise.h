@@ -0,0 +1,259 @@
+/* Pairwise edge-case vectors: 16 lane classes, 256 rows.
+ * Generated by host/pairwiseVectors.c; do not edit. */
+#define TEST_VECTORS_PAIRWISE(X) \
+    X(0x00000000)  /*      0 *      0 */ \
+    X(0x0000FFFF)  /*      0 *     -1 */ \
+    X(0x00000002)  /*      0 *      2 */ \
+    X(0x0000FFFD)  /*      0 *     -3 */ \
+    X(0x00000010)  /*      0 *     16 */ \
+    X(0x0000FF80)  /*      0 *   -128 */ \
+    X(0x000000FF)  /*      0 *    255 */ \
+    X(0x0000FF00)  /*      0 *   -256 */ \
+    X(0x00000800)  /*      0 *   2048 */ \
+    X(0x0000F000)  /*      0 *  -4096 */ \
+    X(0x00004000)  /*      0 *  16384 */ \
+    X(0x0000AAAB)  /*      0 * -21845 */ \
+    X(0x00005556)  /*      0 *  21846 */ \
+    X(0x00008002)  /*      0 * -32766 */ \
+    X(0x00007FFF)  /*      0 *  32767 */ \
+    X(0x00008000)  /*      0 * -32768 */ \
+    X(0xFFFF0000)  /*     -1 *      0 */ \
+    X(0xFFFFFFFF)  /*     -1 *     -1 */ \
+    X(0xFFFFFFFE)  /*     -1 *     -2 */ \
+    X(0x00010003)  /*      1 *      3 */ \
+    X(0xFFFFFFF0)  /*     -1 *    -16 */ \
+    X(0xFFFF0080)  /*     -1 *    128 */ \
+    X(0xFFFFFF01)  /*     -1 *   -255 */ \
+    X(0xFFFF0100)  /*     -1 *    256 */ \
+    X(0xFFFFF800)  /*     -1 *  -2048 */ \
+    X(0xFFFF1000)  /*     -1 *   4096 */ \
+    X(0xFFFFC000)  /*     -1 * -16384 */ \
+    X(0xFFFF5555)  /*     -1 *  21845 */ \
+    X(0xFFFFAAAA)  /*     -1 * -21846 */ \
+    X(0xFFFF7FFE)  /*     -1 *  32766 */ \
+    X(0xFFFF8001)  /*     -1 * -32767 */ \
+    X(0xFFFF8000)  /*     -1 * -32768 */ \
+    X(0xFFFE0000)  /*     -2 *      0 */ \
+    X(0x00020001)  /*      2 *      1 */ \
+    X(0x0002FFFE)  /*      2 *     -2 */ \
+    X(0xFFFE0003)  /*     -2 *      3 */ \
+    X(0xFFFE0010)  /*     -2 *     16 */ \
+    X(0xFFFEFF80)  /*     -2 *   -128 */ \
+    X(0x000200FF)  /*      2 *    255 */ \
+    X(0x0002FF00)  /*      2 *   -256 */ \
+    X(0xFFFE0800)  /*     -2 *   2048 */ \
+    X(0xFFFEF000)  /*     -2 *  -4096 */ \
+    X(0x00024000)  /*      2 *  16384 */ \
+    X(0x0002AAAB)  /*      2 * -21845 */ \
+    X(0xFFFE5556)  /*     -2 *  21846 */ \
+    X(0xFFFE8002)  /*     -2 * -32766 */ \
+    X(0x00027FFF)  /*      2 *  32767 */ \
+    X(0x00028000)  /*      2 * -32768 */ \
+    X(0xFFFD0000)  /*     -3 *      0 */ \
+    X(0x0003FFFF)  /*      3 *     -1 */ \
+    X(0x0003FFFE)  /*      3 *     -2 */ \
+    X(0xFFFD0003)  /*     -3 *      3 */ \
+    X(0xFFFDFFF0)  /*     -3 *    -16 */ \
+    X(0x00030080)  /*      3 *    128 */ \
+    X(0x0003FF01)  /*      3 *   -255 */ \
+    X(0xFFFD0100)  /*     -3 *    256 */ \
+    X(0xFFFDF800)  /*     -3 *  -2048 */ \
+    X(0x00031000)  /*      3 *   4096 */ \
+    X(0x0003C000)  /*      3 * -16384 */ \
+    X(0xFFFD5555)  /*     -3 *  21845 */ \
+    X(0xFFFDAAAA)  /*     -3 * -21846 */ \
+    X(0x00037FFE)  /*      3 *  32766 */ \
+    X(0x00038001)  /*      3 * -32767 */ \
+    X(0xFFFD8000)  /*     -3 * -32768 */ \
+    X(0x00100000)  /*     16 *      0 */ \
+    X(0xFFF0FFFF)  /*    -16 *     -1 */ \
+    X(0xFFF00002)  /*    -16 *      2 */ \
+    X(0xFFF0FFFD)  /*    -16 *     -3 */ \
+    X(0x00100010)  /*     16 *     16 */ \
+    X(0x0010FF80)  /*     16 *   -128 */ \
+    X(0xFFF000FF)  /*    -16 *    255 */ \
+    X(0xFFF0FF00)  /*    -16 *   -256 */ \
+    X(0x00100800)  /*     16 *   2048 */ \
+    X(0x0010F000)  /*     16 *  -4096 */ \
+    X(0xFFF04000)  /*    -16 *  16384 */ \
+    X(0xFFF0AAAB)  /*    -16 * -21845 */ \
+    X(0x00105556)  /*     16 *  21846 */ \
+    X(0x00108002)  /*     16 * -32766 */ \
+    X(0xFFF07FFF)  /*    -16 *  32767 */ \
+    X(0xFFF08000)  /*    -16 * -32768 */ \
+    X(0x00800000)  /*    128 *      0 */ \
+    X(0xFF80FFFF)  /*   -128 *     -1 */ \
+    X(0xFF80FFFE)  /*   -128 *     -2 */ \
+    X(0x00800003)  /*    128 *      3 */ \
+    X(0x0080FFF0)  /*    128 *    -16 */ \
+    X(0xFF800080)  /*   -128 *    128 */ \
+    X(0xFF80FF01)  /*   -128 *   -255 */ \
+    X(0x00800100)  /*    128 *    256 */ \
+    X(0x0080F800)  /*    128 *  -2048 */ \
+    X(0xFF801000)  /*   -128 *   4096 */ \
+    X(0xFF80C000)  /*   -128 * -16384 */ \
+    X(0x00805555)  /*    128 *  21845 */ \
+    X(0x0080AAAA)  /*    128 * -21846 */ \
+    X(0xFF807FFE)  /*   -128 *  32766 */ \
+    X(0xFF808001)  /*   -128 * -32767 */ \
+    X(0x00808000)  /*    128 * -32768 */ \
+    X(0xFF010000)  /*   -255 *      0 */ \
+    X(0x00FFFFFF)  /*    255 *     -1 */ \
+    X(0x00FF0002)  /*    255 *      2 */ \
+    X(0x00FFFFFD)  /*    255 *     -3 */ \
+    X(0xFF010010)  /*   -255 *     16 */ \
+    X(0xFF01FF80)  /*   -255 *   -128 */ \
+    X(0x00FF00FF)  /*    255 *    255 */ \
+    X(0x00FFFF00)  /*    255 *   -256 */ \
+    X(0xFF010800)  /*   -255 *   2048 */ \
+    X(0xFF01F000)  /*   -255 *  -4096 */ \
+    X(0x00FF4000)  /*    255 *  16384 */ \
+    X(0x00FFAAAB)  /*    255 * -21845 */ \
+    X(0xFF015556)  /*   -255 *  21846 */ \
+    X(0xFF018002)  /*   -255 * -32766 */ \
+    X(0x00FF7FFF)  /*    255 *  32767 */ \
+    X(0x00FF8000)  /*    255 * -32768 */ \
+    X(0xFF000000)  /*   -256 *      0 */ \
+    X(0x0100FFFF)  /*    256 *     -1 */ \
+    X(0x0100FFFE)  /*    256 *     -2 */ \
+    X(0xFF000003)  /*   -256 *      3 */ \
+    X(0xFF00FFF0)  /*   -256 *    -16 */ \
+    X(0x01000080)  /*    256 *    128 */ \
+    X(0x0100FF01)  /*    256 *   -255 */ \
+    X(0xFF000100)  /*   -256 *    256 */ \
+    X(0xFF00F800)  /*   -256 *  -2048 */ \
+    X(0x01001000)  /*    256 *   4096 */ \
+    X(0x0100C000)  /*    256 * -16384 */ \
+    X(0xFF005555)  /*   -256 *  21845 */ \
+    X(0xFF00AAAA)  /*   -256 * -21846 */ \
+    X(0x01007FFE)  /*    256 *  32766 */ \
+    X(0x01008001)  /*    256 * -32767 */ \
+    X(0xFF008000)  /*   -256 * -32768 */ \
+    X(0x08000000)  /*   2048 *      0 */ \
+    X(0xF800FFFF)  /*  -2048 *     -1 */ \
+    X(0xF8000002)  /*  -2048 *      2 */ \
+    X(0xF800FFFD)  /*  -2048 *     -3 */ \
+    X(0x08000010)  /*   2048 *     16 */ \
+    X(0x0800FF80)  /*   2048 *   -128 */ \
+    X(0xF80000FF)  /*  -2048 *    255 */ \
+    X(0xF800FF00)  /*  -2048 *   -256 */ \
+    X(0x08000800)  /*   2048 *   2048 */ \
+    X(0x0800F000)  /*   2048 *  -4096 */ \
+    X(0xF8004000)  /*  -2048 *  16384 */ \
+    X(0xF800AAAB)  /*  -2048 * -21845 */ \
+    X(0x08005556)  /*   2048 *  21846 */ \
+    X(0x08008002)  /*   2048 * -32766 */ \
+    X(0xF8007FFF)  /*  -2048 *  32767 */ \
+    X(0xF8008000)  /*  -2048 * -32768 */ \
+    X(0x10000000)  /*   4096 *      0 */ \
+    X(0xF000FFFF)  /*  -4096 *     -1 */ \
+    X(0xF000FFFE)  /*  -4096 *     -2 */ \
+    X(0x10000003)  /*   4096 *      3 */ \
+    X(0x1000FFF0)  /*   4096 *    -16 */ \
+    X(0xF0000080)  /*  -4096 *    128 */ \
+    X(0xF000FF01)  /*  -4096 *   -255 */ \
+    X(0x10000100)  /*   4096 *    256 */ \
+    X(0x1000F800)  /*   4096 *  -2048 */ \
+    X(0xF0001000)  /*  -4096 *   4096 */ \
+    X(0xF000C000)  /*  -4096 * -16384 */ \
+    X(0x10005555)  /*   4096 *  21845 */ \
+    X(0x1000AAAA)  /*   4096 * -21846 */ \
+    X(0xF0007FFE)  /*  -4096 *  32766 */ \
+    X(0xF0008001)  /*  -4096 * -32767 */ \
+    X(0x10008000)  /*   4096 * -32768 */ \
+    X(0xC0000000)  /* -16384 *      0 */ \
+    X(0x4000FFFF)  /*  16384 *     -1 */ \
+    X(0x40000002)  /*  16384 *      2 */ \
+    X(0x4000FFFD)  /*  16384 *     -3 */ \
+    X(0xC0000010)  /* -16384 *     16 */ \
+    X(0xC000FF80)  /* -16384 *   -128 */ \
+    X(0x400000FF)  /*  16384 *    255 */ \
+    X(0x4000FF00)  /*  16384 *   -256 */ \
+    X(0xC0000800)  /* -16384 *   2048 */ \
+    X(0xC000F000)  /* -16384 *  -4096 */ \
+    X(0x40004000)  /*  16384 *  16384 */ \
+    X(0x4000AAAB)  /*  16384 * -21845 */ \
+    X(0xC0005556)  /* -16384 *  21846 */ \
+    X(0xC0008002)  /* -16384 * -32766 */ \
+    X(0x40007FFF)  /*  16384 *  32767 */ \
+    X(0x40008000)  /*  16384 * -32768 */ \
+    X(0xAAAB0000)  /* -21845 *      0 */ \
+    X(0x5555FFFF)  /*  21845 *     -1 */ \
+    X(0x5555FFFE)  /*  21845 *     -2 */ \
+    X(0xAAAB0003)  /* -21845 *      3 */ \
+    X(0xAAABFFF0)  /* -21845 *    -16 */ \
+    X(0x55550080)  /*  21845 *    128 */ \
+    X(0x5555FF01)  /*  21845 *   -255 */ \
+    X(0xAAAB0100)  /* -21845 *    256 */ \
+    X(0xAAABF800)  /* -21845 *  -2048 */ \
+    X(0x55551000)  /*  21845 *   4096 */ \
+    X(0x5555C000)  /*  21845 * -16384 */ \
+    X(0xAAAB5555)  /* -21845 *  21845 */ \
+    X(0xAAABAAAA)  /* -21845 * -21846 */ \
+    X(0x55557FFE)  /*  21845 *  32766 */ \
+    X(0x55558001)  /*  21845 * -32767 */ \
+    X(0xAAAB8000)  /* -21845 * -32768 */ \
+    X(0x55560000)  /*  21846 *      0 */ \
+    X(0xAAAAFFFF)  /* -21846 *     -1 */ \
+    X(0xAAAA0002)  /* -21846 *      2 */ \
+    X(0xAAAAFFFD)  /* -21846 *     -3 */ \
+    X(0x55560010)  /*  21846 *     16 */ \
+    X(0x5556FF80)  /*  21846 *   -128 */ \
+    X(0xAAAA00FF)  /* -21846 *    255 */ \
+    X(0xAAAAFF00)  /* -21846 *   -256 */ \
+    X(0x55560800)  /*  21846 *   2048 */ \
+    X(0x5556F000)  /*  21846 *  -4096 */ \
+    X(0xAAAA4000)  /* -21846 *  16384 */ \
+    X(0xAAAAAAAB)  /* -21846 * -21845 */ \
+    X(0x55565556)  /*  21846 *  21846 */ \
+    X(0x55568002)  /*  21846 * -32766 */ \
+    X(0xAAAA7FFF)  /* -21846 *  32767 */ \
+    X(0xAAAA8000)  /* -21846 * -32768 */ \
+    X(0x7FFE0000)  /*  32766 *      0 */ \
+    X(0x8002FFFF)  /* -32766 *     -1 */ \
+    X(0x8002FFFE)  /* -32766 *     -2 */ \
+    X(0x7FFE0003)  /*  32766 *      3 */ \
+    X(0x7FFEFFF0)  /*  32766 *    -16 */ \
+    X(0x80020080)  /* -32766 *    128 */ \
+    X(0x8002FF01)  /* -32766 *   -255 */ \
+    X(0x7FFE0100)  /*  32766 *    256 */ \
+    X(0x7FFEF800)  /*  32766 *  -2048 */ \
+    X(0x80021000)  /* -32766 *   4096 */ \
+    X(0x8002C000)  /* -32766 * -16384 */ \
+    X(0x7FFE5555)  /*  32766 *  21845 */ \
+    X(0x7FFEAAAA)  /*  32766 * -21846 */ \
+    X(0x80027FFE)  /* -32766 *  32766 */ \
+    X(0x80028001)  /* -32766 * -32767 */ \
+    X(0x7FFE8000)  /*  32766 * -32768 */ \
+    X(0x80010000)  /* -32767 *      0 */ \
+    X(0x7FFFFFFF)  /*  32767 *     -1 */ \
+    X(0x7FFF0002)  /*  32767 *      2 */ \
+    X(0x7FFFFFFD)  /*  32767 *     -3 */ \
+    X(0x80010010)  /* -32767 *     16 */ \
+    X(0x8001FF80)  /* -32767 *   -128 */ \
+    X(0x7FFF00FF)  /*  32767 *    255 */ \
+    X(0x7FFFFF00)  /*  32767 *   -256 */ \
+    X(0x80010800)  /* -32767 *   2048 */ \
+    X(0x8001F000)  /* -32767 *  -4096 */ \
+    X(0x7FFF4000)  /*  32767 *  16384 */ \
+    X(0x7FFFAAAB)  /*  32767 * -21845 */ \
+    X(0x80015556)  /* -32767 *  21846 */ \
+    X(0x80018002)  /* -32767 * -32766 */ \
+    X(0x7FFF7FFF)  /*  32767 *  32767 */ \
+    X(0x7FFF8000)  /*  32767 * -32768 */ \
+    X(0x80000000)  /* -32768 *      0 */ \
+    X(0x8000FFFF)  /* -32768 *     -1 */ \
+    X(0x8000FFFE)  /* -32768 *     -2 */ \
+    X(0x80000003)  /* -32768 *      3 */ \
+    X(0x8000FFF0)  /* -32768 *    -16 */ \
+    X(0x80000080)  /* -32768 *    128 */ \
+    X(0x8000FF01)  /* -32768 *   -255 */ \
+    X(0x80000100)  /* -32768 *    256 */ \
+    X(0x8000F800)  /* -32768 *  -2048 */ \
+    X(0x80001000)  /* -32768 *   4096 */ \
+    X(0x8000C000)  /* -32768 * -16384 */ \
+    X(0x80005555)  /* -32768 *  21845 */ \
+    X(0x8000AAAA)  /* -32768 * -21846 */ \
+    X(0x80007FFE)  /* -32768 *  32766 */ \
+    X(0x80008001)  /* -32768 * -32767 */ \
+    X(0x80008000)  /* -32768 * -32768 */
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/** SERCOM5 outside the print queue
+
+  @File Name
+    uartPort.c
+
+  @Summary
+    Polled SERCOM5 I/O and rate changes, for the baud rate handshake.
+
+  @Description
+    See uartPort.h.
+ */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include "definitions.h"                // SYS function prototypes
+#include "uartPort.h"
+
+#define USING_HW 1
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: File Scope or Global Data                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+static uint32_t uartRate = BAUD_NEGOTIATE_START_RATE;
+
+#if USING_HW
+/* DWT->CYCCNT wraps every 36 s at 120 MHz; whole milliseconds are taken
+ * out of it as they pass */
+static uint32_t uartLastCycles = 0;
+static uint32_t uartMillis = 0;
+
+#define UART_CYCLES_PER_MS (CPU_CLOCK_FREQUENCY / 1000)
+#endif
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Local Functions                                                   */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#if USING_HW
+static void uartWrite(void *ctx, const char *bytes, uint32_t n)
+{
+    (void)ctx;
+    SERCOM5_USART_Write((void *)bytes, n);
+    // writing DATA cleared TXC; it is set again once the last stop bit
+    // has gone
+    while (SERCOM5_USART_TransmitComplete() == false)
+    {
+    }
+}
+
+static int32_t uartRead(void *ctx)
+{
+    (void)ctx;
+    if (SERCOM5_USART_ReceiverIsReady() == false)
+    {
+        return -1;
+    }
+    return SERCOM5_USART_ReadByte() & 0xFF;
+}
+
+static bool uartErrorSeen(void *ctx)
+{
+    (void)ctx;
+    // ErrorGet() also clears the errors and the bytes they came with
+    return SERCOM5_USART_ErrorGet() != USART_ERROR_NONE;
+}
+
+static bool uartSetRate(void *ctx, uint32_t rate)
+{
+    (void)ctx;
+    USART_SERIAL_SETUP setup = {
+        .baudRate = rate,
+        .parity = USART_PARITY_NONE,
+        .dataWidth = USART_DATA_8_BIT,
+        .stopBits = USART_STOP_1_BIT
+    };
+    // 0: SERCOM5_USART_FrequencyGet(), the 60 MHz GCLK1
+    return SERCOM5_USART_SerialSetup(&setup, 0);
+}
+
+static uint32_t uartMillisGet(void *ctx)
+{
+    (void)ctx;
+    uint32_t elapsed = DWT->CYCCNT - uartLastCycles;
+    uint32_t ms = elapsed / UART_CYCLES_PER_MS;
+    uartLastCycles += ms * UART_CYCLES_PER_MS;
+    uartMillis += ms;
+    return uartMillis;
+}
+#endif
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Interface Functions                                               */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+uint32_t uartPortNegotiate(void)
+{
+#if USING_HW && BAUD_NEGOTIATE_ENABLE
+    static const baudNegotiateLink link = {
+        .ctx = NULL,
+        .write = uartWrite,
+        .read = uartRead,
+        .errorSeen = uartErrorSeen,
+        .setRate = uartSetRate,
+        .millis = uartMillisGet
+    };
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    uartLastCycles = DWT->CYCCNT;
+
+    SERCOM5_USART_ReceiverEnable();
+    (void)SERCOM5_USART_ErrorGet();
+    uartRate = baudNegotiateBoard(&link);
+    SERCOM5_USART_ReceiverDisable();
+#endif
+    return uartRate;
+}
+
+uint32_t uartPortRate(void)
+{
+    return uartRate;
+}
+
+/* *****************************************************************************
+ End of File
+ */
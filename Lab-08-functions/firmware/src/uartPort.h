@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/** SERCOM5 outside the print queue
+
+  @File Name
+    uartPort.h
+
+  @Summary
+    Polled SERCOM5 I/O and rate changes, for the baud rate handshake.
+
+  @Description
+    printQueue.c owns SERCOM5's transmitter once the tests run. Before
+    that, uartPortNegotiate() runs the board's end of the handshake in
+    baudNegotiate.h over SERCOM5 directly: polled writes, polled reads
+    (console.c takes the receiver over afterwards), SERCOM5_USART_ErrorGet()
+    for framing errors and SERCOM5_USART_SerialSetup() for the rate.
+    Timeouts count DWT->CYCCNT.
+
+    Build with -DBAUD_NEGOTIATE_ENABLE=0 to stay at 115200 without the
+    offer line. When USING_HW is 0 there is no UART and the rate is
+    always BAUD_NEGOTIATE_START_RATE.
+ */
+/* ************************************************************************** */
+
+#ifndef _UART_PORT_H    /* Guard against multiple inclusion */
+#define _UART_PORT_H
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+/* Section: Included Files                                                    */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+#include <stdint.h>
+
+#include "baudNegotiate.h"
+
+
+/* Provide C++ Compatibility */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+    // *****************************************************************************
+    // *****************************************************************************
+    // Section: Interface Functions
+    // *****************************************************************************
+    // *****************************************************************************
+
+    /* negotiate the rate with the host, if one answers; returns the rate
+     * SERCOM5 is left at. Call once, after SYS_Initialize() and before
+     * anything is printed. */
+uint32_t uartPortNegotiate(void);
+
+    /* the rate SERCOM5 runs at */
+uint32_t uartPortRate(void);
+
+
+    /* Provide C++ Compatibility */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _UART_PORT_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,640 @@
+/* ************************************************************************** */
+/** Assembles an asmMult.s and links it into a memory image for thumbEmu
+
+  @File Name
+    armObject.cpp
+
+  @Summary
+    Runs the ARM assembler on a .s file, then places the sections of the
+    object file in flash and SRAM and applies its relocations, the way the
+    linker would for the board.
+
+  @Description
+    See armObject.h. Relocation names and formulas are from the ELF for the
+    ARM Architecture specification (S: symbol address, A: addend, T: 1 for
+    a Thumb function, P: address of the place).
+ */
+/* ************************************************************************** */
+
+#include "armObject.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+
+namespace lab
+{
+
+namespace
+{
+
+/* ELF constants used below */
+enum
+{
+    ET_REL = 1,
+    EM_ARM = 40,
+    SHT_SYMTAB = 2,
+    SHT_RELA = 4,
+    SHT_NOBITS = 8,
+    SHT_REL = 9,
+    SHF_WRITE = 0x1,
+    SHF_ALLOC = 0x2,
+    SHN_UNDEF = 0,
+    SHN_ABS = 0xFFF1,
+    SHN_COMMON = 0xFFF2,
+    STB_LOCAL = 0,
+    STT_FUNC = 2,
+    STT_SECTION = 3,
+    STT_FILE = 4
+};
+
+/* relocation types */
+enum
+{
+    R_ARM_NONE = 0,
+    R_ARM_ABS32 = 2,
+    R_ARM_REL32 = 3,
+    R_ARM_THM_CALL = 10,
+    R_ARM_THM_PC8 = 11,
+    R_ARM_THM_JUMP24 = 30,
+    R_ARM_V4BX = 40,
+    R_ARM_PREL31 = 42,
+    R_ARM_THM_MOVW_ABS_NC = 47,
+    R_ARM_THM_MOVT_ABS = 48,
+    R_ARM_THM_JUMP19 = 51,
+    R_ARM_THM_PC12 = 54,
+    R_ARM_THM_JUMP11 = 102,
+    R_ARM_THM_JUMP8 = 103
+};
+
+struct SectionHeader
+{
+    uint32_t name;
+    uint32_t type;
+    uint32_t flags;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t link;
+    uint32_t info;
+    uint32_t align;
+    uint32_t entsize;
+};
+
+/* where a placed section went */
+struct Placement
+{
+    bool placed = false;
+    bool inRam = false;
+    uint32_t addr = 0;
+};
+
+uint32_t get16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+uint32_t get32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void put16(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+void put32(uint8_t *p, uint32_t value)
+{
+    put16(p, value);
+    put16(p + 2, value >> 16);
+}
+
+int32_t signExtend(uint32_t value, uint32_t bits)
+{
+    uint32_t m = 1u << (bits - 1);
+    value &= (1u << bits) - 1;
+    return (int32_t)((value ^ m) - m);
+}
+
+uint32_t alignUp(uint32_t value, uint32_t align)
+{
+    return align <= 1 ? value : (value + align - 1) & ~(align - 1);
+}
+
+std::string shellQuote(const std::string &s)
+{
+    std::string quoted = "'";
+    for (char ch : s)
+    {
+        if (ch == '\'')
+        {
+            quoted += "'\\''";
+        }
+        else
+        {
+            quoted += ch;
+        }
+    }
+    return quoted + "'";
+}
+
+/* the 25-bit offset of a BL or B.W (encoding T4) */
+int32_t thumbBranch24(const uint8_t *p)
+{
+    uint32_t hw1 = get16(p);
+    uint32_t hw2 = get16(p + 2);
+    uint32_t s = (hw1 >> 10) & 1;
+    uint32_t i1 = (~((hw2 >> 13) ^ s)) & 1;
+    uint32_t i2 = (~((hw2 >> 11) ^ s)) & 1;
+    return signExtend((s << 24) | (i1 << 23) | (i2 << 22) |
+            ((hw1 & 0x3FF) << 12) | ((hw2 & 0x7FF) << 1), 25);
+}
+
+void setThumbBranch24(uint8_t *p, uint32_t offset, bool isCall)
+{
+    uint32_t s = (offset >> 24) & 1;
+    uint32_t j1 = (~((offset >> 23) ^ s)) & 1;
+    uint32_t j2 = (~((offset >> 22) ^ s)) & 1;
+    uint32_t hw2 = get16(p + 2) & 0xD000;
+    if (isCall)
+    {
+        hw2 |= 0x1000;      // BL, never BLX: M-profile has no ARM state
+    }
+    put16(p, (get16(p) & 0xF800) | (s << 10) | ((offset >> 12) & 0x3FF));
+    put16(p + 2, hw2 | (j1 << 13) | (j2 << 11) | ((offset >> 1) & 0x7FF));
+}
+
+/* the 21-bit offset of a B<c>.W (encoding T3) */
+int32_t thumbBranch19(const uint8_t *p)
+{
+    uint32_t hw1 = get16(p);
+    uint32_t hw2 = get16(p + 2);
+    return signExtend((((hw1 >> 10) & 1) << 20) | (((hw2 >> 11) & 1) << 19) |
+            (((hw2 >> 13) & 1) << 18) | ((hw1 & 0x3F) << 12) |
+            ((hw2 & 0x7FF) << 1), 21);
+}
+
+void setThumbBranch19(uint8_t *p, uint32_t offset)
+{
+    put16(p, (get16(p) & 0xFBC0) | (((offset >> 20) & 1) << 10) |
+            ((offset >> 12) & 0x3F));
+    put16(p + 2, (get16(p + 2) & 0xD000) | (((offset >> 18) & 1) << 13) |
+            (((offset >> 19) & 1) << 11) | ((offset >> 1) & 0x7FF));
+}
+
+/* imm16 of a MOVW or MOVT */
+uint32_t thumbImm16(const uint8_t *p)
+{
+    uint32_t hw1 = get16(p);
+    uint32_t hw2 = get16(p + 2);
+    return ((hw1 & 0xF) << 12) | (((hw1 >> 10) & 1) << 11) |
+            (((hw2 >> 12) & 7) << 8) | (hw2 & 0xFF);
+}
+
+void setThumbImm16(uint8_t *p, uint32_t imm)
+{
+    put16(p, (get16(p) & 0xFBF0) | ((imm >> 12) & 0xF) |
+            (((imm >> 11) & 1) << 10));
+    put16(p + 2, (get16(p + 2) & 0x8F00) | (((imm >> 8) & 7) << 12) |
+            (imm & 0xFF));
+}
+
+bool fits(int64_t value, uint32_t bits)
+{
+    return value >= -(1LL << (bits - 1)) && value < (1LL << (bits - 1));
+}
+
+/* apply one relocation at place (address p). Returns false with error
+ * set if the type is unknown or the result does not fit. */
+bool applyRelocation(uint32_t type, uint32_t s, uint32_t t, uint32_t p,
+        uint8_t *place, bool haveAddend, int32_t addend, std::string &error)
+{
+    int32_t a = addend;
+    int64_t value;
+    char buf[96];
+
+    switch (type)
+    {
+        case R_ARM_NONE:
+        case R_ARM_V4BX:
+            return true;
+        case R_ARM_ABS32:
+            a = haveAddend ? a : (int32_t)get32(place);
+            put32(place, (s + a) | t);
+            return true;
+        case R_ARM_REL32:
+            a = haveAddend ? a : (int32_t)get32(place);
+            put32(place, ((s + a) | t) - p);
+            return true;
+        case R_ARM_PREL31:
+            a = haveAddend ? a : signExtend(get32(place), 31);
+            put32(place, (get32(place) & 0x80000000u) |
+                    ((((s + a) | t) - p) & 0x7FFFFFFFu));
+            return true;
+        case R_ARM_THM_CALL:
+        case R_ARM_THM_JUMP24:
+            // every branch target is Thumb code on a Cortex-M, so T is not
+            // needed to pick between BL and BLX
+            a = haveAddend ? a : thumbBranch24(place);
+            value = (int64_t)s + a - p;
+            if (fits(value, 25) == false)
+            {
+                break;
+            }
+            setThumbBranch24(place, (uint32_t)value, type == R_ARM_THM_CALL);
+            return true;
+        case R_ARM_THM_JUMP19:
+            a = haveAddend ? a : thumbBranch19(place);
+            value = (int64_t)s + a - p;
+            if (fits(value, 21) == false)
+            {
+                break;
+            }
+            setThumbBranch19(place, (uint32_t)value);
+            return true;
+        case R_ARM_THM_MOVW_ABS_NC:
+            a = haveAddend ? a : signExtend(thumbImm16(place), 16);
+            setThumbImm16(place, ((s + a) | t) & 0xFFFF);
+            return true;
+        case R_ARM_THM_MOVT_ABS:
+            a = haveAddend ? a : signExtend(thumbImm16(place), 16);
+            setThumbImm16(place, (s + a) >> 16);
+            return true;
+        case R_ARM_THM_PC8:
+            // ADR, LDR (literal): an imm8 of 0xFF encodes the usual A = -4
+            a = haveAddend ? a : (int32_t)((((get16(place) & 0xFF) << 2) + 4) &
+                    0x3FF) - 4;
+            value = (int64_t)s + a - (p & ~3u);
+            if (value < 0 || value > 1020 || (value & 3) != 0)
+            {
+                break;
+            }
+            put16(place, (get16(place) & 0xFF00) | (uint32_t)(value >> 2));
+            return true;
+        case R_ARM_THM_PC12:
+        {
+            // LDR.W (literal)
+            uint32_t hw1 = get16(place);
+            uint32_t imm12 = get16(place + 2) & 0xFFF;
+            a = haveAddend ? a : ((hw1 & 0x80) != 0 ? (int32_t)imm12 :
+                    -(int32_t)imm12);
+            value = (int64_t)s + a - (p & ~3u);
+            if (value <= -4096 || value >= 4096)
+            {
+                break;
+            }
+            hw1 = (hw1 & ~0x80u) | (value >= 0 ? 0x80 : 0);
+            put16(place, hw1);
+            put16(place + 2, (get16(place + 2) & 0xF000) |
+                    (uint32_t)(value >= 0 ? value : -value));
+            return true;
+        }
+        case R_ARM_THM_JUMP11:
+            a = haveAddend ? a : signExtend((get16(place) & 0x7FF) << 1, 12);
+            value = (int64_t)s + a - p;
+            if (fits(value, 12) == false)
+            {
+                break;
+            }
+            put16(place, (get16(place) & 0xF800) |
+                    (((uint32_t)value >> 1) & 0x7FF));
+            return true;
+        case R_ARM_THM_JUMP8:
+            a = haveAddend ? a : signExtend((get16(place) & 0xFF) << 1, 9);
+            value = (int64_t)s + a - p;
+            if (fits(value, 9) == false)
+            {
+                break;
+            }
+            put16(place, (get16(place) & 0xFF00) |
+                    (((uint32_t)value >> 1) & 0xFF));
+            return true;
+        default:
+            snprintf(buf, sizeof(buf), "unsupported relocation type %u at 0x%08x",
+                    type, p);
+            error = buf;
+            return false;
+    }
+    snprintf(buf, sizeof(buf), "relocation type %u at 0x%08x out of range",
+            type, p);
+    error = buf;
+    return false;
+}
+
+} // namespace
+
+
+bool ArmImage::lookup(const std::string &name, uint32_t &value) const
+{
+    auto it = symbols.find(name);
+    if (it == symbols.end())
+    {
+        return false;
+    }
+    value = it->second;
+    return true;
+}
+
+bool assembleArm(const std::string &cc, const std::string &shimDir,
+        const std::string &source, const std::string &objectPath,
+        std::string &error)
+{
+    std::string cmd = cc + " -c -x assembler-with-cpp -mcpu=cortex-m4 -mthumb"
+            " -I" + shellQuote(shimDir) + " -o " + shellQuote(objectPath) +
+            " " + shellQuote(source) + " 2>&1";
+    FILE *pipe = popen(cmd.c_str(), "r");
+    if (pipe == nullptr)
+    {
+        error = "could not run " + cc;
+        return false;
+    }
+    std::string output;
+    char buf[256];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), pipe)) > 0)
+    {
+        output.append(buf, n);
+    }
+    int status = pclose(pipe);
+    if (status != 0)
+    {
+        error = output.empty() ? cc + " failed" : output;
+        return false;
+    }
+    return true;
+}
+
+bool loadArmObject(const std::string &path, ArmImage &image,
+        std::string &error)
+{
+    std::ifstream in(path, std::ios::binary);
+    std::vector<uint8_t> elf((std::istreambuf_iterator<char>(in)),
+            std::istreambuf_iterator<char>());
+    if (elf.size() < 52 || memcmp(elf.data(), "\x7F" "ELF\x01\x01", 6) != 0 ||
+            get16(&elf[16]) != ET_REL || get16(&elf[18]) != EM_ARM)
+    {
+        error = path + ": not a 32-bit little-endian ARM object file";
+        return false;
+    }
+
+    uint32_t shoff = get32(&elf[32]);
+    uint32_t shentsize = get16(&elf[46]);
+    uint32_t shnum = get16(&elf[48]);
+    uint32_t shstrndx = get16(&elf[50]);
+    if (shentsize < 40 || (uint64_t)shoff + (uint64_t)shnum * shentsize > elf.size())
+    {
+        error = path + ": bad section header table";
+        return false;
+    }
+
+    std::vector<SectionHeader> sh(shnum);
+    for (uint32_t i = 0; i < shnum; ++i)
+    {
+        const uint8_t *h = &elf[shoff + i * shentsize];
+        sh[i] = {get32(h), get32(h + 4), get32(h + 8), get32(h + 16),
+                get32(h + 20), get32(h + 24), get32(h + 28), get32(h + 32),
+                get32(h + 36)};
+        if (sh[i].type != SHT_NOBITS &&
+                (uint64_t)sh[i].offset + sh[i].size > elf.size())
+        {
+            error = path + ": section extends past the end of the file";
+            return false;
+        }
+    }
+    auto sectionName = [&](uint32_t i) -> std::string
+    {
+        if (shstrndx >= shnum || sh[shstrndx].offset + sh[i].name >= elf.size())
+        {
+            return "?";
+        }
+        return (const char *)&elf[sh[shstrndx].offset + sh[i].name];
+    };
+
+    // place the allocated sections: code and constants in flash, the rest
+    // in SRAM
+    image = ArmImage();
+    std::vector<Placement> placed(shnum);
+    for (uint32_t i = 0; i < shnum; ++i)
+    {
+        if ((sh[i].flags & SHF_ALLOC) == 0)
+        {
+            continue;
+        }
+        bool inRam = (sh[i].flags & SHF_WRITE) != 0;
+        std::vector<uint8_t> &mem = inRam ? image.ram : image.flash;
+        uint32_t base = inRam ? image.ramBase : image.flashBase;
+        uint32_t offset = alignUp((uint32_t)mem.size(), sh[i].align);
+        mem.resize(offset, 0);
+        if (sh[i].type == SHT_NOBITS)
+        {
+            mem.resize(offset + sh[i].size, 0);
+        }
+        else
+        {
+            mem.insert(mem.end(), elf.begin() + sh[i].offset,
+                    elf.begin() + sh[i].offset + sh[i].size);
+        }
+        placed[i] = {true, inRam, base + offset};
+    }
+    auto placeBytes = [&](uint32_t addr) -> uint8_t *
+    {
+        if (addr >= image.ramBase && addr - image.ramBase < image.ram.size())
+        {
+            return &image.ram[addr - image.ramBase];
+        }
+        return &image.flash[addr - image.flashBase];
+    };
+
+    // symbols; .comm symbols are given space at the end of SRAM
+    uint32_t symtab = shnum;
+    for (uint32_t i = 0; i < shnum; ++i)
+    {
+        if (sh[i].type == SHT_SYMTAB)
+        {
+            symtab = i;
+        }
+    }
+    std::vector<uint32_t> symValue;
+    std::vector<bool> symDefined;
+    std::vector<std::string> symName;
+    std::vector<uint8_t> symType;
+    if (symtab < shnum && sh[symtab].link < shnum)
+    {
+        const SectionHeader &st = sh[symtab];
+        const SectionHeader &str = sh[st.link];
+        uint32_t count = st.size / 16;
+        std::map<std::string, uint32_t> globals;
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            const uint8_t *e = &elf[st.offset + k * 16];
+            uint32_t nameOffset = get32(e);
+            uint32_t value = get32(e + 4);
+            uint32_t size = get32(e + 8);
+            uint8_t info = e[12];
+            uint32_t shndx = get16(e + 14);
+            std::string name = nameOffset < str.size ?
+                    (const char *)&elf[str.offset + nameOffset] : "";
+            bool defined = true;
+
+            if (shndx == SHN_UNDEF)
+            {
+                defined = k == 0;
+            }
+            else if (shndx == SHN_COMMON)
+            {
+                uint32_t offset = alignUp((uint32_t)image.ram.size(), value);
+                image.ram.resize(offset + size, 0);
+                value = image.ramBase + offset;
+            }
+            else if (shndx < shnum && placed[shndx].placed)
+            {
+                value += placed[shndx].addr;
+            }
+            else if (shndx != SHN_ABS)
+            {
+                // in a section that is not loaded (debug info and the like)
+                value = 0;
+            }
+            symValue.push_back(value);
+            symDefined.push_back(defined);
+            symName.push_back(name);
+            symType.push_back(info & 0xF);
+
+            uint32_t type = info & 0xF;
+            if (defined && name.empty() == false && type != STT_SECTION &&
+                    type != STT_FILE && name[0] != '$')
+            {
+                // a global wins over a local of the same name
+                if ((info >> 4) != STB_LOCAL)
+                {
+                    globals[name] = value;
+                }
+                else
+                {
+                    image.symbols[name] = value;
+                }
+            }
+        }
+        for (const auto &g : globals)
+        {
+            image.symbols[g.first] = g.second;
+        }
+    }
+
+    // relocations
+    for (uint32_t i = 0; i < shnum; ++i)
+    {
+        if (sh[i].type != SHT_REL && sh[i].type != SHT_RELA)
+        {
+            continue;
+        }
+        if (sh[i].info >= shnum || placed[sh[i].info].placed == false)
+        {
+            continue;       // relocates debug information
+        }
+        bool rela = sh[i].type == SHT_RELA;
+        uint32_t entsize = rela ? 12 : 8;
+        uint32_t target = sh[i].info;
+        for (uint32_t k = 0; k < sh[i].size / entsize; ++k)
+        {
+            const uint8_t *e = &elf[sh[i].offset + k * entsize];
+            uint32_t offset = get32(e);
+            uint32_t info = get32(e + 4);
+            uint32_t sym = info >> 8;
+            uint32_t type = info & 0xFF;
+            int32_t addend = rela ? (int32_t)get32(e + 8) : 0;
+            if (offset + 2 > sh[target].size)
+            {
+                error = path + ": relocation outside " + sectionName(target);
+                return false;
+            }
+            if (sym >= symValue.size() || (sym != 0 && symDefined[sym] == false))
+            {
+                error = path + ": undefined symbol " +
+                        (sym < symName.size() ? symName[sym] : "?");
+                return false;
+            }
+            uint32_t s = symValue[sym];
+            uint32_t t = 0;
+            if (symType[sym] == STT_FUNC)
+            {
+                t = s & 1;
+                s &= ~1u;
+            }
+            uint32_t p = placed[target].addr + offset;
+            if (applyRelocation(type, s, t, p, placeBytes(p), rela, addend,
+                    error) == false)
+            {
+                error = path + ": " + sectionName(target) + ": " + error;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool buildArmImage(const std::string &cc, const std::string &shimDir,
+        const std::string &source, ArmImage &image, std::string &error)
+{
+    const char *tmp = getenv("TMPDIR");
+    std::string objectPath = std::string(tmp != nullptr ? tmp : "/tmp") +
+            "/asmObjXXXXXX.o";
+    int fd = mkstemps(&objectPath[0], 2);
+    if (fd < 0)
+    {
+        error = "could not create a temporary file";
+        return false;
+    }
+    close(fd);
+    bool ok = assembleArm(cc, shimDir, source, objectPath, error) &&
+            loadArmObject(objectPath, image, error);
+    unlink(objectPath.c_str());
+    return ok;
+}
+
+ShimDir::ShimDir(const std::string &prefix)
+{
+    const char *tmp = getenv("TMPDIR");
+    path_ = std::string(tmp != nullptr ? tmp : "/tmp") + "/" + prefix +
+            "XXXXXX";
+    if (mkdtemp(&path_[0]) == nullptr)
+    {
+        error = "mkdtemp: " + std::string(strerror(errno));
+        path_.clear();
+        return;
+    }
+    FILE *f = fopen((path_ + "/xc.h").c_str(), "w");
+    if (f == nullptr)
+    {
+        error = "could not create " + path_ + "/xc.h";
+        return;
+    }
+    fclose(f);
+}
+
+ShimDir::~ShimDir()
+{
+    if (path_.empty())
+    {
+        return;
+    }
+    unlink((path_ + "/xc.h").c_str());
+    rmdir(path_.c_str());
+}
+
+std::string firstLine(const std::string &text)
+{
+    size_t end = text.find('\n');
+    return end == std::string::npos ? text : text.substr(0, end);
+}
+
+} // namespace lab
+
+/* *****************************************************************************
+ End of File
+ */
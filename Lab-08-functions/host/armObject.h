@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/** Assembles an asmMult.s and links it into a memory image for thumbEmu
+
+  @File Name
+    armObject.h
+
+  @Summary
+    Runs the ARM assembler on a .s file, then places the sections of the
+    object file in flash and SRAM and applies its relocations, the way the
+    linker would for the board.
+
+  @Description
+    assembleArm() runs
+
+        <cc> -c -x assembler-with-cpp -mcpu=cortex-m4 -mthumb -I<shimDir> ...
+
+    where cc is normally arm-none-eabi-gcc. asmMult.s includes <xc.h>, which
+    only the XC32 toolchain has; shimDir should hold an empty xc.h, as the
+    directory of a ShimDir does.
+
+    loadArmObject() reads the ELF32 relocatable object: read-only sections
+    go in flash from ARM_IMAGE_FLASH_BASE and writable ones (.data, .bss)
+    in SRAM from ARM_IMAGE_RAM_BASE. Only the relocations an assembler
+    emits for Thumb code are handled (ABS32, REL32, PREL31 and the Thumb
+    branch, MOVW/MOVT and literal types); an unknown type, or a reference
+    to a symbol the file does not define, is an error.
+
+    Symbols keep the Thumb bit of their ELF value: lookup() of a function
+    returns its address with bit 0 set, ready for ThumbCpu::call().
+
+    emuCheck.cpp links the checked-in fixtures/emuFixture.o, which needs
+    each kind of relocation, and checks the result.
+ */
+/* ************************************************************************** */
+
+#ifndef _ARM_OBJECT_H    /* Guard against multiple inclusion */
+#define _ARM_OBJECT_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace lab
+{
+
+#define ARM_IMAGE_FLASH_BASE 0x00001000u
+#define ARM_IMAGE_RAM_BASE   0x20000000u
+
+struct ArmImage
+{
+    uint32_t flashBase = ARM_IMAGE_FLASH_BASE;
+    std::vector<uint8_t> flash;     // code and read-only data
+    uint32_t ramBase = ARM_IMAGE_RAM_BASE;
+    std::vector<uint8_t> ram;       // .data followed by .bss
+    std::map<std::string, uint32_t> symbols;
+
+    /* false if the object does not define name */
+    bool lookup(const std::string &name, uint32_t &value) const;
+};
+
+/* assemble source into objectPath; on failure error holds the assembler's
+ * messages */
+bool assembleArm(const std::string &cc, const std::string &shimDir,
+        const std::string &source, const std::string &objectPath,
+        std::string &error);
+
+/* link the object file at path into image */
+bool loadArmObject(const std::string &path, ArmImage &image,
+        std::string &error);
+
+/* assembleArm() to a temporary file, then loadArmObject() */
+bool buildArmImage(const std::string &cc, const std::string &shimDir,
+        const std::string &source, ArmImage &image, std::string &error);
+
+/* a temporary directory holding an empty xc.h, for assembleArm(); it is
+ * removed when the ShimDir goes */
+class ShimDir
+{
+public:
+    /* the directory is made under $TMPDIR (or /tmp), named prefix and six
+     * random characters */
+    explicit ShimDir(const std::string &prefix);
+    ~ShimDir();
+    ShimDir(const ShimDir &) = delete;
+    ShimDir &operator=(const ShimDir &) = delete;
+
+    /* false, with error set, if the directory could not be made */
+    bool ready() const { return error.empty(); }
+    std::string error;
+
+    const std::string &path() const { return path_; }
+
+private:
+    std::string path_;
+};
+
+/* first line of the assembler's messages, for a one-line report */
+std::string firstLine(const std::string &text);
+
+} // namespace lab
+
+#endif /* _ARM_OBJECT_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,331 @@
+/* ************************************************************************** */
+/** Host-side cycle benchmark of the asm functions
+
+  @File Name
+    asmBench.cpp
+
+  @Summary
+    Runs the board's benchmark mode (benchFuncs.c) on thumbEmu and prints
+    the same min/median/p99/max table for each asmMult.s given.
+
+  @Description
+    Build and run on any Linux host with a C++17 compiler and the ARM
+    assembler:
+
+        cc -O2 -c ../firmware/src/benchStats.c
+        c++ -O2 -std=c++17 -pthread -o asmBench asmBench.cpp \
+            labHarness.cpp armObject.cpp thumbEmu.cpp benchStats.o
+        ./asmBench asmMult.s
+        ./asmBench --inputs random --count 1000 --seed 7 alice.s bob.s
+
+    Options:
+        -j N                  threads (default: every core)
+        --inputs SET          vectors (the TEST_VECTORS corpus, default) or
+                              random
+        --count N             inputs in the random set (default 256)
+        --seed S              random set seed (default 1)
+        --warmup N            untimed calls per input (default 4)
+        --iterations N        timed calls per input (default 16)
+        --cc CC               the assembler driver (default arm-none-eabi-gcc)
+        --max-instructions N  per call before it is a TIMEOUT (default
+                              LAB_DEFAULT_MAX_INSTRUCTIONS)
+
+    Each file is graded first, as batchGrade does, and a function whose
+    tests did not all pass is skipped, as on the board. The rest are timed
+    with thumbEmu's cycle estimate in place of DWT->CYCCNT; the overhead
+    subtracted is the cost of calling a lone BX LR. benchStats.c picks the
+    inputs and reduces the samples, so with the same options the table has
+    the same inputs and sample counts as the board's.
+
+    thumbEmu has no flash wait states, cache or interrupts, so every call
+    of a function on the same input costs the same: warm-up changes
+    nothing, and median and p99 differ from min only where the cycles
+    depend on the input. Compare functions with each other here and use
+    the board for absolute numbers.
+ */
+/* ************************************************************************** */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "armObject.h"
+#include "labHarness.h"
+#include "workPool.h"
+
+#include "../firmware/src/testVectors.h"
+#include "../firmware/src/benchStats.h"
+
+namespace
+{
+
+/* where the empty function timed for the call overhead lives; below the
+ * object's flash */
+#define BENCH_NULL_ADDR 0x00000100u
+
+const int32_t corpus[] = {
+    TEST_VECTORS(TV_PACKED_ENTRY)
+};
+
+struct Variant
+{
+    std::string path;
+    bool built = false;
+    std::string error;
+    std::string report;
+};
+
+void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [-j threads] [--inputs vectors|random] "
+            "[--count n] [--seed s] [--warmup n] [--iterations n] "
+            "[--cc assembler] [--max-instructions n] file.s ...\n", argv0);
+}
+
+/* append a line formatted for the board's terminal, without the \r */
+void appendLine(std::string &out, const char *line)
+{
+    for (const char *p = line; *p != '\0'; ++p)
+    {
+        if (*p != '\r')
+        {
+            out += *p;
+        }
+    }
+}
+
+/* as benchArgs() in benchFuncs.c, with the out pointers in the caller's
+ * frame */
+void benchArgs(lab::LabRunner &runner, int test, uint32_t p, uint32_t lane,
+        uint32_t args[3])
+{
+    int32_t a = TV_A(p);
+    int32_t b = TV_B(p);
+
+    args[0] = p;
+    args[1] = 0;
+    args[2] = 0;
+    switch (test)
+    {
+        case lab::LAB_UNPACK:
+            args[1] = runner.localAddr(0);
+            args[2] = runner.localAddr(1);
+            break;
+        case lab::LAB_ABS:
+            args[0] = (uint32_t)(lane == 0 ? a : b);
+            args[1] = runner.localAddr(0);
+            args[2] = runner.localAddr(1);
+            break;
+        case lab::LAB_MULT:
+            args[0] = (uint32_t)TV_ABS(a);
+            args[1] = (uint32_t)TV_ABS(b);
+            break;
+        case lab::LAB_FIXSIGN:
+            args[0] = (uint32_t)(TV_ABS(a) * TV_ABS(b));
+            args[1] = (uint32_t)TV_SIGN(a);
+            args[2] = (uint32_t)TV_SIGN(b);
+            break;
+        default:    // LAB_MAIN
+            break;
+    }
+}
+
+/* runBenchmark() of benchFuncs.c on a graded runner */
+void benchVariant(lab::LabRunner &runner, const lab::LabScore &score,
+        const benchConfig &c, std::string &out)
+{
+    const uint32_t numCases = sizeof(corpus) / sizeof(corpus[0]);
+    uint32_t numInputs = benchInputCount(&c, numCases);
+    std::vector<uint32_t> samples(BENCH_MAX_SAMPLES);
+    char line[BENCH_LINE_LEN];
+    benchStats stats;
+
+    // BX LR, for the call overhead
+    size_t null = runner.mem.addRegion("null", BENCH_NULL_ADDR, 2, false, true);
+    runner.mem.region(null).bytes = {0x70, 0x47};
+    lab::LabCall call = runner.call(BENCH_NULL_ADDR | 1, 0, 0, 0, 0);
+    uint32_t overhead = (uint32_t)call.cycles;
+
+    benchFormatHeader(line, sizeof(line), &c, numInputs, overhead);
+    appendLine(out, line);
+
+    for (int test = 0; test < LAB_NUM_GROUPS; ++test)
+    {
+        const lab::LabGroupScore &gs = score.group[test];
+        bool skip = gs.fail != 0 || gs.tests() == 0;
+        uint32_t lanes = test == lab::LAB_ABS ? 2 : 1;
+        uint32_t seen = 0;
+        uint32_t crashed = 0;
+
+        for (uint32_t i = 0; i < numInputs && skip == false; ++i)
+        {
+            uint32_t p = benchInput(&c, corpus, i);
+            for (uint32_t lane = 0; lane < lanes; ++lane)
+            {
+                uint32_t args[3];
+                benchArgs(runner, test, p, lane, args);
+                for (uint32_t w = 0; w < c.warmup; ++w)
+                {
+                    runner.call(runner.fnAddr[test], args[0], args[1],
+                            args[2], 0);
+                }
+                for (uint32_t n = 0; n < c.iterations; ++n)
+                {
+                    call = runner.call(runner.fnAddr[test], args[0], args[1],
+                            args[2], 0);
+                    if (call.stop != lab::ThumbCpu::Stop::Returned)
+                    {
+                        ++crashed;
+                    }
+                    else
+                    {
+                        uint32_t slot = benchSampleSlot(seen++);
+                        if (slot < BENCH_MAX_SAMPLES)
+                        {
+                            samples[slot] = (uint32_t)call.cycles;
+                        }
+                    }
+                }
+            }
+        }
+
+        benchComputeStats(samples.data(),
+                seen < BENCH_MAX_SAMPLES ? seen : BENCH_MAX_SAMPLES,
+                overhead, &stats);
+        benchFormatRow(line, sizeof(line), lab::labGroupNames[test], &stats);
+        appendLine(out, line);
+        if (crashed != 0)
+        {
+            // the board would have hung or reset here
+            snprintf(line, sizeof(line), "%-10s  %u timed calls faulted or "
+                    "timed out and were left out\n", "", crashed);
+            out += line;
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    unsigned threads = lab::defaultThreadCount();
+    std::string cc = "arm-none-eabi-gcc";
+    uint64_t maxInstructions = LAB_DEFAULT_MAX_INSTRUCTIONS;
+    benchConfig config = {BENCH_INPUTS_TEST_VECTORS, 256, 1, 4, 16};
+    std::vector<Variant> variants;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+        {
+            threads = (unsigned)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--inputs") == 0 && i + 1 < argc)
+        {
+            ++i;
+            if (strcmp(argv[i], "vectors") == 0)
+            {
+                config.inputSet = BENCH_INPUTS_TEST_VECTORS;
+            }
+            else if (strcmp(argv[i], "random") == 0)
+            {
+                config.inputSet = BENCH_INPUTS_RANDOM;
+            }
+            else
+            {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc)
+        {
+            config.randomCount = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            config.randomSeed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+        {
+            config.warmup = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+        {
+            config.iterations = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--cc") == 0 && i + 1 < argc)
+        {
+            cc = argv[++i];
+        }
+        else if (strcmp(argv[i], "--max-instructions") == 0 && i + 1 < argc)
+        {
+            maxInstructions = strtoull(argv[++i], NULL, 0);
+        }
+        else if (argv[i][0] == '-')
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        else
+        {
+            variants.emplace_back();
+            variants.back().path = argv[i];
+        }
+    }
+    if (variants.empty())
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    lab::ShimDir shim("asmBench");
+    if (shim.ready() == false)
+    {
+        fprintf(stderr, "%s\n", shim.error.c_str());
+        return EXIT_FAILURE;
+    }
+
+    lab::runParallel(variants.size(), threads, [&](size_t i)
+    {
+        Variant &v = variants[i];
+        lab::ArmImage image;
+        if (lab::buildArmImage(cc, shim.path(), v.path, image,
+                v.error) == false)
+        {
+            return;
+        }
+        lab::LabRunner runner(image);
+        lab::LabScore score;
+        runner.maxInstructions = maxInstructions;
+        v.built = lab::gradeLab(runner, score);
+        if (v.built == false)
+        {
+            v.error = runner.error;
+            return;
+        }
+        v.report = v.path + ": " + score.name + "\n";
+        benchVariant(runner, score, config, v.report);
+    });
+
+    bool allBuilt = true;
+    for (const Variant &v : variants)
+    {
+        if (v.built == false)
+        {
+            printf("%s: NOT BENCHMARKED: %s\n", v.path.c_str(),
+                    lab::firstLine(v.error).c_str());
+        }
+        else
+        {
+            fputs(v.report.c_str(), stdout);
+        }
+        allBuilt = allBuilt && v.built;
+    }
+    return allBuilt ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,452 @@
+/* ************************************************************************** */
+/** Coverage-guided fuzzing of the asm functions on the host
+
+  @File Name
+    asmFuzz.cpp
+
+  @Summary
+    Runs asmUnpack .. asmMain from one asmMult.s on thumbEmu, keeping the
+    inputs that reach new branches and mutating those, and shrinks every
+    failing input it finds.
+
+  @Description
+    Build and run on any Linux host with a C++17 compiler and the ARM
+    assembler:
+
+        c++ -O2 -std=c++17 -pthread -o asmFuzz asmFuzz.cpp \
+            labHarness.cpp armObject.cpp thumbEmu.cpp
+        ./asmFuzz asmMult.s
+        ./asmFuzz -j 8 --runs 5000000 --seed 0x1234 --save fails.h asmMult.s
+
+    Options:
+        -j N                  threads (default: every core)
+        --runs N              packed inputs to try (default 200000)
+        --seed S              generator seed (default: from the clock); with
+                              -j 1 the same seed repeats the same run
+        --save FILE           write the shrunk failing inputs to FILE as a
+                              TEST_VECTORS_EXTRA header
+        --cc CC               the assembler driver (default arm-none-eabi-gcc)
+        --max-instructions N  per call before it is a TIMEOUT (default
+                              FUZZ_DEFAULT_MAX_INSTRUCTIONS)
+
+    Each input is a packed value, checked by labFuzzCheck(): every check of
+    fuzzCheckPacked() in fuzzFuncs.c, with TV_EXPECTED() (the macro behind
+    calcExpectedValues()) as the oracle, plus CRASH and AAPCS for calls
+    that faulted, timed out or clobbered r4-r11/SP.
+
+    Coverage: thumbEmu counts every (branch, target) edge, including the
+    taken and skipped sides of each IT-block instruction, so the sign
+    handling paths are seen even when written with IT instead of branches.
+    As in AFL and libFuzzer, hit counts are put in power-of-two buckets and
+    an input that lights a new bucket on any edge joins the corpus. New
+    inputs are one to four stacked mutations of a corpus entry: bit flips,
+    lane edge values (FUZZ_EDGE_LANES of fuzzFuncs.h), small
+    increments, lane negation and swapping, and splicing a lane from
+    another entry.
+
+    Each thread has its own memory image and runner; the corpus and the
+    coverage map are shared. A failing input is shrunk, keeping its exact
+    set of failing checks, towards lanes of the smallest magnitude, and is
+    reported once per set of failing checks.
+
+    Add -DTEST_VECTORS_EXTRA_FILE to the board build with the --save file
+    to run the shrunk inputs on the board.
+ */
+/* ************************************************************************** */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "armObject.h"
+#include "labHarness.h"
+#include "workPool.h"
+
+#include "../firmware/src/testVectors.h"
+#include "../firmware/src/fuzzFuncs.h"
+
+namespace
+{
+
+/* edges tracked; a power of two */
+#define FUZZ_MAP_SIZE (1u << 13)
+
+#define FUZZ_DEFAULT_RUNS 200000
+
+/* lower than the grader's limit: a fuzz run makes millions of calls, and a
+ * solution that loops would otherwise take most of the time */
+#define FUZZ_DEFAULT_MAX_INSTRUCTIONS 10000
+
+const uint16_t edgeLanes[] = { FUZZ_EDGE_LANES };
+
+struct Failure
+{
+    uint32_t found;     // input as first found
+    uint32_t shrunk;    // smallest input with the same failing checks
+};
+
+/* state shared by the threads */
+struct Shared
+{
+    std::mutex lock;
+    std::vector<uint32_t> corpus;
+    std::vector<uint8_t> seen;          // buckets seen for each edge
+    std::map<uint32_t, Failure> failures;   // by labFuzzCheck() mask
+    std::atomic<size_t> corpusSize{0};
+    std::atomic<uint64_t> runs{0};
+    uint64_t maxRuns = FUZZ_DEFAULT_RUNS;
+};
+
+uint32_t xorshift32(uint32_t &state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/* AFL's hit-count buckets, one bit each */
+uint8_t bucket(uint8_t count)
+{
+    if (count < 4)
+    {
+        return count == 3 ? 4 : count;
+    }
+    if (count < 8) return 8;
+    if (count < 16) return 16;
+    if (count < 32) return 32;
+    if (count < 128) return 64;
+    return 128;
+}
+
+int32_t laneA(uint32_t p)
+{
+    return (int16_t)(p >> 16);
+}
+
+int32_t laneB(uint32_t p)
+{
+    return (int16_t)(p & 0xFFFF);
+}
+
+uint32_t pack(uint32_t a, uint32_t b)
+{
+    return ((a & 0xFFFF) << 16) | (b & 0xFFFF);
+}
+
+/* the size an input is shrunk by: the sum of its lane magnitudes */
+uint32_t inputSize(uint32_t p)
+{
+    return (uint32_t)(abs(laneA(p)) + abs(laneB(p)));
+}
+
+uint32_t mutate(uint32_t p, uint32_t &rng, const std::vector<uint32_t> &corpus)
+{
+    uint32_t count = 1 + (xorshift32(rng) & 3);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t r = xorshift32(rng);
+        uint32_t shift = (r & 0x100) != 0 ? 16 : 0;
+        uint32_t lane = (p >> shift) & 0xFFFF;
+        switch (r & 7)
+        {
+            case 0:
+                p ^= 1u << ((r >> 9) & 31);
+                continue;
+            case 1:
+                lane = edgeLanes[(r >> 9) % (sizeof(edgeLanes) / sizeof(edgeLanes[0]))];
+                break;
+            case 2:
+                lane += (r & 0x200) != 0 ? 1 + ((r >> 10) & 15) :
+                        0 - (1 + ((r >> 10) & 15));
+                break;
+            case 3:
+                lane = 0 - lane;
+                break;
+            case 4:
+                p = (p << 16) | (p >> 16);
+                continue;
+            case 5:
+                lane = (corpus[(r >> 9) % corpus.size()] >> ((r & 0x200) != 0 ? 16 : 0));
+                break;
+            case 6:
+                lane = r >> 16;
+                break;
+            default:
+                lane = (r & 0x200) != 0 ? lane << 1 : (uint32_t)((int16_t)lane >> 1);
+                break;
+        }
+        p = (p & ~(0xFFFFu << shift)) | ((lane & 0xFFFF) << shift);
+    }
+    return p;
+}
+
+/* smallest input found with exactly the same failing checks */
+uint32_t shrink(lab::LabRunner &runner, uint32_t p, uint32_t mask)
+{
+    bool smaller = true;
+    while (smaller)
+    {
+        smaller = false;
+        for (int l = 0; l < 2 && smaller == false; ++l)
+        {
+            int32_t v = l == 0 ? laneA(p) : laneB(p);
+            const int32_t tries[] = {0, 1, -1, v / 2, v - (v > 0 ? 1 : -1),
+                    v & (v - 1), -v};
+            for (int32_t t : tries)
+            {
+                uint32_t q = l == 0 ? pack((uint32_t)t, (uint32_t)laneB(p)) :
+                        pack((uint32_t)laneA(p), (uint32_t)t);
+                if (q != p && inputSize(q) < inputSize(p) &&
+                        lab::labFuzzCheck(runner, q) == mask)
+                {
+                    p = q;
+                    smaller = true;
+                    break;
+                }
+            }
+        }
+    }
+    return p;
+}
+
+void fuzzThread(Shared &shared, const lab::ArmImage &image, uint32_t seed,
+        uint64_t maxInstructions)
+{
+    lab::LabRunner runner(image);
+    runner.maxInstructions = maxInstructions;
+    std::vector<uint8_t> map(FUZZ_MAP_SIZE);
+    std::vector<uint8_t> seen(FUZZ_MAP_SIZE, 0);    // this thread's view
+    std::vector<uint32_t> corpus;
+    uint32_t rng = seed == 0 ? 1 : seed;
+    runner.cpu.edgeMap = map.data();
+    runner.cpu.edgeMapSize = FUZZ_MAP_SIZE;
+
+    while (shared.runs.fetch_add(1) < shared.maxRuns)
+    {
+        if (corpus.size() != shared.corpusSize.load())
+        {
+            std::lock_guard<std::mutex> hold(shared.lock);
+            corpus = shared.corpus;
+        }
+        uint32_t parent = corpus[xorshift32(rng) % corpus.size()];
+        uint32_t input = mutate(parent, rng, corpus);
+
+        std::fill(map.begin(), map.end(), 0);
+        uint32_t mask = lab::labFuzzCheck(runner, input);
+
+        bool interesting = false;
+        for (uint32_t i = 0; i < FUZZ_MAP_SIZE; ++i)
+        {
+            if (map[i] != 0 && (bucket(map[i]) & ~seen[i]) != 0)
+            {
+                interesting = true;
+                break;
+            }
+        }
+        if (interesting)
+        {
+            std::lock_guard<std::mutex> hold(shared.lock);
+            bool isNew = false;
+            for (uint32_t i = 0; i < FUZZ_MAP_SIZE; ++i)
+            {
+                if (map[i] != 0)
+                {
+                    uint8_t b = bucket(map[i]);
+                    isNew = isNew || (b & ~shared.seen[i]) != 0;
+                    shared.seen[i] |= b;
+                }
+            }
+            seen = shared.seen;
+            if (isNew)
+            {
+                shared.corpus.push_back(input);
+                shared.corpusSize = shared.corpus.size();
+            }
+        }
+
+        if (mask != 0)
+        {
+            {
+                std::lock_guard<std::mutex> hold(shared.lock);
+                if (shared.failures.count(mask) != 0)
+                {
+                    continue;
+                }
+                shared.failures[mask] = {input, input};
+            }
+            runner.cpu.edgeMap = nullptr;
+            uint32_t shrunk = shrink(runner, input, mask);
+            runner.cpu.edgeMap = map.data();
+            std::lock_guard<std::mutex> hold(shared.lock);
+            shared.failures[mask].shrunk = shrunk;
+        }
+    }
+}
+
+void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [-j threads] [--runs n] [--seed s] "
+            "[--save file.h] [--cc assembler] [--max-instructions n] "
+            "asmMult.s\n", argv0);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    unsigned threads = lab::defaultThreadCount();
+    std::string cc = "arm-none-eabi-gcc";
+    std::string source;
+    std::string savePath;
+    uint64_t maxInstructions = FUZZ_DEFAULT_MAX_INSTRUCTIONS;
+    uint32_t seed = 0;
+    Shared shared;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+        {
+            threads = (unsigned)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc)
+        {
+            shared.maxRuns = strtoull(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc)
+        {
+            savePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--cc") == 0 && i + 1 < argc)
+        {
+            cc = argv[++i];
+        }
+        else if (strcmp(argv[i], "--max-instructions") == 0 && i + 1 < argc)
+        {
+            maxInstructions = strtoull(argv[++i], NULL, 0);
+        }
+        else if (argv[i][0] != '-' && source.empty())
+        {
+            source = argv[i];
+        }
+        else
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (source.empty())
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (seed == 0)
+    {
+        seed = (uint32_t)std::chrono::steady_clock::now().time_since_epoch().count();
+        seed = seed == 0 ? 1 : seed;
+    }
+    if (threads == 0)
+    {
+        threads = 1;
+    }
+
+    lab::ShimDir shim("asmFuzz");
+    if (shim.ready() == false)
+    {
+        fprintf(stderr, "%s\n", shim.error.c_str());
+        return EXIT_FAILURE;
+    }
+    lab::ArmImage image;
+    std::string error;
+    if (lab::buildArmImage(cc, shim.path(), source, image, error) == false)
+    {
+        fprintf(stderr, "%s\n", error.c_str());
+        return EXIT_FAILURE;
+    }
+    lab::LabRunner check(image);
+    if (check.ready() == false)
+    {
+        fprintf(stderr, "%s\n", check.error.c_str());
+        return EXIT_FAILURE;
+    }
+
+    // start from the board's test vectors
+    const int32_t vectors[] = {
+        TEST_VECTORS(TV_PACKED_ENTRY)
+    };
+    shared.seen.assign(FUZZ_MAP_SIZE, 0);
+    for (int32_t v : vectors)
+    {
+        shared.corpus.push_back((uint32_t)v);
+    }
+    shared.corpusSize = shared.corpus.size();
+
+    printf("asmFuzz: %s, seed 0x%08x, %llu runs on %u threads\n",
+            source.c_str(), seed, (unsigned long long)shared.maxRuns, threads);
+    auto start = std::chrono::steady_clock::now();
+    lab::runParallel(threads, threads, [&](size_t t)
+    {
+        fuzzThread(shared, image, seed ^ (uint32_t)(t * 0x9E3779B9u),
+                maxInstructions);
+    });
+    double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+
+    uint32_t edges = 0;
+    for (uint8_t s : shared.seen)
+    {
+        edges += s != 0 ? 1 : 0;
+    }
+    uint64_t runs = shared.runs.load() > shared.maxRuns ?
+            shared.maxRuns : shared.runs.load();
+    printf("%llu runs in %.2f s (%.0f/s); %u edges; corpus of %zu inputs\n",
+            (unsigned long long)runs, seconds, runs / seconds, edges,
+            shared.corpus.size());
+
+    for (const auto &entry : shared.failures)
+    {
+        uint32_t p = entry.second.shrunk;
+        printf("FUZZ FAIL: packed 0x%08x (A = %d, B = %d): %s "
+                "(found as 0x%08x)\n", p, laneA(p), laneB(p),
+                lab::labFuzzMaskNames(entry.first).c_str(),
+                entry.second.found);
+    }
+    if (shared.failures.empty())
+    {
+        printf("no failures\n");
+    }
+
+    if (savePath.empty() == false)
+    {
+        FILE *out = fopen(savePath.c_str(), "w");
+        if (out == nullptr)
+        {
+            perror(savePath.c_str());
+            return EXIT_FAILURE;
+        }
+        fprintf(out, "/* shrunk failing inputs from asmFuzz, seed 0x%08x */\n"
+                "#define TEST_VECTORS_EXTRA(X) \\\n", seed);
+        for (const auto &entry : shared.failures)
+        {
+            fprintf(out, "    X(0x%08X)  /* %s */ \\\n", entry.second.shrunk,
+                    lab::labFuzzMaskNames(entry.first).c_str());
+        }
+        fprintf(out, "\n");
+        fclose(out);
+    }
+    return shared.failures.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/** Host-side batch grader for many asmMult.s submissions
+
+  @File Name
+    batchGrade.cpp
+
+  @Summary
+    Assembles each asmMult.s given on the command line, runs it through the
+    same test sequence main.c runs on the board, and prints the per-function
+    pass counts and points the board would print.
+
+  @Description
+    Build and run on any Linux host with a C++17 compiler and the ARM
+    assembler (arm-none-eabi-gcc; XC32's pic32m-gcc or xc32-gcc also work):
+
+        c++ -O2 -std=c++17 -pthread -o batchGrade batchGrade.cpp \
+            labHarness.cpp armObject.cpp thumbEmu.cpp
+        ./batchGrade alice.s bob.s carol.s
+        ./batchGrade -j 8 --cc xc32-gcc a.s b.s
+
+    Options:
+        -j N                  threads (default: every core)
+        --cc CC               the assembler driver (default arm-none-eabi-gcc)
+        --max-instructions N  per call before it is a TIMEOUT (default
+                              LAB_DEFAULT_MAX_INSTRUCTIONS)
+
+    The submissions run on thumbEmu, not on a board: see labHarness.h for
+    how the sandbox, AAPCS check and timeout are reproduced. Each variant
+    is assembled and graded as one task on the work-stealing pool in
+    workPool.h; output is printed in command-line order once all are done.
+    Add -DTEST_VECTORS_EXTRA_FILE='"..."' and -DTEST_VECTORS_USE_PAIRWISE=1
+    to the build to use the same extra corpus as the firmware.
+
+    Exit status is 0 if every file assembled, else 1.
+ */
+/* ************************************************************************** */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "armObject.h"
+#include "labHarness.h"
+#include "workPool.h"
+
+namespace
+{
+
+struct Variant
+{
+    std::string path;
+    bool built = false;
+    std::string error;
+    lab::LabScore score;
+};
+
+void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [-j threads] [--cc assembler] "
+            "[--max-instructions n] file.s ...\n", argv0);
+}
+
+void printVariant(const Variant &v)
+{
+    if (v.built == false)
+    {
+        printf("%s: NOT GRADED: %s\n", v.path.c_str(),
+                lab::firstLine(v.error).c_str());
+        return;
+    }
+    const lab::LabScore &s = v.score;
+    printf("%s: %s\n", v.path.c_str(), s.name.c_str());
+    for (int g = 0; g < LAB_NUM_GROUPS; ++g)
+    {
+        const lab::LabGroupScore &gs = s.group[g];
+        printf("  %-11s %4d of %4d tests passed; %d pts",
+                lab::labGroupNames[g], gs.pass, gs.tests(), gs.points());
+        if (gs.timeouts != 0)
+        {
+            printf("; %u TIMEOUT", gs.timeouts);
+        }
+        if (gs.faults != 0)
+        {
+            printf("; %u FAULT", gs.faults);
+        }
+        if (gs.aapcsCalls != 0)
+        {
+            printf("; %u did not preserve r4-r11/sp", gs.aapcsCalls);
+        }
+        printf("\n");
+    }
+    printf("  Total point score: %d (about %llu cycles)\n", s.totalPoints(),
+            (unsigned long long)s.cycles);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    unsigned threads = lab::defaultThreadCount();
+    std::string cc = "arm-none-eabi-gcc";
+    uint64_t maxInstructions = LAB_DEFAULT_MAX_INSTRUCTIONS;
+    std::vector<Variant> variants;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+        {
+            threads = (unsigned)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--cc") == 0 && i + 1 < argc)
+        {
+            cc = argv[++i];
+        }
+        else if (strcmp(argv[i], "--max-instructions") == 0 && i + 1 < argc)
+        {
+            maxInstructions = strtoull(argv[++i], NULL, 0);
+        }
+        else if (argv[i][0] == '-')
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        else
+        {
+            variants.emplace_back();
+            variants.back().path = argv[i];
+        }
+    }
+    if (variants.empty())
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    lab::ShimDir shim("batchGrade");
+    if (shim.ready() == false)
+    {
+        fprintf(stderr, "%s\n", shim.error.c_str());
+        return EXIT_FAILURE;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    lab::runParallel(variants.size(), threads, [&](size_t i)
+    {
+        Variant &v = variants[i];
+        lab::ArmImage image;
+        if (lab::buildArmImage(cc, shim.path(), v.path, image,
+                v.error) == false)
+        {
+            return;
+        }
+        lab::LabRunner runner(image);
+        runner.maxInstructions = maxInstructions;
+        v.built = lab::gradeLab(runner, v.score);
+        if (v.built == false)
+        {
+            v.error = runner.error;
+        }
+    });
+    double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+
+    bool allBuilt = true;
+    for (const Variant &v : variants)
+    {
+        printVariant(v);
+        allBuilt = allBuilt && v.built;
+    }
+    printf("%zu files graded in %.2f s on %u threads\n", variants.size(),
+            seconds, threads);
+    return allBuilt ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* *****************************************************************************
+ End of File
+ */
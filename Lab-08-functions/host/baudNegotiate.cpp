@@ -0,0 +1,593 @@
+/* ************************************************************************** */
+/** Host end of the UART baud rate handshake
+
+  @File Name
+    baudNegotiate.cpp
+
+  @Summary
+    Steps the board's UART up to the fastest rate the link carries (see
+    firmware/src/baudNegotiate.h), then copies the board's output to
+    stdout at that rate.
+
+  @Description
+    Build and run on any Linux host with a C++17 compiler:
+
+        cc -O2 -c ../firmware/src/baudNegotiate.c
+        c++ -O2 -std=c++17 -pthread -o baudNegotiate baudNegotiate.cpp \
+            baudNegotiate.o
+        ./baudNegotiate /dev/ttyACM0             (then reset the board)
+        ./baudNegotiate /dev/ttyACM0 | ./logDecode
+        ./baudNegotiate --simulate 2000000
+        ./baudNegotiate --simulate 3000000:1000000
+
+    Options:
+        --max RATE        highest rate to try (default: the board's)
+        --wait S          seconds to wait for the board's offer (default 30)
+        -n                stop after the handshake instead of copying output
+        --simulate R[:T]  no port: run the board's end (baudNegotiate.c)
+                          against this one over a simulated serial pair
+                          that garbles bytes sent host to board above R,
+                          and board to host above T (default T = R), as an
+                          overloaded USB bridge would, with a framing
+                          error at the receiver. Checks that both ends
+                          settle on the same rate, the fastest both
+                          directions carry.
+
+    The board sends its offer right after reset and waits
+    BAUD_NEGOTIATE_WINDOW_MS for an answer, so start this first. The
+    agreed rate is printed to stderr; the port is left at it.
+
+    Exit status is 0 if both ends agreed on a rate, else 1.
+ */
+/* ************************************************************************** */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../firmware/src/baudNegotiate.h"
+
+namespace
+{
+
+void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--max rate] [--wait s] [-n] port\n"
+            "       %s [--max rate] --simulate rate[:rate]\n", argv0, argv0);
+}
+
+uint32_t nowMillis()
+{
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<milliseconds>(
+            steady_clock::now().time_since_epoch()).count();
+}
+
+void sleepMillis(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+/* one end of a serial link, as baudNegotiateLink sees it */
+class SerialEnd
+{
+public:
+    virtual ~SerialEnd() = default;
+    virtual void write(const char *bytes, uint32_t n) = 0;
+    virtual int32_t read() = 0;
+    virtual bool errorSeen() = 0;
+    virtual bool setRate(uint32_t rate) = 0;
+
+    baudNegotiateLink link()
+    {
+        baudNegotiateLink l;
+        l.ctx = this;
+        l.write = [](void *c, const char *b, uint32_t n)
+                { static_cast<SerialEnd *>(c)->write(b, n); };
+        l.read = [](void *c) { return static_cast<SerialEnd *>(c)->read(); };
+        l.errorSeen = [](void *c)
+                { return static_cast<SerialEnd *>(c)->errorSeen(); };
+        l.setRate = [](void *c, uint32_t r)
+                { return static_cast<SerialEnd *>(c)->setRate(r); };
+        l.millis = [](void *) { return nowMillis(); };
+        return l;
+    }
+};
+
+/* a tty, raw, 8N1 */
+class TtyEnd : public SerialEnd
+{
+public:
+    bool open(const char *path)
+    {
+        fd_ = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+        if (fd_ < 0)
+        {
+            perror(path);
+            return false;
+        }
+        if (tcgetattr(fd_, &tio_) != 0)
+        {
+            perror(path);
+            return false;
+        }
+        cfmakeraw(&tio_);
+        tio_.c_cflag |= CLOCAL | CREAD;
+        tio_.c_cflag &= ~(CSTOPB | PARENB | CRTSCTS);
+        // a parity or framing error reads as 0xFF 0x00 c
+        tio_.c_iflag |= INPCK | PARMRK;
+        tio_.c_iflag &= ~IGNPAR;
+        return setRate(BAUD_NEGOTIATE_START_RATE);
+    }
+
+    ~TtyEnd() override
+    {
+        if (fd_ >= 0)
+        {
+            close(fd_);
+        }
+    }
+
+    void write(const char *bytes, uint32_t n) override
+    {
+        while (n > 0)
+        {
+            ssize_t k = ::write(fd_, bytes, n);
+            if (k > 0)
+            {
+                bytes += k;
+                n -= (uint32_t)k;
+            }
+            else
+            {
+                struct pollfd p = { fd_, POLLOUT, 0 };
+                poll(&p, 1, 10);
+            }
+        }
+        tcdrain(fd_);
+    }
+
+    int32_t read() override
+    {
+        uint8_t c;
+        for (;;)
+        {
+            if (::read(fd_, &c, 1) != 1)
+            {
+                struct pollfd p = { fd_, POLLIN, 0 };
+                poll(&p, 1, 1);
+                return -1;
+            }
+            // undo PARMRK: 0xFF 0xFF is a 0xFF byte, 0xFF 0x00 c an error
+            if (marks_ == 0 && c == 0xFF)
+            {
+                marks_ = 1;
+                continue;
+            }
+            if (marks_ == 1)
+            {
+                marks_ = 0;
+                if (c == 0xFF)
+                {
+                    return 0xFF;
+                }
+                error_ = true;
+                marks_ = 2;
+                continue;
+            }
+            if (marks_ == 2)
+            {
+                marks_ = 0;
+                return -1;      // the garbled byte itself
+            }
+            return c;
+        }
+    }
+
+    bool errorSeen() override
+    {
+        bool e = error_;
+        error_ = false;
+        return e;
+    }
+
+    bool setRate(uint32_t rate) override
+    {
+        speed_t speed;
+        switch (rate)
+        {
+        case 115200: speed = B115200; break;
+        case 460800: speed = B460800; break;
+        case 1000000: speed = B1000000; break;
+        case 2000000: speed = B2000000; break;
+        case 3000000: speed = B3000000; break;
+        default: return false;
+        }
+        tcdrain(fd_);
+        cfsetispeed(&tio_, speed);
+        cfsetospeed(&tio_, speed);
+        return tcsetattr(fd_, TCSANOW, &tio_) == 0;
+    }
+
+    /* stop marking errors, so that the output is copied byte for byte */
+    void markErrorsOff()
+    {
+        tio_.c_iflag &= ~(INPCK | PARMRK);
+        tcsetattr(fd_, TCSANOW, &tio_);
+    }
+
+    int fd() const { return fd_; }
+
+private:
+    int fd_ = -1;
+    struct termios tio_;
+    int marks_ = 0;
+    bool error_ = false;
+};
+
+/* two ends joined by a wire that garbles what its rate limit does not carry */
+class SimWire
+{
+public:
+    class End : public SerialEnd
+    {
+    public:
+        End(SimWire &wire, int side) : wire_(wire), side_(side) {}
+
+        void write(const char *bytes, uint32_t n) override
+        {
+            wire_.send(side_, bytes, n);
+        }
+        int32_t read() override { return wire_.receive(side_); }
+        bool errorSeen() override { return wire_.takeError(side_); }
+        bool setRate(uint32_t rate) override
+        {
+            return wire_.setRate(side_, rate);
+        }
+
+    private:
+        SimWire &wire_;
+        int side_;
+    };
+
+    /* side 0 is the host, 1 the board; limit[s] is the fastest rate that
+     * what side s sends arrives intact at */
+    SimWire(uint32_t hostToBoard, uint32_t boardToHost)
+        : host(*this, 0), board(*this, 1)
+    {
+        limit_[0] = hostToBoard;
+        limit_[1] = boardToHost;
+    }
+
+    End host;
+    End board;
+
+private:
+    void send(int from, const char *bytes, uint32_t n)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        int to = 1 - from;
+        bool clean = rate_[from] == rate_[to] && rate_[from] <= limit_[from];
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            if (clean)
+            {
+                queue_[to].push_back((uint8_t)bytes[i]);
+            }
+            else
+            {
+                // a mis-sampled frame: wrong bits and a bad stop bit
+                queue_[to].push_back((uint8_t)(bytes[i] ^ 0x24));
+                error_[to] = true;
+            }
+        }
+    }
+
+    int32_t receive(int side)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (queue_[side].empty())
+        {
+            lock.unlock();
+            std::this_thread::yield();
+            return -1;
+        }
+        int32_t c = queue_[side].front();
+        queue_[side].pop_front();
+        return c;
+    }
+
+    bool takeError(int side)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        bool e = error_[side];
+        error_[side] = false;
+        return e;
+    }
+
+    bool setRate(int side, uint32_t rate)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rate_[side] = rate;
+        return true;
+    }
+
+    std::mutex mutex_;
+    std::deque<uint8_t> queue_[2];
+    uint32_t rate_[2] = { BAUD_NEGOTIATE_START_RATE, BAUD_NEGOTIATE_START_RATE };
+    uint32_t limit_[2];
+    bool error_[2] = { false, false };
+};
+
+void sendLine(const baudNegotiateLink &link, const std::string &line)
+{
+    std::string l = line + "\n";
+    link.write(link.ctx, l.data(), (uint32_t)l.size());
+}
+
+void dropInput(const baudNegotiateLink &link)
+{
+    while (link.read(link.ctx) >= 0)
+    {
+    }
+    (void)link.errorSeen(link.ctx);
+}
+
+/* the rate of a "#<word> <rate>" line, or 0 */
+uint32_t replyRate(const char *line, const char *word)
+{
+    size_t n = strlen(word);
+    if (line[0] != '#' || strncmp(line + 1, word, n) != 0 || line[n + 1] != ' ')
+    {
+        return 0;
+    }
+    return (uint32_t)strtoul(line + n + 2, nullptr, 10);
+}
+
+/* the host's end; returns the rate the board confirmed, or 0 */
+uint32_t hostNegotiate(const baudNegotiateLink &link, uint32_t maxRate,
+        uint32_t waitMs)
+{
+    char line[BAUD_NEGOTIATE_LINE_LEN];
+
+    // the offer: "#BAUD <current> <fastest>"
+    uint32_t boardMax = 0;
+    uint32_t start = nowMillis();
+    while (boardMax == 0)
+    {
+        uint32_t waited = nowMillis() - start;
+        if (waited >= waitMs ||
+                baudNegotiateReadLine(&link, line, waitMs - waited) == false)
+        {
+            fprintf(stderr, "no offer from the board\n");
+            return 0;
+        }
+        if (replyRate(line, "BAUD") == BAUD_NEGOTIATE_START_RATE)
+        {
+            const char *fastest = strchr(line + 6, ' ');
+            boardMax = fastest != nullptr ?
+                    (uint32_t)strtoul(fastest + 1, nullptr, 10) : 0;
+        }
+    }
+    (void)link.errorSeen(link.ctx);
+
+    uint32_t good = BAUD_NEGOTIATE_START_RATE;
+    for (uint32_t i = 1; i < baudNegotiateNumRates; ++i)
+    {
+        uint32_t rate = baudNegotiateRates[i];
+        if (rate > maxRate || rate > boardMax)
+        {
+            break;
+        }
+        sendLine(link, "TRY " + std::to_string(rate));
+        if (baudNegotiateReadLine(&link, line, BAUD_NEGOTIATE_STEP_MS) == false)
+        {
+            // the board may have switched all the same; let it fall back
+            sleepMillis(2 * BAUD_NEGOTIATE_STEP_MS);
+            dropInput(link);
+            break;
+        }
+        if (replyRate(line, "NO") == rate)
+        {
+            continue;
+        }
+        if (replyRate(line, "OK") != rate)
+        {
+            sleepMillis(2 * BAUD_NEGOTIATE_STEP_MS);
+            dropInput(link);
+            break;
+        }
+
+        uint32_t pingTime = nowMillis();
+        bool ok = link.setRate(link.ctx, rate);
+        if (ok)
+        {
+            dropInput(link);
+            sendLine(link, "PING " BAUD_NEGOTIATE_PATTERN);
+            ok = baudNegotiateReadLine(&link, line, BAUD_NEGOTIATE_STEP_MS) &&
+                    link.errorSeen(link.ctx) == false &&
+                    strcmp(line, "#PONG " BAUD_NEGOTIATE_PATTERN) == 0;
+        }
+        if (ok)
+        {
+            sendLine(link, "GOOD");
+            good = rate;
+            fprintf(stderr, "%u baud: passed\n", (unsigned)rate);
+            continue;
+        }
+
+        fprintf(stderr, "%u baud: failed, back to %u\n", (unsigned)rate,
+                (unsigned)good);
+        link.setRate(link.ctx, good);
+        // the board gives up on PING or GOOD within 2 steps of the PING
+        uint32_t spent = nowMillis() - pingTime;
+        uint32_t wait = 2 * BAUD_NEGOTIATE_STEP_MS + 20;
+        sleepMillis(spent < wait ? wait - spent : 0);
+        dropInput(link);
+        break;
+    }
+
+    sendLine(link, "DONE");
+    if (baudNegotiateReadLine(&link, line, BAUD_NEGOTIATE_STEP_MS) == true &&
+            replyRate(line, "END") == good)
+    {
+        return good;
+    }
+
+    // the ends disagree; find the board by asking at every rate
+    for (uint32_t i = baudNegotiateNumRates; i-- > 0;)
+    {
+        uint32_t rate = baudNegotiateRates[i];
+        if (link.setRate(link.ctx, rate) == false)
+        {
+            continue;
+        }
+        dropInput(link);
+        sendLine(link, "DONE");
+        if (baudNegotiateReadLine(&link, line, BAUD_NEGOTIATE_STEP_MS) &&
+                replyRate(line, "END") == rate)
+        {
+            return rate;
+        }
+    }
+    return 0;
+}
+
+/* the fastest rate the simulated wire carries both ways */
+uint32_t expectedRate(uint32_t hostToBoard, uint32_t boardToHost,
+        uint32_t maxRate)
+{
+    uint32_t best = BAUD_NEGOTIATE_START_RATE;
+    for (uint32_t i = 1; i < baudNegotiateNumRates; ++i)
+    {
+        uint32_t rate = baudNegotiateRates[i];
+        if (rate > hostToBoard || rate > boardToHost || rate > maxRate)
+        {
+            break;
+        }
+        best = rate;
+    }
+    return best;
+}
+
+int simulate(uint32_t hostToBoard, uint32_t boardToHost, uint32_t maxRate)
+{
+    SimWire wire(hostToBoard, boardToHost);
+    baudNegotiateLink boardLink = wire.board.link();
+    uint32_t boardRate = 0;
+    std::thread board([&] { boardRate = baudNegotiateBoard(&boardLink); });
+
+    uint32_t hostRate = hostNegotiate(wire.host.link(), maxRate, 1000);
+    board.join();
+
+    uint32_t expected = expectedRate(hostToBoard, boardToHost, maxRate);
+    printf("host %u, board %u, expected %u: %s\n", (unsigned)hostRate,
+            (unsigned)boardRate, (unsigned)expected,
+            hostRate == boardRate && hostRate == expected ? "OK" : "MISMATCH");
+    return hostRate == boardRate && hostRate == expected ?
+            EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    uint32_t maxRate = UINT32_MAX;
+    uint32_t waitS = 30;
+    bool copyOutput = true;
+    const char *simulateSpec = nullptr;
+    const char *path = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--max") == 0 && i + 1 < argc)
+        {
+            maxRate = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        }
+        else if (strcmp(argv[i], "--wait") == 0 && i + 1 < argc)
+        {
+            waitS = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        }
+        else if (strcmp(argv[i], "-n") == 0)
+        {
+            copyOutput = false;
+        }
+        else if (strcmp(argv[i], "--simulate") == 0 && i + 1 < argc)
+        {
+            simulateSpec = argv[++i];
+        }
+        else if (argv[i][0] == '-' || path != nullptr)
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+
+    if (simulateSpec != nullptr)
+    {
+        char *end;
+        uint32_t hostToBoard = (uint32_t)strtoul(simulateSpec, &end, 0);
+        uint32_t boardToHost = *end == ':' ?
+                (uint32_t)strtoul(end + 1, nullptr, 0) : hostToBoard;
+        return simulate(hostToBoard, boardToHost, maxRate);
+    }
+    if (path == nullptr)
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    TtyEnd tty;
+    if (tty.open(path) == false)
+    {
+        return EXIT_FAILURE;
+    }
+    fprintf(stderr, "waiting for the board's offer; reset it now\n");
+    uint32_t rate = hostNegotiate(tty.link(), maxRate, waitS * 1000);
+    if (rate == 0)
+    {
+        fprintf(stderr, "no agreed rate\n");
+        return EXIT_FAILURE;
+    }
+    fprintf(stderr, "agreed on %u baud\n", (unsigned)rate);
+
+    if (copyOutput)
+    {
+        tty.markErrorsOff();
+        for (;;)
+        {
+            char buf[4096];
+            ssize_t n = read(tty.fd(), buf, sizeof(buf));
+            if (n > 0)
+            {
+                fwrite(buf, 1, (size_t)n, stdout);
+                fflush(stdout);
+            }
+            else
+            {
+                struct pollfd p = { tty.fd(), POLLIN, 0 };
+                poll(&p, 1, 100);
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+/* *****************************************************************************
+ End of File
+ */
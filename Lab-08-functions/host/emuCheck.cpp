@@ -0,0 +1,644 @@
+/* ************************************************************************** */
+/** Host-side checks of thumbEmu and armObject against known encodings
+
+  @File Name
+    emuCheck.cpp
+
+  @Summary
+    Runs hand-assembled Thumb instructions on thumbEmu and checks the
+    registers and flags they leave, then links a checked-in object with
+    armObject and checks its relocations and calls, and the edge counts
+    asmFuzz's coverage comes from.
+
+  @Description
+    Build and run on any Linux host with a C++17 compiler; no assembler
+    is needed:
+
+        c++ -O2 -std=c++17 -o emuCheck emuCheck.cpp armObject.cpp \
+            thumbEmu.cpp
+        ./emuCheck
+        ./emuCheck -v fixtures/emuFixture.o
+
+    Options:
+        -v      print every check, not only the ones that fail
+
+    The argument is the fixture object, fixtures/emuFixture.o by default;
+    its source and how to rebuild it are in fixtures/emuFixture.s.
+
+    The instruction table is of the flag-setting, shift, extend, multiply
+    and divide instructions a lab solution uses, in their 16- and 32-bit
+    encodings, with the edge cases of each: carry out of shifts by 0, 32
+    and more, overflow, the carry of a rotated immediate, flags a
+    multiply leaves alone, and an IT block. The halfwords were checked
+    against an assembler's listing; the expected results are from the
+    ARMv7-M Architecture Reference Manual.
+
+    Exit status is 0 if every check passes, else 1.
+ */
+/* ************************************************************************** */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "armObject.h"
+#include "thumbEmu.h"
+
+namespace
+{
+
+using lab::ThumbCpu;
+using lab::ThumbMemory;
+
+const uint32_t codeBase = 0x00001000u;
+const uint32_t ramBase = 0x20000000u;
+const uint32_t ramSize = 0x1000u;
+
+/* ends every instruction case */
+const uint16_t bxLr = 0x4770;
+
+/* NZCV as a string of the flags that are set, e.g. "NC" */
+struct Flags
+{
+    const char *set;
+};
+
+struct InsnCase
+{
+    const char *text;               // what the halfwords assemble from
+    std::vector<uint16_t> code;     // without the bx lr
+    uint32_t in[4];                 // r0-r3
+    Flags flagsIn;
+    uint32_t out[2];                // r0 and r1 afterwards
+    Flags flagsOut;
+};
+
+const InsnCase insnCases[] = {
+    // 16-bit add, subtract and compare
+    { "adds r0, r0, r1", { 0x1840 }, { 0x7FFFFFFF, 1 }, { "" },
+            { 0x80000000, 1 }, { "NV" } },
+    { "adds r0, r0, r1", { 0x1840 }, { 0xFFFFFFFF, 1 }, { "" },
+            { 0, 1 }, { "ZC" } },
+    { "subs r0, #1", { 0x3801 }, { 0, 0 }, { "C" },
+            { 0xFFFFFFFF, 0 }, { "N" } },
+    { "subs r0, r0, r1", { 0x1A40 }, { 5, 3 }, { "" },
+            { 2, 3 }, { "C" } },
+    { "subs r0, r0, r1", { 0x1A40 }, { 0x80000000, 1 }, { "" },
+            { 0x7FFFFFFF, 1 }, { "CV" } },
+    { "cmp r0, r1", { 0x4288 }, { 3, 3 }, { "N" },
+            { 3, 3 }, { "ZC" } },
+    { "cmp r0, r1", { 0x4288 }, { 1, 2 }, { "" },
+            { 1, 2 }, { "N" } },
+    { "cmp r0, #0", { 0x2800 }, { 0x80000000, 0 }, { "" },
+            { 0x80000000, 0 }, { "NC" } },
+    { "rsbs r0, r1, #0", { 0x4248 }, { 99, 5 }, { "" },
+            { 0xFFFFFFFB, 5 }, { "N" } },
+    { "rsbs r0, r1, #0", { 0x4248 }, { 99, 0 }, { "" },
+            { 0, 0 }, { "ZC" } },
+    { "rsbs r0, r1, #0", { 0x4248 }, { 99, 0x80000000 }, { "" },
+            { 0x80000000, 0x80000000 }, { "NV" } },
+    { "adcs r0, r1", { 0x4148 }, { 0xFFFFFFFF, 0 }, { "C" },
+            { 0, 0 }, { "ZC" } },
+    { "adcs r0, r1", { 0x4148 }, { 0x7FFFFFFF, 0 }, { "C" },
+            { 0x80000000, 0 }, { "NV" } },
+    { "sbcs r0, r1", { 0x4188 }, { 5, 3 }, { "" },
+            { 1, 3 }, { "C" } },
+    { "sbcs r0, r1", { 0x4188 }, { 0, 0 }, { "" },
+            { 0xFFFFFFFF, 0 }, { "N" } },
+
+    // 16-bit shifts: C is the last bit out, V is left alone
+    { "lsls r0, r0, #1", { 0x0040 }, { 0x80000001, 0 }, { "V" },
+            { 2, 0 }, { "CV" } },
+    { "lsls r0, r1", { 0x4088 }, { 1, 32 }, { "" },
+            { 0, 32 }, { "ZC" } },
+    { "lsls r0, r1", { 0x4088 }, { 1, 33 }, { "C" },
+            { 0, 33 }, { "Z" } },
+    { "lsls r0, r1", { 0x4088 }, { 0x80000000, 0x100 }, { "C" },
+            { 0x80000000, 0x100 }, { "NC" } },
+    { "lsrs r0, r0, #1", { 0x0840 }, { 3, 0 }, { "" },
+            { 1, 0 }, { "C" } },
+    { "lsrs r0, r0, #32", { 0x0800 }, { 0x80000000, 0 }, { "" },
+            { 0, 0 }, { "ZC" } },
+    { "asrs r0, r0, #1", { 0x1040 }, { 0x80000001, 0 }, { "" },
+            { 0xC0000000, 0 }, { "NC" } },
+    { "asrs r0, r0, #32", { 0x1000 }, { 0x80000000, 0 }, { "" },
+            { 0xFFFFFFFF, 0 }, { "NC" } },
+    { "asrs r0, r1", { 0x4108 }, { 0x80000000, 40 }, { "" },
+            { 0xFFFFFFFF, 40 }, { "NC" } },
+    { "rors r0, r1", { 0x41C8 }, { 1, 1 }, { "" },
+            { 0x80000000, 1 }, { "NC" } },
+
+    // 16-bit multiply, logic, moves and extends
+    { "muls r0, r1, r0", { 0x4348 }, { 5, 0xFFFFFFFD }, { "CV" },
+            { 0xFFFFFFF1, 0xFFFFFFFD }, { "NCV" } },
+    { "muls r0, r1, r0", { 0x4348 }, { 0x10000, 0x10000 }, { "" },
+            { 0, 0x10000 }, { "Z" } },
+    { "ands r0, r1", { 0x4008 }, { 0xF0, 0x0F }, { "C" },
+            { 0, 0x0F }, { "ZC" } },
+    { "eors r0, r1", { 0x4048 }, { 0xFFFF0000, 0x7FFF0000 }, { "" },
+            { 0x80000000, 0x7FFF0000 }, { "N" } },
+    { "orrs r0, r1", { 0x4308 }, { 0, 0 }, { "N" },
+            { 0, 0 }, { "Z" } },
+    { "bics r0, r1", { 0x4388 }, { 0xFF, 0x0F }, { "" },
+            { 0xF0, 0x0F }, { "" } },
+    { "mvns r0, r1", { 0x43C8 }, { 5, 0 }, { "" },
+            { 0xFFFFFFFF, 0 }, { "N" } },
+    { "tst r0, r1", { 0x4208 }, { 0x8000, 0x7FFF }, { "" },
+            { 0x8000, 0x7FFF }, { "Z" } },
+    { "movs r0, #0", { 0x2000 }, { 5, 0 }, { "NCV" },
+            { 0, 0 }, { "ZCV" } },
+    { "mov r0, r1", { 0x4608 }, { 5, 0 }, { "N" },
+            { 0, 0 }, { "N" } },
+    { "sxth r0, r1", { 0xB208 }, { 0, 0x00018000 }, { "" },
+            { 0xFFFF8000, 0x00018000 }, { "" } },
+    { "uxth r0, r1", { 0xB288 }, { 0, 0xFFFF8001 }, { "" },
+            { 0x8001, 0xFFFF8001 }, { "" } },
+    { "sxtb r0, r1", { 0xB248 }, { 0, 0x180 }, { "" },
+            { 0xFFFFFF80, 0x180 }, { "" } },
+    { "uxtb r0, r1", { 0xB2C8 }, { 0, 0xFFFFFF80 }, { "" },
+            { 0x80, 0xFFFFFF80 }, { "" } },
+
+    // 32-bit data processing
+    { "adds.w r0, r0, r1, lsl #2", { 0xEB10, 0x0081 }, { 4, 0x3FFFFFFF },
+            { "" }, { 0, 0x3FFFFFFF }, { "ZC" } },
+    { "subs.w r0, r0, r1, asr #1", { 0xEBB0, 0x0061 }, { 0, 0xFFFFFFFE },
+            { "" }, { 1, 0xFFFFFFFE }, { "" } },
+    { "rsbs.w r0, r1, #0", { 0xF1D1, 0x0000 }, { 0, 7 }, { "" },
+            { 0xFFFFFFF9, 7 }, { "N" } },
+    { "adds.w r0, r0, #0x00ff00ff", { 0xF110, 0x10FF }, { 0xFF01FF01, 0 },
+            { "" }, { 0x00010000, 0 }, { "C" } },
+    { "cmp.w r0, #0x10000", { 0xF5B0, 0x3F80 }, { 0x10000, 0 }, { "" },
+            { 0x10000, 0 }, { "ZC" } },
+    // the carry of a rotated immediate is its bit 31
+    { "tst.w r0, #0x80000000", { 0xF010, 0x4F00 }, { 1, 0 }, { "" },
+            { 1, 0 }, { "ZC" } },
+    // and an unrotated one leaves C alone
+    { "ands.w r0, r0, #0xff", { 0xF010, 0x00FF }, { 0x1FF, 0 }, { "C" },
+            { 0xFF, 0 }, { "C" } },
+    { "lsrs.w r0, r1, #1", { 0xEA5F, 0x0051 }, { 9, 1 }, { "" },
+            { 0, 1 }, { "ZC" } },
+    { "lsls.w r0, r1, #31", { 0xEA5F, 0x70C1 }, { 0, 3 }, { "" },
+            { 0x80000000, 3 }, { "NC" } },
+    { "asr.w r0, r1, #16", { 0xEA4F, 0x4021 }, { 0, 0x80000000 }, { "" },
+            { 0xFFFF8000, 0x80000000 }, { "" } },
+    { "lsl.w r0, r1, r2", { 0xFA01, 0xF002 }, { 0, 1, 31 }, { "" },
+            { 0x80000000, 1 }, { "" } },
+    { "lsrs.w r0, r1, r2", { 0xFA31, 0xF002 }, { 0, 0x80000000, 32 },
+            { "" }, { 0, 0x80000000 }, { "ZC" } },
+    { "asrs.w r0, r1, r2", { 0xFA51, 0xF002 }, { 0, 0x7FFFFFFF, 255 },
+            { "C" }, { 0, 0x7FFFFFFF }, { "Z" } },
+    { "sxth.w r0, r1, ror #8", { 0xFA0F, 0xF091 }, { 0, 0x00FFEE00 },
+            { "" }, { 0xFFFFFFEE, 0x00FFEE00 }, { "" } },
+
+    // 32-bit multiplies and divides; none of them sets a flag
+    { "mul r0, r1, r2", { 0xFB01, 0xF002 }, { 0, 0xFFFFFFF9, 6 },
+            { "NZCV" }, { 0xFFFFFFD6, 0xFFFFFFF9 }, { "NZCV" } },
+    { "mla r0, r1, r2, r3", { 0xFB01, 0x3002 }, { 0, 3, 4, 5 }, { "" },
+            { 17, 3 }, { "" } },
+    { "mls r0, r1, r2, r3", { 0xFB01, 0x3012 }, { 0, 3, 4, 5 }, { "" },
+            { 0xFFFFFFF9, 3 }, { "" } },
+    { "smull r0, r1, r2, r3", { 0xFB82, 0x0103 },
+            { 0, 0, 0xFFFFFFFE, 0x40000000 }, { "" },
+            { 0x80000000, 0xFFFFFFFF }, { "" } },
+    { "umull r0, r1, r2, r3", { 0xFBA2, 0x0103 },
+            { 0, 0, 0xFFFFFFFF, 0xFFFFFFFF }, { "" },
+            { 1, 0xFFFFFFFE }, { "" } },
+    { "smlal r0, r1, r2, r3", { 0xFBC2, 0x0103 }, { 0xFFFFFFFF, 0, 1, 1 },
+            { "" }, { 0, 1 }, { "" } },
+    { "umlal r0, r1, r2, r3", { 0xFBE2, 0x0103 },
+            { 0xFFFFFFFF, 1, 0x10, 0x10 }, { "" }, { 0xFF, 2 }, { "" } },
+    { "smulbb r0, r1, r2", { 0xFB11, 0xF002 }, { 0, 0x1234FFFE, 0x00070003 },
+            { "" }, { 0xFFFFFFFA, 0x1234FFFE }, { "" } },
+    { "smuad r0, r1, r2", { 0xFB21, 0xF002 }, { 0, 0x0002FFFD, 0x00040005 },
+            { "" }, { 0xFFFFFFF9, 0x0002FFFD }, { "" } },
+    { "sdiv r0, r0, r1", { 0xFB90, 0xF0F1 }, { 0xFFFFFFF9, 2 }, { "" },
+            { 0xFFFFFFFD, 2 }, { "" } },
+    { "sdiv r0, r0, r1", { 0xFB90, 0xF0F1 }, { 5, 0 }, { "" },
+            { 0, 0 }, { "" } },
+    { "udiv r0, r0, r1", { 0xFBB0, 0xF0F1 }, { 0xFFFFFFFF, 16 }, { "" },
+            { 0x0FFFFFFF, 16 }, { "" } },
+
+    // short sequences
+    { "cmp r0, r1; ite lt; movlt r0, #1; movge r0, #0",
+            { 0x4288, 0xBFB4, 0x2001, 0x2000 }, { 0xFFFFFFFB, 3 }, { "" },
+            { 1, 3 }, { "NC" } },
+    { "cmp r0, r1; ite lt; movlt r0, #1; movge r0, #0",
+            { 0x4288, 0xBFB4, 0x2001, 0x2000 }, { 5, 3 }, { "" },
+            { 0, 3 }, { "C" } },
+    { "asrs r1, r0, #31; eors r0, r1; subs r0, r0, r1",
+            { 0x17C1, 0x4048, 0x1A40 }, { 0xFFFFFFF7, 0 }, { "" },
+            { 9, 0xFFFFFFFF }, { "" } },
+};
+
+uint32_t flagBits(Flags f)
+{
+    uint32_t bits = 0;
+    for (const char *p = f.set; *p != '\0'; ++p)
+    {
+        bits |= *p == 'N' ? 8 : *p == 'Z' ? 4 : *p == 'C' ? 2 : 1;
+    }
+    return bits;
+}
+
+std::string flagText(uint32_t bits)
+{
+    std::string s;
+    s += (bits & 8) != 0 ? 'N' : '-';
+    s += (bits & 4) != 0 ? 'Z' : '-';
+    s += (bits & 2) != 0 ? 'C' : '-';
+    s += (bits & 1) != 0 ? 'V' : '-';
+    return s;
+}
+
+std::string hex(uint32_t value)
+{
+    char text[16];
+    snprintf(text, sizeof(text), "0x%08x", value);
+    return text;
+}
+
+/* flash holding code then bx lr, and a stack */
+void loadCode(ThumbMemory &mem, const std::vector<uint16_t> &code)
+{
+    size_t flash = mem.addRegion("flash", codeBase, 64, false, true);
+    mem.addRegion("sram", ramBase, ramSize, true, false);
+    std::vector<uint8_t> &bytes = mem.region(flash).bytes;
+    size_t at = 0;
+    for (uint16_t hw : code)
+    {
+        bytes[at++] = (uint8_t)hw;
+        bytes[at++] = (uint8_t)(hw >> 8);
+    }
+    bytes[at++] = (uint8_t)bxLr;
+    bytes[at++] = (uint8_t)(bxLr >> 8);
+}
+
+bool checkInsn(const InsnCase &c, std::string &why)
+{
+    ThumbMemory mem;
+    loadCode(mem, c.code);
+    ThumbCpu cpu(mem);
+    cpu.r[13] = ramBase + ramSize;
+    uint32_t in = flagBits(c.flagsIn);
+    cpu.n = (in & 8) != 0;
+    cpu.z = (in & 4) != 0;
+    cpu.c = (in & 2) != 0;
+    cpu.v = (in & 1) != 0;
+
+    ThumbCpu::Stop stop = cpu.call(codeBase | 1, c.in, 100);
+    if (stop != ThumbCpu::Stop::Returned)
+    {
+        why = stop == ThumbCpu::Stop::Fault ? "faulted: " + cpu.faultReason :
+                "did not return";
+        return false;
+    }
+    uint32_t flags = (cpu.n ? 8 : 0) | (cpu.z ? 4 : 0) | (cpu.c ? 2 : 0) |
+            (cpu.v ? 1 : 0);
+    uint32_t want = flagBits(c.flagsOut);
+    if (cpu.r[0] != c.out[0] || cpu.r[1] != c.out[1] || flags != want)
+    {
+        why = "r0 " + hex(cpu.r[0]) + " r1 " + hex(cpu.r[1]) + " " +
+                flagText(flags) + ", expected r0 " + hex(c.out[0]) +
+                " r1 " + hex(c.out[1]) + " " + flagText(want);
+        return false;
+    }
+    return true;
+}
+
+/* instructions thumbEmu does not run stop the call like the UsageFault
+ * they raise on the board */
+bool checkFaults(std::string &why)
+{
+    static const struct
+    {
+        const char *text;
+        std::vector<uint16_t> code;
+    } cases[] = {
+        { "udf #0", { 0xDE00 } },
+        { "svc #0", { 0xDF00 } },
+        { "bkpt #0", { 0xBE00 } },
+        { "qadd16 r0, r1, r2", { 0xFA91, 0xF012 } },
+    };
+    for (const auto &c : cases)
+    {
+        ThumbMemory mem;
+        loadCode(mem, c.code);
+        ThumbCpu cpu(mem);
+        cpu.r[13] = ramBase + ramSize;
+        const uint32_t args[4] = {0, 0, 0, 0};
+        if (cpu.call(codeBase | 1, args, 100) != ThumbCpu::Stop::Fault ||
+                cpu.faultPc != codeBase)
+        {
+            why = std::string(c.text) + " did not fault at its address";
+            return false;
+        }
+    }
+    return true;
+}
+
+/* the fixture object's image, mapped as labHarness maps a submission's */
+struct Fixture
+{
+    lab::ArmImage image;
+    ThumbMemory mem;
+
+    bool load(const std::string &path, std::string &error)
+    {
+        if (lab::loadArmObject(path, image, error) == false)
+        {
+            return false;
+        }
+        size_t flash = mem.addRegion("flash", image.flashBase,
+                ((uint32_t)image.flash.size() + 3) & ~3u, false, true);
+        std::copy(image.flash.begin(), image.flash.end(),
+                mem.region(flash).bytes.begin());
+        size_t ram = mem.addRegion("sram", image.ramBase, ramSize, true,
+                false);
+        std::copy(image.ram.begin(), image.ram.end(),
+                mem.region(ram).bytes.begin());
+        return true;
+    }
+
+    uint32_t symbol(const char *name)
+    {
+        uint32_t value = 0;
+        image.lookup(name, value);
+        return value;
+    }
+
+    uint32_t word(uint32_t addr)
+    {
+        uint32_t value = 0;
+        mem.read(addr, 4, value);
+        return value;
+    }
+};
+
+bool checkObjectLayout(Fixture &f, std::string &why)
+{
+    static const struct
+    {
+        const char *name;
+        uint32_t value;
+    } symbols[] = {
+        // .text from the flash base, with the Thumb bit on functions
+        { "fixLiteral", ARM_IMAGE_FLASH_BASE + 0x00 + 1 },
+        { "fixCounter", ARM_IMAGE_FLASH_BASE + 0x0C + 1 },
+        { "fixSquare",  ARM_IMAGE_FLASH_BASE + 0x1C + 1 },
+        { "fixCall",    ARM_IMAGE_FLASH_BASE + 0x20 + 1 },
+        { "fixTail",    ARM_IMAGE_FLASH_BASE + 0x2A + 1 },
+        { "fixSum",     ARM_IMAGE_FLASH_BASE + 0x2E + 1 },
+        // .data from the SRAM base, then .bss
+        { "fixWord",    ARM_IMAGE_RAM_BASE + 0x0 },
+        { "fixPtr",     ARM_IMAGE_RAM_BASE + 0x4 },
+        { "fixCode",    ARM_IMAGE_RAM_BASE + 0x8 },
+        { "fixCount",   ARM_IMAGE_RAM_BASE + 0xC },
+    };
+    for (const auto &s : symbols)
+    {
+        uint32_t value = 0;
+        if (f.image.lookup(s.name, value) == false || value != s.value)
+        {
+            why = std::string(s.name) + " is at " + hex(value) +
+                    ", expected " + hex(s.value);
+            return false;
+        }
+    }
+    uint32_t unused;
+    if (f.image.lookup("fixMissing", unused) == true)
+    {
+        why = "lookup() found a symbol the object does not define";
+        return false;
+    }
+    return true;
+}
+
+bool checkObjectData(Fixture &f, std::string &why)
+{
+    // R_ARM_ABS32 in .data, to data and to a Thumb function
+    if (f.word(f.symbol("fixWord")) != 0x12345678 ||
+            f.word(f.symbol("fixPtr")) != f.symbol("fixWord") ||
+            f.word(f.symbol("fixCode")) != f.symbol("fixSquare") ||
+            f.word(f.symbol("fixCount")) != 0)
+    {
+        why = "fixPtr " + hex(f.word(f.symbol("fixPtr"))) + ", fixCode " +
+                hex(f.word(f.symbol("fixCode")));
+        return false;
+    }
+    return true;
+}
+
+bool checkObjectCalls(Fixture &f, std::string &why)
+{
+    static const struct
+    {
+        const char *name;
+        uint32_t arg;
+        uint32_t result;
+    } calls[] = {
+        { "fixLiteral", 0, 0x12345678 },    // literal pool ABS32
+        { "fixCounter", 0, 1 },             // MOVW/MOVT
+        { "fixCounter", 0, 2 },
+        { "fixSquare",  12, 144 },
+        { "fixCall",    12, 145 },          // THM_CALL
+        { "fixTail",    0xFFFF, 0xFFFE0001 },   // THM_JUMP24
+        { "fixSum",     100, 5050 },        // local CBZ and B
+    };
+    ThumbCpu cpu(f.mem);
+    for (const auto &c : calls)
+    {
+        const uint32_t args[4] = {c.arg, 0, 0, 0};
+        cpu.r[13] = ARM_IMAGE_RAM_BASE + ramSize;
+        ThumbCpu::Stop stop = cpu.call(f.symbol(c.name), args, 10000);
+        if (stop != ThumbCpu::Stop::Returned || cpu.r[0] != c.result)
+        {
+            why = std::string(c.name) + "(" + std::to_string(c.arg) +
+                    ") returned " + hex(cpu.r[0]) +
+                    (stop == ThumbCpu::Stop::Fault ?
+                    " (fault: " + cpu.faultReason + ")" : "") +
+                    ", expected " + hex(c.result);
+            return false;
+        }
+    }
+    if (f.word(f.symbol("fixCount")) != 2)
+    {
+        why = "fixCount was not stored";
+        return false;
+    }
+    return true;
+}
+
+/* the edge map of one call of fn(arg) */
+std::vector<uint8_t> edgeCounts(ThumbMemory &mem, uint32_t fn, uint32_t arg)
+{
+    std::vector<uint8_t> map(1u << 12, 0);
+    ThumbCpu cpu(mem);
+    cpu.edgeMap = map.data();
+    cpu.edgeMapSize = (uint32_t)map.size();
+    cpu.r[13] = ARM_IMAGE_RAM_BASE + ramSize;
+    const uint32_t args[4] = {arg, 0, 0, 0};
+    cpu.call(fn, args, 100000);
+    return map;
+}
+
+/* the counts in map, lowest first, without the zeros */
+std::vector<uint32_t> countsOf(const std::vector<uint8_t> &map)
+{
+    std::vector<uint32_t> counts;
+    for (uint8_t c : map)
+    {
+        if (c != 0)
+        {
+            counts.push_back(c);
+        }
+    }
+    std::sort(counts.begin(), counts.end());
+    return counts;
+}
+
+/* fixSum(n) runs the call, the CBZ exit and the return once each, and the
+ * CBZ fall-through and the B back n times each */
+bool checkEdges(Fixture &f, std::string &why)
+{
+    uint32_t fixSum = f.symbol("fixSum");
+    std::vector<uint8_t> sum3 = edgeCounts(f.mem, fixSum, 3);
+    std::vector<uint8_t> sum4 = edgeCounts(f.mem, fixSum, 4);
+    std::vector<uint8_t> sum0 = edgeCounts(f.mem, fixSum, 0);
+
+    if (countsOf(sum3) != std::vector<uint32_t>{1, 1, 1, 3, 3} ||
+            countsOf(sum4) != std::vector<uint32_t>{1, 1, 1, 4, 4} ||
+            countsOf(sum0) != std::vector<uint32_t>{1, 1, 1})
+    {
+        why = "fixSum's edge counts are not those of its loop";
+        return false;
+    }
+    for (size_t i = 0; i < sum3.size(); ++i)
+    {
+        if ((sum3[i] != 0) != (sum4[i] != 0))
+        {
+            why = "fixSum(3) and fixSum(4) took different edges";
+            return false;
+        }
+    }
+    // the counters stop at 255 rather than wrap
+    if (countsOf(edgeCounts(f.mem, fixSum, 300)) !=
+            std::vector<uint32_t>{1, 1, 1, 255, 255})
+    {
+        why = "an edge count wrapped";
+        return false;
+    }
+
+    // each way through an IT block is an edge of its own
+    ThumbMemory mem;
+    loadCode(mem, { 0x4288, 0xBFB4, 0x2001, 0x2000 });
+    std::vector<uint8_t> less(1u << 12, 0);
+    std::vector<uint8_t> more(1u << 12, 0);
+    for (int i = 0; i < 2; ++i)
+    {
+        ThumbCpu cpu(mem);
+        cpu.edgeMap = i == 0 ? less.data() : more.data();
+        cpu.edgeMapSize = (uint32_t)less.size();
+        cpu.r[13] = ramBase + ramSize;
+        const uint32_t args[4] = {i == 0 ? 1u : 5u, 3, 0, 0};
+        cpu.call(codeBase | 1, args, 100);
+    }
+    if (countsOf(less).size() != 4 || less == more)
+    {
+        why = "the IT block's two paths gave the same edges";
+        return false;
+    }
+    return true;
+}
+
+void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [-v] [fixture.o]\n", argv0);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    bool verbose = false;
+    const char *fixturePath = "fixtures/emuFixture.o";
+    bool pathGiven = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-v") == 0)
+        {
+            verbose = true;
+        }
+        else if (argv[i][0] != '-' && pathGiven == false)
+        {
+            fixturePath = argv[i];
+            pathGiven = true;
+        }
+        else
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    uint32_t total = 0;
+    uint32_t failed = 0;
+    auto report = [&](const std::string &name, bool ok,
+            const std::string &why) {
+        ++total;
+        if (ok == false)
+        {
+            ++failed;
+            fprintf(stderr, "FAIL %s: %s\n", name.c_str(), why.c_str());
+        }
+        else if (verbose)
+        {
+            printf("ok   %s\n", name.c_str());
+        }
+    };
+
+    for (const InsnCase &c : insnCases)
+    {
+        std::string why;
+        bool ok = checkInsn(c, why);
+        report(c.text, ok, why);
+    }
+    {
+        std::string why;
+        bool ok = checkFaults(why);
+        report("unsupported instructions fault", ok, why);
+    }
+
+    Fixture fixture;
+    std::string error;
+    if (fixture.load(fixturePath, error) == false)
+    {
+        report(std::string("load ") + fixturePath, false, error);
+    }
+    else
+    {
+        std::string why;
+        bool ok = checkObjectLayout(fixture, why);
+        report("object layout", ok, why);
+        why.clear();
+        ok = checkObjectData(fixture, why);
+        report("object data relocations", ok, why);
+        why.clear();
+        ok = checkObjectCalls(fixture, why);
+        report("object code relocations", ok, why);
+        why.clear();
+        ok = checkEdges(fixture, why);
+        report("coverage edges", ok, why);
+    }
+
+    printf("%u of %u checks passed\n", total - failed, total);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/** Fixture object for emuCheck
+
+  @File Name
+    emuFixture.s
+
+  @Summary
+    The source of emuFixture.o: a few small functions and data that need
+    each kind of relocation armObject.cpp applies for an assembler's
+    Thumb code.
+
+  @Description
+    emuFixture.o is checked in, so emuCheck needs no assembler. After a
+    change here, rebuild it with either of
+
+        arm-none-eabi-gcc -c -mcpu=cortex-m4 -mthumb -o emuFixture.o \
+                emuFixture.s
+        llvm-mc -triple=thumbv7em-none-eabi -mcpu=cortex-m4 \
+                -filetype=obj -o emuFixture.o emuFixture.s
+
+    and update the expected values in ../emuCheck.cpp to match.
+ */
+/* ************************************************************************** */
+
+.syntax unified
+.thumb
+
+.data
+.align 2
+.global fixWord, fixPtr, fixCode
+.type fixWord,%object
+.type fixPtr,%object
+.type fixCode,%object
+fixWord:    .word   0x12345678
+fixPtr:     .word   fixWord             /* R_ARM_ABS32 to .data */
+fixCode:    .word   fixSquare           /* R_ARM_ABS32 to a Thumb function */
+
+.bss
+.align 2
+.global fixCount
+.type fixCount,%object
+fixCount:   .space  4
+
+.text
+.align 2
+.global fixLiteral, fixCounter, fixSquare, fixCall, fixTail, fixSum
+.type fixLiteral,%function
+.type fixCounter,%function
+.type fixSquare,%function
+.type fixCall,%function
+.type fixTail,%function
+.type fixSum,%function
+
+/* fixWord, through an address in the literal pool */
+.thumb_func
+fixLiteral:
+    ldr     r1, =fixWord
+    ldr     r0, [r1]
+    bx      lr
+.ltorg
+
+/* ++fixCount, through MOVW/MOVT (R_ARM_THM_MOVW_ABS_NC, _MOVT_ABS) */
+.thumb_func
+fixCounter:
+    movw    r1, #:lower16:fixCount
+    movt    r1, #:upper16:fixCount
+    ldr     r0, [r1]
+    adds    r0, r0, #1
+    str     r0, [r1]
+    bx      lr
+
+/* r0 * r0 */
+.thumb_func
+fixSquare:
+    muls    r0, r0, r0
+    bx      lr
+
+/* r0 * r0 + 1, through a BL to a global (R_ARM_THM_CALL) */
+.thumb_func
+fixCall:
+    push    {r4, lr}
+    bl      fixSquare
+    adds    r0, r0, #1
+    pop     {r4, pc}
+
+/* r0 * r0, through a B.W to a global (R_ARM_THM_JUMP24) */
+.thumb_func
+fixTail:
+    b.w     fixSquare
+
+/* 1 + 2 + ... + r0, with local branches the assembler resolves */
+.thumb_func
+fixSum:
+    movs    r1, #0
+1:  cbz     r0, 2f
+    adds    r1, r1, r0
+    subs    r0, r0, #1
+    b       1b
+2:  mov     r0, r1
+    bx      lr
+
+.end
@@ -0,0 +1,423 @@
+/* ************************************************************************** */
+/** The board's test sequence, run on thumbEmu
+
+  @File Name
+    labHarness.cpp
+
+  @Summary
+    Calls the functions of an assembled asmMult.s the way main.c does on
+    the board, and scores them the same way.
+
+  @Description
+    See labHarness.h. The corpus, expected values, sandbox window and
+    register seeds come from the firmware headers, so the two cannot
+    drift apart.
+ */
+/* ************************************************************************** */
+
+#include "labHarness.h"
+
+#include <algorithm>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../firmware/src/testVectors.h"
+#include "../firmware/src/testFuncs.h"
+#include "../firmware/src/sandbox.h"
+#include "../firmware/src/aapcsCheck.h"
+#include "../firmware/src/fuzzFuncs.h"
+
+static_assert(LAB_FUZZ_CRASH == FUZZ_FAIL_GUARD,
+        "a crash is the same bit here and on the board");
+
+namespace lab
+{
+
+namespace
+{
+
+/* SRAM above the asm's .data and .bss */
+#define LAB_STACK_BYTES 0x4000
+
+/* the caller's frame above the stack pointer; holds the out-pointer locals */
+#define LAB_CALLER_FRAME 64
+
+const expectedValues labExpected[] = {
+    TEST_VECTORS(TV_EXPECTED_ENTRY)
+};
+
+const char *const globalNames[LAB_NUM_GLOBALS] = {
+    "a_Multiplicand", "b_Multiplier", "rng_Error", "a_Sign", "b_Sign",
+    "prod_Is_Neg", "a_Abs", "b_Abs", "init_Product", "final_Product"
+};
+
+/* add a returned call's compare mask to a group, or fail all its fields if
+ * it timed out or faulted; as main.c does with testAsmX() */
+void score(LabGroupScore &g, const LabCall &c, uint32_t mask,
+        uint32_t numFields)
+{
+    if (c.stop == ThumbCpu::Stop::Timeout)
+    {
+        ++g.timeouts;
+        g.fail += (int32_t)numFields;
+        return;
+    }
+    if (c.stop == ThumbCpu::Stop::Fault)
+    {
+        ++g.faults;
+        g.fail += (int32_t)numFields;
+        return;
+    }
+    int32_t passed = __builtin_popcount(mask);
+    g.pass += passed;
+    g.fail += (int32_t)numFields - passed;
+    if (c.clobbered != 0)
+    {
+        ++g.aapcsCalls;
+    }
+}
+
+} // namespace
+
+const char *const labGroupNames[LAB_NUM_GROUPS] = {
+    "asmUnpack", "asmAbs", "asmMult", "asmFixSign", "asmMain"
+};
+
+const char *const labFuzzNames[LAB_FUZZ_NUM_BITS] = {
+    "UNPACK", "ABS", "MULT", "FIXSIGN", "MAIN", "COMMUTE", "SIGN", "ZERO",
+    "CRASH", "AAPCS"
+};
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: LabRunner                                                         */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+LabRunner::LabRunner(const ArmImage &image) : cpu(mem)
+{
+    uint32_t flashSize = ((uint32_t)image.flash.size() + 3) & ~3u;
+    size_t flash = mem.addRegion("flash", image.flashBase,
+            flashSize == 0 ? 4 : flashSize, false, true);
+    std::copy(image.flash.begin(), image.flash.end(),
+            mem.region(flash).bytes.begin());
+
+    uint32_t ramSize = (((uint32_t)image.ram.size() + 7) & ~7u) +
+            LAB_STACK_BYTES;
+    size_t ram = mem.addRegion("sram", image.ramBase, ramSize, true, false);
+    std::copy(image.ram.begin(), image.ram.end(),
+            mem.region(ram).bytes.begin());
+    stackTop = image.ramBase + ramSize - LAB_CALLER_FRAME;
+
+    for (int i = 0; i < LAB_NUM_GROUPS; ++i)
+    {
+        if (image.lookup(labGroupNames[i], fnAddr[i]) == false)
+        {
+            error = std::string("asmMult.s does not define ") + labGroupNames[i];
+            return;
+        }
+    }
+    for (int i = 0; i < LAB_NUM_GLOBALS; ++i)
+    {
+        if (image.lookup(globalNames[i], globalAddr[i]) == false)
+        {
+            error = std::string("asmMult.s does not define ") + globalNames[i];
+            return;
+        }
+    }
+    uint32_t ptr = 0;
+    if (image.lookup("nameStrPtr", ptr))
+    {
+        nameStrPtr = ptr;
+    }
+}
+
+LabCall LabRunner::call(uint32_t fn, uint32_t a0, uint32_t a1, uint32_t a2,
+        uint32_t a3)
+{
+    uint32_t seed[AAPCS_NUM_CONSERVED];
+    const uint32_t args[4] = {a0, a1, a2, a3};
+
+    // as aapcsPrepare()
+    ++callCount;
+    for (uint32_t i = 0; i < AAPCS_NUM_CONSERVED; ++i)
+    {
+        seed[i] = (0x11111111u * (i + 4)) ^ (callCount * 0x00010001u);
+        cpu.r[4 + i] = seed[i];
+    }
+    cpu.r[12] = fn;
+    cpu.r[13] = stackTop;
+
+    // as sandboxInit() and sandboxBegin()
+    mem.writeWindows = {
+        {globalAddr[LAB_A_MULTIPLICAND], globalAddr[LAB_FINAL_PRODUCT] + 4},
+        {stackTop - SANDBOX_STACK_BELOW, stackTop + SANDBOX_STACK_ABOVE}
+    };
+
+    uint64_t cyclesBefore = cpu.cycles;
+    LabCall c;
+    c.stop = cpu.call(fn, args, maxInstructions);
+    c.r0 = cpu.r[0];
+    c.cycles = cpu.cycles - cyclesBefore;
+    c.clobbered = 0;
+    mem.writeWindows.clear();
+
+    if (c.stop == ThumbCpu::Stop::Returned)
+    {
+        // as aapcsCheckCase()
+        for (uint32_t i = 0; i < AAPCS_NUM_CONSERVED; ++i)
+        {
+            if (cpu.r[4 + i] != seed[i])
+            {
+                c.clobbered |= 1u << i;
+            }
+        }
+        if (cpu.r[13] != stackTop)
+        {
+            c.clobbered |= AAPCS_SP_BIT;
+        }
+    }
+    return c;
+}
+
+uint32_t LabRunner::readWord(uint32_t addr) const
+{
+    uint32_t value = 0;
+    mem.read(addr, 4, value);
+    return value;
+}
+
+void LabRunner::writeWord(uint32_t addr, uint32_t value)
+{
+    mem.write(addr, 4, value);
+}
+
+std::string LabRunner::studentName() const
+{
+    std::string name;
+    uint32_t addr = readWord(nameStrPtr);
+    uint32_t ch = 0;
+    while (nameStrPtr != 0 && name.size() < 64 && mem.read(addr, 1, ch) &&
+            ch != 0)
+    {
+        name += (char)ch;
+        ++addr;
+    }
+    return name;
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: Grading                                                           */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+int32_t LabScore::totalPoints() const
+{
+    int32_t total = 0;
+    for (const LabGroupScore &g : group)
+    {
+        total += g.points();
+    }
+    return total;
+}
+
+bool gradeLab(LabRunner &r, LabScore &s)
+{
+    if (r.ready() == false)
+    {
+        return false;
+    }
+    s = LabScore();
+    s.name = r.studentName();
+    const uint32_t outA = r.localAddr(0);
+    const uint32_t outB = r.localAddr(1);
+
+    for (const expectedValues &e : labExpected)
+    {
+        r.writeWord(outA, 0);
+        r.writeWord(outB, 0);
+        LabCall c = r.call(r.fnAddr[LAB_UNPACK], e.packedVal, outA, outB, 0);
+        uint32_t mask = ((uint32_t)((int32_t)r.readWord(outA) == e.inputA) << 0) |
+                ((uint32_t)((int32_t)r.readWord(outB) == e.inputB) << 1);
+        score(s.group[LAB_UNPACK], c, mask, TV_UNPACK_FIELDS);
+        s.cycles += c.cycles;
+    }
+
+    for (const expectedValues &e : labExpected)
+    {
+        const int32_t input[2] = {e.inputA, e.inputB};
+        const int32_t expAbs[2] = {e.absA, e.absB};
+        const int32_t expSign[2] = {e.signA, e.signB};
+        for (int i = 0; i < 2; ++i)
+        {
+            r.writeWord(outA, 0);
+            r.writeWord(outB, 0);
+            LabCall c = r.call(r.fnAddr[LAB_ABS], (uint32_t)input[i], outA,
+                    outB, 0);
+            uint32_t mask =
+                    ((uint32_t)((int32_t)r.readWord(outA) == expAbs[i]) << 0) |
+                    ((uint32_t)((int32_t)c.r0 == expAbs[i]) << 1) |
+                    ((uint32_t)((int32_t)r.readWord(outB) == expSign[i]) << 2);
+            score(s.group[LAB_ABS], c, mask, TV_ABS_FIELDS);
+            s.cycles += c.cycles;
+        }
+    }
+
+    for (const expectedValues &e : labExpected)
+    {
+        LabCall c = r.call(r.fnAddr[LAB_MULT], (uint32_t)e.absA,
+                (uint32_t)e.absB, 0, 0);
+        score(s.group[LAB_MULT], c, (int32_t)c.r0 == e.initProduct,
+                TV_MULT_FIELDS);
+        s.cycles += c.cycles;
+    }
+
+    for (const expectedValues &e : labExpected)
+    {
+        LabCall c = r.call(r.fnAddr[LAB_FIXSIGN], (uint32_t)e.initProduct,
+                (uint32_t)e.signA, (uint32_t)e.signB, 0);
+        score(s.group[LAB_FIXSIGN], c, (int32_t)c.r0 == e.finalProduct,
+                TV_FIXSIGN_FIELDS);
+        s.cycles += c.cycles;
+    }
+
+    for (const expectedValues &e : labExpected)
+    {
+        LabCall c = r.call(r.fnAddr[LAB_MAIN], e.packedVal, 0, 0, 0);
+        auto global = [&](LabGlobal g)
+        {
+            return (int32_t)r.readWord(r.globalAddr[g]);
+        };
+        // as testAsmMain() and compareExpectedValues()
+        uint32_t mask =
+                ((uint32_t)(global(LAB_A_MULTIPLICAND) == e.inputA) << TV_FIELD_INPUT_A) |
+                ((uint32_t)(global(LAB_B_MULTIPLIER) == e.inputB) << TV_FIELD_INPUT_B) |
+                ((uint32_t)(global(LAB_A_SIGN) == e.signA) << TV_FIELD_SIGN_A) |
+                ((uint32_t)(global(LAB_B_SIGN) == e.signB) << TV_FIELD_SIGN_B) |
+                ((uint32_t)(global(LAB_A_ABS) == e.absA) << TV_FIELD_ABS_A) |
+                ((uint32_t)(global(LAB_B_ABS) == e.absB) << TV_FIELD_ABS_B) |
+                ((uint32_t)(global(LAB_INIT_PRODUCT) == e.initProduct) << TV_FIELD_INIT_PRODUCT) |
+                ((uint32_t)(global(LAB_FINAL_PRODUCT) == e.finalProduct) << TV_FIELD_FINAL_PRODUCT) |
+                ((uint32_t)((int32_t)c.r0 == e.finalProduct) << TV_FIELD_R0);
+        score(s.group[LAB_MAIN], c, mask, TV_MAIN_FIELDS);
+        s.cycles += c.cycles;
+    }
+    return true;
+}
+
+uint32_t labFuzzCheck(LabRunner &r, uint32_t packedValue)
+{
+    const expectedValues e = TV_EXPECTED(packedValue);
+    const uint32_t outA = r.localAddr(0);
+    const uint32_t outB = r.localAddr(1);
+    uint32_t mask = 0;
+
+    auto run = [&](LabGroup g, uint32_t a0, uint32_t a1, uint32_t a2)
+    {
+        LabCall c = r.call(r.fnAddr[g], a0, a1, a2, 0);
+        if (c.stop != ThumbCpu::Stop::Returned)
+        {
+            mask |= LAB_FUZZ_CRASH;
+        }
+        if (c.clobbered != 0)
+        {
+            mask |= LAB_FUZZ_AAPCS;
+        }
+        return (int32_t)c.r0;
+    };
+    auto word = [&](uint32_t addr)
+    {
+        return (int32_t)r.readWord(addr);
+    };
+
+    // reference checks of each function on its own
+    r.writeWord(outA, 0);
+    r.writeWord(outB, 0);
+    run(LAB_UNPACK, packedValue, outA, outB);
+    if (word(outA) != e.inputA || word(outB) != e.inputB)
+    {
+        mask |= FUZZ_FAIL_UNPACK;
+    }
+
+    const int32_t input[2] = {e.inputA, e.inputB};
+    const int32_t expAbs[2] = {e.absA, e.absB};
+    const int32_t expSign[2] = {e.signA, e.signB};
+    for (int i = 0; i < 2; ++i)
+    {
+        r.writeWord(outA, 0);
+        r.writeWord(outB, 0);
+        int32_t r0 = run(LAB_ABS, (uint32_t)input[i], outA, outB);
+        if (r0 != expAbs[i] || word(outA) != expAbs[i] ||
+                word(outB) != expSign[i])
+        {
+            mask |= FUZZ_FAIL_ABS;
+        }
+    }
+
+    int32_t initProduct = run(LAB_MULT, (uint32_t)e.absA, (uint32_t)e.absB, 0);
+    if (initProduct != e.initProduct)
+    {
+        mask |= FUZZ_FAIL_MULT;
+    }
+    if (run(LAB_MULT, (uint32_t)e.absB, (uint32_t)e.absA, 0) != initProduct)
+    {
+        mask |= FUZZ_FAIL_COMMUTE;
+    }
+
+    if (run(LAB_FIXSIGN, (uint32_t)e.initProduct, (uint32_t)e.signA,
+            (uint32_t)e.signB) != e.finalProduct)
+    {
+        mask |= FUZZ_FAIL_FIXSIGN;
+    }
+
+    int32_t finalProduct = run(LAB_MAIN, packedValue, 0, 0);
+    if (finalProduct != e.finalProduct)
+    {
+        mask |= FUZZ_FAIL_MAIN;
+    }
+
+    // properties of asmMain that do not depend on the reference
+    uint32_t swapped = (packedValue << 16) | (packedValue >> 16);
+    if (run(LAB_MAIN, swapped, 0, 0) != finalProduct)
+    {
+        mask |= FUZZ_FAIL_COMMUTE;
+    }
+    if ((packedValue >> 16) != 0x8000)
+    {
+        uint32_t negA = ((uint32_t)(uint16_t)(0 - e.inputA) << 16) |
+                (packedValue & 0x0000FFFF);
+        if (run(LAB_MAIN, negA, 0, 0) != 0 - finalProduct)
+        {
+            mask |= FUZZ_FAIL_SIGN;
+        }
+    }
+    if (run(LAB_MAIN, packedValue & 0x0000FFFF, 0, 0) != 0 ||
+            run(LAB_MAIN, packedValue & 0xFFFF0000, 0, 0) != 0)
+    {
+        mask |= FUZZ_FAIL_ZERO;
+    }
+    return mask;
+}
+
+std::string labFuzzMaskNames(uint32_t mask)
+{
+    std::string names;
+    for (uint32_t bit = 0; bit < LAB_FUZZ_NUM_BITS; ++bit)
+    {
+        if ((mask & (1u << bit)) != 0)
+        {
+            names += names.empty() ? "" : " ";
+            names += labFuzzNames[bit];
+        }
+    }
+    return names;
+}
+
+} // namespace lab
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,177 @@
+/* ************************************************************************** */
+/** The board's test sequence, run on thumbEmu
+
+  @File Name
+    labHarness.h
+
+  @Summary
+    Calls the functions of an assembled asmMult.s the way main.c does on
+    the board, and scores them the same way.
+
+  @Description
+    LabRunner holds one memory image: the object's flash and SRAM, with a
+    stack at the top of SRAM. Like the board, the image is loaded once and
+    the asm globals keep their values from call to call. call() mirrors
+    aapcsPrepare() and aapcsCall() inside TEST_GUARD_CALL():
+      - r4-r11 are seeded with the pattern aapcsPrepare() uses and checked
+        on return, along with SP;
+      - stores are limited to the asm output variables and the stack
+        window of the MPU sandbox (SANDBOX_STACK_BELOW and _ABOVE), so a
+        store the board reports as a FAULT faults here too;
+      - a call that runs more than maxInstructions is a TIMEOUT. The board
+        allows about TEST_GUARD_TIMEOUT_TICKS * 10 ms, millions of
+        instructions; a correct solution needs a few hundred, so the
+        default limit is much lower to keep looping submissions cheap.
+
+    gradeLab() runs every TEST_VECTORS case through the five groups in
+    main.c's order and counts PASS and FAIL fields as testFuncs.c does: a
+    TIMEOUT or FAULT fails every field of the call (TV_ABS_FIELDS etc. in
+    testFuncs.h). A call that changes
+    r4-r11 or SP is counted in aapcsCalls but does not change the score.
+    Points are 5 * passed / total per group, as in main.c. Build with the same -DTEST_VECTORS_EXTRA_FILE
+    and -DTEST_VECTORS_USE_PAIRWISE as the firmware to grade against the
+    same corpus.
+
+    labFuzzCheck() is fuzzCheckPacked() from fuzzFuncs.c on a LabRunner.
+    A call that crashed sets LAB_FUZZ_CRASH, the board's FUZZ_FAIL_GUARD.
+    One more bit is for a call that broke the calling convention, which
+    the board's fuzz mode does not check.
+ */
+/* ************************************************************************** */
+
+#ifndef _LAB_HARNESS_H    /* Guard against multiple inclusion */
+#define _LAB_HARNESS_H
+
+#include <cstdint>
+#include <string>
+
+#include "armObject.h"
+#include "thumbEmu.h"
+
+namespace lab
+{
+
+#define LAB_NUM_GROUPS 5
+
+    /* instructions per call before it is a TIMEOUT */
+#define LAB_DEFAULT_MAX_INSTRUCTIONS 100000
+
+    /* in main.c's order; the same indexes as resultTestId */
+enum LabGroup
+{
+    LAB_UNPACK = 0,
+    LAB_ABS,
+    LAB_MULT,
+    LAB_FIXSIGN,
+    LAB_MAIN
+};
+
+extern const char *const labGroupNames[LAB_NUM_GROUPS];
+
+    /* the asm outputs asmMain stores, in asmMult.s order */
+enum LabGlobal
+{
+    LAB_A_MULTIPLICAND = 0,
+    LAB_B_MULTIPLIER,
+    LAB_RNG_ERROR,
+    LAB_A_SIGN,
+    LAB_B_SIGN,
+    LAB_PROD_IS_NEG,
+    LAB_A_ABS,
+    LAB_B_ABS,
+    LAB_INIT_PRODUCT,
+    LAB_FINAL_PRODUCT,
+    LAB_NUM_GLOBALS
+};
+
+struct LabCall
+{
+    ThumbCpu::Stop stop;
+    uint32_t r0;
+    uint32_t clobbered;     // as aapcsCheckCase(): bit n is r(4+n); AAPCS_SP_BIT
+    uint64_t cycles;        // thumbEmu's estimate for this call
+};
+
+class LabRunner
+{
+public:
+    explicit LabRunner(const ArmImage &image);
+
+    /* false, with error set, if asmMult.s is missing a function or global */
+    bool ready() const { return error.empty(); }
+    std::string error;
+
+    /* call a function under the sandbox and AAPCS checks */
+    LabCall call(uint32_t fn, uint32_t a0, uint32_t a1, uint32_t a2,
+            uint32_t a3);
+
+    /* words in the caller's frame, passed as out pointers like main.c's
+     * locals; call() does not clear them */
+    uint32_t localAddr(uint32_t index) const { return stackTop + 4 * index; }
+    uint32_t readWord(uint32_t addr) const;
+    void writeWord(uint32_t addr, uint32_t value);
+
+    uint32_t fnAddr[LAB_NUM_GROUPS] = {0};      // Thumb bit set
+    uint32_t globalAddr[LAB_NUM_GLOBALS] = {0};
+
+    /* the string nameStrPtr points to, or "" */
+    std::string studentName() const;
+
+    uint64_t maxInstructions = LAB_DEFAULT_MAX_INSTRUCTIONS;
+
+    ThumbMemory mem;
+    ThumbCpu cpu;
+
+private:
+    uint32_t stackTop = 0;
+    uint32_t callCount = 0;
+    uint32_t nameStrPtr = 0;
+};
+
+struct LabGroupScore
+{
+    int32_t pass = 0;
+    int32_t fail = 0;
+    uint32_t timeouts = 0;
+    uint32_t faults = 0;
+    uint32_t aapcsCalls = 0;    // calls that did not preserve r4-r11 or SP
+
+    int32_t tests() const { return pass + fail; }
+    int32_t points() const { return tests() == 0 ? 0 : 5 * pass / tests(); }
+};
+
+struct LabScore
+{
+    std::string name;           // from nameStrPtr
+    LabGroupScore group[LAB_NUM_GROUPS];
+    uint64_t cycles = 0;        // over every call
+
+    int32_t totalPoints() const;
+};
+
+/* run the corpus; false, with runner.error set, if the runner is not ready */
+bool gradeLab(LabRunner &runner, LabScore &score);
+
+    /* labFuzzCheck() bits above the FUZZ_FAIL_xxx bits of fuzzFuncs.h */
+#define LAB_FUZZ_CRASH (1u << 8)    // a call timed out or faulted; as
+                                    // FUZZ_FAIL_GUARD
+#define LAB_FUZZ_AAPCS (1u << 9)    // a call did not preserve r4-r11 or SP
+#define LAB_FUZZ_NUM_BITS 10
+
+/* names of the labFuzzCheck() bits, lowest first */
+extern const char *const labFuzzNames[LAB_FUZZ_NUM_BITS];
+
+/* every check of fuzzCheckPacked() on one packed value; returns the
+ * FUZZ_FAIL_xxx and LAB_FUZZ_xxx bits of the checks that failed */
+uint32_t labFuzzCheck(LabRunner &runner, uint32_t packedValue);
+
+/* the names of the bits set in mask, space separated */
+std::string labFuzzMaskNames(uint32_t mask);
+
+} // namespace lab
+
+#endif /* _LAB_HARNESS_H */
+
+/* *****************************************************************************
+ End of File
+ */
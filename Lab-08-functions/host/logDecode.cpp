@@ -0,0 +1,327 @@
+/* ************************************************************************** */
+/** Host-side decoder for the binary log records
+
+  @File Name
+    logDecode.cpp
+
+  @Summary
+    Turns the records a board built with BIN_LOG_ENABLE sends back into the
+    text the reports would have printed.
+
+  @Description
+    Build and run on any Linux host with a C++17 compiler:
+
+        c++ -O2 -std=c++17 -o logDecode logDecode.cpp
+        ./logDecode < capture.bin
+        stty -F /dev/ttyACM0 115200 raw && ./logDecode /dev/ttyACM0
+
+    Options:
+        -s      print the record count and byte totals to stderr at the end
+
+    Text passes through as it is; a record (see binLog.h for its layout)
+    is printed with its format from ../firmware/src/binLogFormats.h, the
+    same table the firmware was built with, so the decoder must be rebuilt
+    when that table changes. A record with an unknown ID, or one cut short
+    by the end of the input, is shown as a bracketed note and skipped.
+
+    Output is flushed at every record and line end, so a live serial port
+    can be read as it runs.
+
+    Exit status is 0 if every record decoded, else 1.
+ */
+/* ************************************************************************** */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../firmware/src/binLog.h"
+
+namespace
+{
+
+#define LOG_DECODE_FORMAT_ENTRY(name, format) format,
+const char * const formats[] = {
+    BIN_LOG_FORMATS(LOG_DECODE_FORMAT_ENTRY)
+};
+#undef LOG_DECODE_FORMAT_ENTRY
+
+struct Stats
+{
+    uint64_t records = 0;
+    uint64_t recordBytes = 0;   // on the wire, headers included
+    uint64_t textBytes = 0;     // what the records decoded to
+    uint64_t bad = 0;
+};
+
+void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [-s] [file]\n", argv0);
+}
+
+/* the arguments of one record, read in format order */
+class Payload
+{
+public:
+    Payload(const std::vector<uint8_t> &bytes) : bytes_(bytes) {}
+
+    bool ok() const { return ok_; }
+
+    uint32_t unsignedWord()
+    {
+        uint32_t v = 0;
+        for (unsigned shift = 0; shift < 35; shift += 7)
+        {
+            if (pos_ >= bytes_.size())
+            {
+                ok_ = false;
+                return 0;
+            }
+            uint8_t b = bytes_[pos_++];
+            v |= (uint32_t)(b & 0x7F) << shift;
+            if ((b & 0x80) == 0)
+            {
+                return v;
+            }
+        }
+        ok_ = false;
+        return v;
+    }
+
+    int32_t signedWord()
+    {
+        uint32_t z = unsignedWord();
+        return (int32_t)((z >> 1) ^ (0u - (z & 1)));
+    }
+
+    std::string str()
+    {
+        uint32_t n = unsignedWord();
+        if (ok_ == false || n > bytes_.size() - pos_)
+        {
+            ok_ = false;
+            return std::string();
+        }
+        std::string s(bytes_.begin() + pos_, bytes_.begin() + pos_ + n);
+        pos_ += n;
+        return s;
+    }
+
+private:
+    const std::vector<uint8_t> &bytes_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+/* printf one conversion of the host's own; spec is "%" flags width */
+template <typename T>
+void appendConversion(std::string &out, std::string spec, char conv, T v)
+{
+    char field[64];
+    spec += conv;
+    snprintf(field, sizeof(field), spec.c_str(), v);
+    out += field;
+}
+
+/* the text of record id; false if its arguments ran out */
+bool decodeRecord(uint8_t id, const std::vector<uint8_t> &bytes,
+        std::string &out)
+{
+    Payload args(bytes);
+    for (const char *f = formats[id]; *f != '\0'; ++f)
+    {
+        if (*f != '%')
+        {
+            out += *f;
+            continue;
+        }
+        std::string spec = "%";
+        ++f;
+        while (*f != '\0' && strchr("-+ 0#", *f) != nullptr)
+        {
+            spec += *f++;
+        }
+        while (*f >= '0' && *f <= '9')
+        {
+            spec += *f++;
+        }
+        if (*f == 'l')
+        {
+            ++f;    // words are 32 bits on both ends; no l on the host
+        }
+        switch (*f)
+        {
+        case 'd':
+        case 'i':
+            appendConversion(out, spec, 'd', (int)args.signedWord());
+            break;
+        case 'u':
+        case 'x':
+        case 'X':
+            appendConversion(out, spec, *f, (unsigned)args.unsignedWord());
+            break;
+        case 's':
+            appendConversion(out, spec, 's', args.str().c_str());
+            break;
+        case 'V':
+        {
+            int32_t v = args.signedWord();
+            appendConversion(out, "%11", 'd', (int)v);
+            appendConversion(out, "; 0x%08", 'x', (unsigned)v);
+            break;
+        }
+        case 'P':
+            out += args.unsignedWord() != 0 ? "PASS" : "FAIL";
+            break;
+        case '%':
+            out += '%';
+            break;
+        default:
+            // a format this decoder does not know: show it, stop
+            out += spec;
+            return false;
+        }
+        if (*f == '\0')
+        {
+            break;
+        }
+    }
+    return args.ok();
+}
+
+/* read n bytes; false at the end of the input, with bytes holding what
+ * there was */
+bool readBytes(FILE *in, std::vector<uint8_t> &bytes, size_t n)
+{
+    bytes.resize(n);
+    bytes.resize(fread(bytes.data(), 1, n, in));
+    return bytes.size() == n;
+}
+
+void decodeStream(FILE *in, Stats &stats)
+{
+    std::vector<uint8_t> header;
+    std::vector<uint8_t> payload;
+    std::string text;
+    int c;
+
+    while ((c = getc(in)) != EOF)
+    {
+        if (c != BIN_LOG_SYNC)
+        {
+            putchar(c);
+            if (c == '\n')
+            {
+                fflush(stdout);
+            }
+            continue;
+        }
+
+        if (readBytes(in, header, BIN_LOG_HEADER_LEN - 1) == false)
+        {
+            printf("[truncated record header]\r\n");
+            ++stats.bad;
+            break;
+        }
+        uint8_t id = header[0];
+        size_t len = header[1] | ((size_t)header[2] << 8);
+        if (readBytes(in, payload, len) == false)
+        {
+            printf("[record %u truncated: %zu of %zu bytes]\r\n",
+                    (unsigned)id, payload.size(), len);
+            ++stats.bad;
+            break;
+        }
+        ++stats.records;
+        stats.recordBytes += BIN_LOG_HEADER_LEN + len;
+
+        if (id >= BIN_LOG_NUM_FORMATS)
+        {
+            printf("[unknown record id %u, %zu bytes]\r\n", (unsigned)id, len);
+            ++stats.bad;
+            continue;
+        }
+        text.clear();
+        if (decodeRecord(id, payload, text) == false)
+        {
+            text += "[record arguments short]\r\n";
+            ++stats.bad;
+        }
+        stats.textBytes += text.size();
+        fwrite(text.data(), 1, text.size(), stdout);
+        fflush(stdout);
+    }
+    fflush(stdout);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    bool printStats = false;
+    const char *path = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-s") == 0)
+        {
+            printStats = true;
+        }
+        else if (argv[i][0] == '-' && argv[i][1] != '\0')
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        else if (path == nullptr)
+        {
+            path = argv[i];
+        }
+        else
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    FILE *in = stdin;
+    if (path != nullptr && strcmp(path, "-") != 0)
+    {
+        in = fopen(path, "rb");
+        if (in == nullptr)
+        {
+            perror(path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    Stats stats;
+    decodeStream(in, stats);
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+
+    if (printStats)
+    {
+        fprintf(stderr, "%llu records, %llu bytes, decoded to %llu bytes "
+                "of text (%.1f times)\n",
+                (unsigned long long)stats.records,
+                (unsigned long long)stats.recordBytes,
+                (unsigned long long)stats.textBytes,
+                stats.recordBytes != 0 ?
+                (double)stats.textBytes / (double)stats.recordBytes : 0.0);
+        if (stats.bad != 0)
+        {
+            fprintf(stderr, "%llu records could not be decoded\n",
+                    (unsigned long long)stats.bad);
+        }
+    }
+    return stats.bad == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* *****************************************************************************
+ End of File
+ */
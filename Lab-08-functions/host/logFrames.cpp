@@ -0,0 +1,376 @@
+/* ************************************************************************** */
+/** Host-side checker for the framed UART output
+
+  @File Name
+    logFrames.cpp
+
+  @Summary
+    Checks the CRC and sequence number of every frame a board built with
+    PRINT_QUEUE_FRAMES sends, and passes the frames' bytes on without
+    their trailers.
+
+  @Description
+    Build and run on any Linux host with a C++17 compiler:
+
+        c++ -O2 -std=c++17 -o logFrames logFrames.cpp
+        ./logFrames < capture.bin
+        ./baudNegotiate /dev/ttyACM0 | ./logFrames | ./logInflate
+
+    Options:
+        -s      print the frame and byte totals to stderr at the end
+        -k      pass on the bytes of damaged frames too, and anything
+                outside a frame, instead of dropping them
+
+    The trailer layout is in ../firmware/src/printQueue.h. A trailer is
+    taken to be one when its sync and check bytes are right and it counts
+    no more bytes than have come since the last one; the frame is then
+    the last length bytes before it. A frame is reported on stderr when:
+      - its CRC is wrong (damaged; only believed of the expected sequence
+        number, since a frame's bytes can look like a trailer)
+      - bytes came between it and the last trailer that it does not
+        count (damaged or lost bytes, or a lost trailer)
+      - its sequence number skips some (lost frames)
+    A sequence number of 0 after the first frame is a board reset, and
+    the bytes before the first frame of a run are the handshake's plain
+    text: both pass on without a report.
+
+    stdout gets only frame bytes, so it can go on to logInflate or
+    logDecode; it is flushed after every read, so a live serial port can
+    be read as it runs.
+
+    Exit status is 0 if no frame was lost or damaged, else 1.
+ */
+/* ************************************************************************** */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../firmware/src/printQueue.h"
+
+namespace
+{
+
+/* a frame is at most this long; the trailer has 16 bits for it */
+const size_t maxFrame = 0xFFFF;
+
+struct Stats
+{
+    uint64_t frames = 0;        // good ones
+    uint64_t frameBytes = 0;
+    uint64_t damaged = 0;       // CRC wrong
+    uint64_t lost = 0;          // sequence numbers skipped
+    uint64_t strayBytes = 0;    // outside any frame
+    uint64_t resets = 0;
+};
+
+void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [-s] [-k] [file]\n", argv0);
+}
+
+class Crc32
+{
+public:
+    Crc32()
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t c = i;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                c = (c >> 1) ^ (0xEDB88320 & (0 - (c & 1)));
+            }
+            table_[i] = c;
+        }
+    }
+
+    uint32_t operator()(const uint8_t *p, size_t len) const
+    {
+        uint32_t crc = 0xFFFFFFFF;
+        while (len-- > 0)
+        {
+            crc = table_[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+private:
+    uint32_t table_[256];
+};
+
+/* the fields of a trailer */
+struct Trailer
+{
+    uint16_t seq;
+    uint16_t len;
+    uint32_t crc;
+};
+
+/* the trailer that ends at end, if the bytes there are one */
+bool trailerAt(const uint8_t *end, Trailer &t)
+{
+    const uint8_t *p = end - PRINT_QUEUE_TRAILER_LEN;
+    uint8_t check = 0;
+
+    if (p[0] != PRINT_QUEUE_FRAME_SYNC0 || p[1] != PRINT_QUEUE_FRAME_SYNC1)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < PRINT_QUEUE_TRAILER_LEN - 1; ++i)
+    {
+        check += p[i];
+    }
+    if ((uint8_t)~check != p[PRINT_QUEUE_TRAILER_LEN - 1])
+    {
+        return false;
+    }
+    t.seq = (uint16_t)(p[2] | (p[3] << 8));
+    t.len = (uint16_t)(p[4] | (p[5] << 8));
+    t.crc = (uint32_t)p[6] | ((uint32_t)p[7] << 8) |
+            ((uint32_t)p[8] << 16) | ((uint32_t)p[9] << 24);
+    return true;
+}
+
+class FrameChecker
+{
+public:
+    FrameChecker(bool keepBad, Stats &stats) : keepBad_(keepBad), stats_(stats)
+    {
+    }
+
+    void byte(uint8_t b)
+    {
+        pending_.push_back(b);
+
+        Trailer t;
+        size_t n = pending_.size();
+        if (n >= PRINT_QUEUE_TRAILER_LEN &&
+                trailerAt(pending_.data() + n, t) == true &&
+                t.len <= n - PRINT_QUEUE_TRAILER_LEN)
+        {
+            if (frame(t) == true)
+            {
+                pending_.clear();
+                return;
+            }
+        }
+
+        if (n >= 2 * (maxFrame + PRINT_QUEUE_TRAILER_LEN))
+        {
+            // no trailer can count more than the last maxFrame bytes
+            size_t old = n - (maxFrame + PRINT_QUEUE_TRAILER_LEN);
+            stray(pending_.data(), old);
+            pending_.erase(pending_.begin(), pending_.begin() + old);
+        }
+    }
+
+    /* what is left at the end of the input */
+    void finish()
+    {
+        if (pending_.empty() == false)
+        {
+            if (started_ == true)
+            {
+                fprintf(stderr, "[%zu bytes after the last trailer]\n",
+                        pending_.size());
+            }
+            stray(pending_.data(), pending_.size());
+            pending_.clear();
+        }
+    }
+
+private:
+    /* pending_ ends with trailer t; false if it is not taken as one */
+    bool frame(const Trailer &t)
+    {
+        size_t before = pending_.size() - PRINT_QUEUE_TRAILER_LEN - t.len;
+        const uint8_t *payload = pending_.data() + before;
+        bool crcOk = crc_(payload, t.len) == t.crc;
+        uint16_t expected = (uint16_t)(lastSeq_ + 1);
+
+        if (crcOk == false && (started_ == false || t.seq != expected))
+        {
+            return false;   // most likely frame bytes that look like one
+        }
+
+        if (started_ == true && t.seq == 0 && expected != 0)
+        {
+            fprintf(stderr, "[board reset after frame %u]\n",
+                    (unsigned)lastSeq_);
+            ++stats_.resets;
+            passOn(pending_.data(), before);    // its handshake
+        }
+        else if (started_ == false)
+        {
+            passOn(pending_.data(), before);    // text before the frames
+        }
+        else
+        {
+            if (t.seq != expected)
+            {
+                uint16_t skipped = (uint16_t)(t.seq - expected);
+                if (skipped == 1)
+                {
+                    fprintf(stderr, "[frame %u lost]\n", (unsigned)expected);
+                }
+                else
+                {
+                    fprintf(stderr, "[frames %u to %u lost]\n",
+                            (unsigned)expected,
+                            (unsigned)(uint16_t)(t.seq - 1));
+                }
+                stats_.lost += skipped;
+            }
+            if (before > 0)
+            {
+                fprintf(stderr, "[%zu bytes before frame %u outside any "
+                        "frame]\n", before, (unsigned)t.seq);
+                stray(pending_.data(), before);
+            }
+        }
+
+        if (crcOk == true)
+        {
+            ++stats_.frames;
+            stats_.frameBytes += t.len;
+            passOn(payload, t.len);
+        }
+        else
+        {
+            fprintf(stderr, "[frame %u damaged: CRC 0x%08x, expected "
+                    "0x%08x, %u bytes]\n", (unsigned)t.seq,
+                    (unsigned)crc_(payload, t.len), (unsigned)t.crc,
+                    (unsigned)t.len);
+            ++stats_.damaged;
+            if (keepBad_ == true)
+            {
+                passOn(payload, t.len);
+            }
+        }
+        started_ = true;
+        lastSeq_ = t.seq;
+        return true;
+    }
+
+    void stray(const uint8_t *p, size_t n)
+    {
+        if (started_ == false)
+        {
+            passOn(p, n);   // still the text before the frames
+            return;
+        }
+        stats_.strayBytes += n;
+        if (keepBad_ == true)
+        {
+            passOn(p, n);
+        }
+    }
+
+    void passOn(const uint8_t *p, size_t n)
+    {
+        fwrite(p, 1, n, stdout);
+    }
+
+    const bool keepBad_;
+    Stats &stats_;
+    const Crc32 crc_;
+    std::vector<uint8_t> pending_;  // everything since the last trailer
+    bool started_ = false;
+    uint16_t lastSeq_ = 0;
+};
+
+void checkStream(int fd, FrameChecker &checker)
+{
+    uint8_t buf[4096];
+    ssize_t n;
+
+    while ((n = read(fd, buf, sizeof(buf))) > 0)
+    {
+        for (ssize_t i = 0; i < n; ++i)
+        {
+            checker.byte(buf[i]);
+        }
+        fflush(stdout);
+    }
+    checker.finish();
+    fflush(stdout);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    bool printStats = false;
+    bool keepBad = false;
+    const char *path = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-s") == 0)
+        {
+            printStats = true;
+        }
+        else if (strcmp(argv[i], "-k") == 0)
+        {
+            keepBad = true;
+        }
+        else if (argv[i][0] == '-' && argv[i][1] != '\0')
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        else if (path == nullptr)
+        {
+            path = argv[i];
+        }
+        else
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    int fd = STDIN_FILENO;
+    if (path != nullptr && strcmp(path, "-") != 0)
+    {
+        fd = open(path, O_RDONLY);
+        if (fd < 0)
+        {
+            perror(path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    Stats stats;
+    FrameChecker checker(keepBad, stats);
+    checkStream(fd, checker);
+    if (fd != STDIN_FILENO)
+    {
+        close(fd);
+    }
+
+    if (printStats)
+    {
+        fprintf(stderr, "%llu frames, %llu bytes; %llu damaged, %llu lost, "
+                "%llu bytes outside frames, %llu resets\n",
+                (unsigned long long)stats.frames,
+                (unsigned long long)stats.frameBytes,
+                (unsigned long long)stats.damaged,
+                (unsigned long long)stats.lost,
+                (unsigned long long)stats.strayBytes,
+                (unsigned long long)stats.resets);
+    }
+    bool clean = stats.damaged == 0 && stats.lost == 0 &&
+            stats.strayBytes == 0;
+    return clean ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,224 @@
+/* ************************************************************************** */
+/** Host-side decompressor for the compressed UART output
+
+  @File Name
+    logInflate.cpp
+
+  @Summary
+    Turns what a board built with LOG_COMPRESS_ENABLE sends back into the
+    text (or binary records) it queued.
+
+  @Description
+    Build and run on any Linux host with a C++17 compiler:
+
+        cc -O2 -c ../firmware/src/logCompress.c
+        c++ -O2 -std=c++17 -o logInflate logInflate.cpp logCompress.o
+        ./logInflate < capture.bin
+        ./baudNegotiate /dev/ttyACM0 | ./logInflate | ./logDecode
+
+    Options:
+        -s      print the byte totals to stderr at the end
+        -c      compress instead, the way the board does (printQueue.c's
+                pieces of LOG_COMPRESS_MAX_INPUT bytes), to see what a
+                captured plain log would gain
+
+    Everything before the LOG_COMPRESS_MARKER line passes through as it
+    is, so the baud rate handshake still shows. After it the input is
+    decoded with ../firmware/src/logCompress.c, the same code the board
+    codes with. A copy from before the start of the stream means the
+    input is not what this expects (a board reset, or a capture started
+    late): that is shown as a bracketed note, and the input passes
+    through again until the next marker.
+
+    Output is flushed after every read, so a live serial port can be read
+    as it runs.
+
+    Exit status is 0 if everything after a marker decoded, else 1.
+ */
+/* ************************************************************************** */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../firmware/src/logCompress.h"
+
+namespace
+{
+
+struct Stats
+{
+    uint64_t codedBytes = 0;    // after the marker
+    uint64_t textBytes = 0;     // what they decoded to
+    uint64_t streams = 0;
+    uint64_t bad = 0;
+};
+
+void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [-s] [-c] [file]\n", argv0);
+}
+
+void writeDecoded(void *ctx, const uint8_t *bytes, uint32_t len)
+{
+    static_cast<Stats *>(ctx)->textBytes += len;
+    fwrite(bytes, 1, len, stdout);
+}
+
+void inflateStream(int fd, Stats &stats)
+{
+    static logCompressDecoder decoder;
+    const std::string marker = LOG_COMPRESS_MARKER;
+    std::string held;           // what may be the start of a marker
+    bool inStream = false;
+    uint8_t buf[4096];
+    ssize_t n;
+
+    while ((n = read(fd, buf, sizeof(buf))) > 0)
+    {
+        for (ssize_t i = 0; i < n; ++i)
+        {
+            if (inStream)
+            {
+                ++stats.codedBytes;
+                // a byte at a time, so that a bad copy is found where it is
+                if (logCompressDecode(&decoder, &buf[i], 1, writeDecoded,
+                        &stats) == false)
+                {
+                    printf("[copy from before the stream start; waiting for "
+                            "the next marker]\r\n");
+                    ++stats.bad;
+                    inStream = false;
+                }
+                continue;
+            }
+
+            held += (char)buf[i];
+            if (held == marker)
+            {
+                logCompressDecoderInit(&decoder);
+                ++stats.streams;
+                inStream = true;
+                held.clear();
+                continue;
+            }
+            if (marker.compare(0, held.size(), held) != 0)
+            {
+                // not the marker: pass it through, but for a last byte
+                // that may start one
+                size_t keep = held.size() > 1 && held.back() == marker[0];
+                fwrite(held.data(), 1, held.size() - keep, stdout);
+                held.erase(0, held.size() - keep);
+            }
+        }
+        fflush(stdout);
+    }
+    fwrite(held.data(), 1, held.size(), stdout);
+    fflush(stdout);
+}
+
+void deflateStream(int fd, Stats &stats)
+{
+    static logCompressEncoder encoder;
+    uint8_t buf[LOG_COMPRESS_MAX_INPUT];
+    uint8_t coded[LOG_COMPRESS_BOUND(LOG_COMPRESS_MAX_INPUT)];
+    ssize_t n;
+
+    logCompressEncoderInit(&encoder);
+    fputs(LOG_COMPRESS_MARKER, stdout);
+    ++stats.streams;
+    while ((n = read(fd, buf, sizeof(buf))) > 0)
+    {
+        uint32_t len = logCompressEncode(&encoder, buf, (uint32_t)n, coded);
+        fwrite(coded, 1, len, stdout);
+        stats.textBytes += (uint64_t)n;
+        stats.codedBytes += len;
+    }
+    fflush(stdout);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    bool printStats = false;
+    bool compress = false;
+    const char *path = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-s") == 0)
+        {
+            printStats = true;
+        }
+        else if (strcmp(argv[i], "-c") == 0)
+        {
+            compress = true;
+        }
+        else if (argv[i][0] == '-' && argv[i][1] != '\0')
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        else if (path == nullptr)
+        {
+            path = argv[i];
+        }
+        else
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    int fd = STDIN_FILENO;
+    if (path != nullptr && strcmp(path, "-") != 0)
+    {
+        fd = open(path, O_RDONLY);
+        if (fd < 0)
+        {
+            perror(path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    Stats stats;
+    if (compress)
+    {
+        deflateStream(fd, stats);
+    }
+    else
+    {
+        inflateStream(fd, stats);
+    }
+    if (fd != STDIN_FILENO)
+    {
+        close(fd);
+    }
+
+    if (printStats)
+    {
+        fprintf(stderr, "%llu streams, %llu coded bytes for %llu bytes "
+                "(%.1f times)\n",
+                (unsigned long long)stats.streams,
+                (unsigned long long)stats.codedBytes,
+                (unsigned long long)stats.textBytes,
+                stats.codedBytes != 0 ?
+                (double)stats.textBytes / (double)stats.codedBytes : 0.0);
+        if (stats.bad != 0)
+        {
+            fprintf(stderr, "%llu streams ended with a bad copy\n",
+                    (unsigned long long)stats.bad);
+        }
+    }
+    return stats.bad == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* *****************************************************************************
+ End of File
+ */
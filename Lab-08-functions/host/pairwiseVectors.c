@@ -0,0 +1,192 @@
+/* ************************************************************************** */
+/** Host-side generator of the pairwise edge-case test vectors
+
+  @File Name
+    pairwiseVectors.c
+
+  @Summary
+    Writes a covering array of packed inputs: every pair of lane boundary
+    classes, with the lane signs chosen so that every sign meets every
+    class and every other sign.
+
+  @Description
+    Build and run on any host with a C compiler:
+
+        cc -O2 -o pairwiseVectors pairwiseVectors.c
+        ./pairwiseVectors > ../firmware/src/testVectorsPairwise.h
+        ./pairwiseVectors --macro TEST_VECTORS_EXTRA > extra.h
+
+    Each 16-bit lane is one of the magnitude classes in laneClasses[]:
+    0, 1, small values, powers of two, byte boundaries, alternating bits,
+    MAX - 1, MAX and MIN, with a sign. The factors are A's class, B's
+    class, A's sign and B's sign. Every pair of classes gets a row, and
+    each row's signs are picked greedily to cover the most (class, sign)
+    and (sign, sign) pairs not yet covered, so the table covers all pairs
+    of the four factors in one row per pair of classes. 0 and MIN have one
+    sign only.
+
+    The default output defines TEST_VECTORS_PAIRWISE, which testVectors.h
+    adds to the corpus when TEST_VECTORS_USE_PAIRWISE is 1. With --macro
+    TEST_VECTORS_EXTRA the output can be used as TEST_VECTORS_EXTRA_FILE
+    instead. Exits 1 if a pair is left uncovered.
+ */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/* lane magnitudes; -0x5556 is the 0xAAAA pattern */
+static const uint32_t laneClasses[] = {
+    0x0000, 0x0001, 0x0002, 0x0003,
+    0x0010, 0x0080, 0x00FF, 0x0100,
+    0x0800, 0x1000, 0x4000, 0x5555,
+    0x5556, 0x7FFE, 0x7FFF, 0x8000
+};
+#define NUM_CLASSES (sizeof(laneClasses) / sizeof(laneClasses[0]))
+
+/* pairs not yet covered */
+static bool classSignA[NUM_CLASSES][2];    // A's class with A's sign
+static bool classSignB[NUM_CLASSES][2];    // A's class with B's sign
+static bool signAClass[NUM_CLASSES][2];    // B's class with A's sign
+static bool signBClass[NUM_CLASSES][2];    // B's class with B's sign
+static bool signSign[2][2];
+
+/* the sign a class can actually take: 0 is never negative, MIN always */
+static int realSign(uint32_t c, int sign)
+{
+    if (laneClasses[c] == 0)
+    {
+        return 0;
+    }
+    if (laneClasses[c] == 0x8000)
+    {
+        return 1;
+    }
+    return sign;
+}
+
+static int32_t laneValue(uint32_t c, int sign)
+{
+    int32_t m = (int32_t)laneClasses[c];
+    return (int16_t)(realSign(c, sign) ? -m : m);
+}
+
+/* pairs a row would cover; clears them too if take is set */
+static int coverRow(uint32_t i, uint32_t j, int sa, int sb, bool take)
+{
+    bool *pairs[5] = {
+        &classSignA[i][sa], &classSignB[i][sb],
+        &signAClass[j][sa], &signBClass[j][sb],
+        &signSign[sa][sb]
+    };
+    int n = 0;
+    for (int k = 0; k < 5; ++k)
+    {
+        if (*pairs[k] == true)
+        {
+            ++n;
+            if (take)
+            {
+                *pairs[k] = false;
+            }
+        }
+    }
+    return n;
+}
+
+int main(int argc, char **argv)
+{
+    const char *macro = "TEST_VECTORS_PAIRWISE";
+    static uint32_t rows[NUM_CLASSES * NUM_CLASSES];
+    uint32_t numRows = 0;
+
+    if (argc == 3 && strcmp(argv[1], "--macro") == 0)
+    {
+        macro = argv[2];
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s [--macro NAME]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // every pair a class can take part in starts uncovered
+    for (uint32_t c = 0; c < NUM_CLASSES; ++c)
+    {
+        for (int s = 0; s < 2; ++s)
+        {
+            bool own = realSign(c, s) == s;
+            classSignA[c][s] = own;
+            classSignB[c][s] = true;
+            signAClass[c][s] = true;
+            signBClass[c][s] = own;
+        }
+    }
+    memset(signSign, true, sizeof(signSign));
+
+    for (uint32_t i = 0; i < NUM_CLASSES; ++i)
+    {
+        for (uint32_t j = 0; j < NUM_CLASSES; ++j)
+        {
+            int best = -1;
+            int bestSa = 0;
+            int bestSb = 0;
+            // once every pair is covered, ties rotate through the sign
+            // options instead of always taking +,+
+            for (int k = 0; k < 4; ++k)
+            {
+                int option = (int)((k + i + j) & 3);
+                int sa = realSign(i, option >> 1);
+                int sb = realSign(j, option & 1);
+                int n = coverRow(i, j, sa, sb, false);
+                if (n > best)
+                {
+                    best = n;
+                    bestSa = sa;
+                    bestSb = sb;
+                }
+            }
+            coverRow(i, j, bestSa, bestSb, true);
+            rows[numRows++] = ((uint32_t)(uint16_t)laneValue(i, bestSa) << 16) |
+                    (uint16_t)laneValue(j, bestSb);
+        }
+    }
+
+    for (int s = 0; s < 2; ++s)
+    {
+        for (uint32_t c = 0; c < NUM_CLASSES; ++c)
+        {
+            if (classSignA[c][s] || classSignB[c][s] ||
+                    signAClass[c][s] || signBClass[c][s])
+            {
+                fprintf(stderr, "class 0x%04lx with sign %d is not covered\n",
+                        (unsigned long)laneClasses[c], s);
+                return EXIT_FAILURE;
+            }
+        }
+        if (signSign[s][0] || signSign[s][1])
+        {
+            fprintf(stderr, "A sign %d is not covered\n", s);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("/* Pairwise edge-case vectors: %lu lane classes, %lu rows.\n"
+            " * Generated by host/pairwiseVectors.c; do not edit. */\n"
+            "#define %s(X) \\\n",
+            (unsigned long)NUM_CLASSES, (unsigned long)numRows, macro);
+    for (uint32_t r = 0; r < numRows; ++r)
+    {
+        printf("    X(0x%08lX)  /* %6d * %6d */%s\n", (unsigned long)rows[r],
+                (int16_t)(rows[r] >> 16), (int16_t)(rows[r] & 0xFFFF),
+                r + 1 < numRows ? " \\" : "");
+    }
+    return EXIT_SUCCESS;
+}
+
+/* *****************************************************************************
+ End of File
+ */
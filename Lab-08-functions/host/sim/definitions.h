@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/** Stand-in for Harmony's definitions.h in a host build
+
+  @File Name
+    definitions.h
+
+  @Summary
+    The few DMAC types and constants the firmware's USING_HW 0 branches
+    still name, so that simCheck.cpp can build them on the host.
+
+  @Description
+    Only for -DUSING_HW=0 builds with -Isim ahead of the firmware's own
+    include paths. The values match the SAME51 pack where they matter to
+    the simulated DMAC; nothing here touches hardware.
+ */
+/* ************************************************************************** */
+
+#ifndef _SIM_DEFINITIONS_H    /* Guard against multiple inclusion */
+#define _SIM_DEFINITIONS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __ALIGNED(x) __attribute__((aligned(x)))
+
+    /* a DMAC transfer descriptor; the addresses are 32 bits, as on the
+     * board, so the host build must keep its buffers below 4 GB */
+typedef struct
+{
+    uint16_t DMAC_BTCTRL;
+    uint16_t DMAC_BTCNT;
+    uint32_t DMAC_SRCADDR;
+    uint32_t DMAC_DSTADDR;
+    uint32_t DMAC_DESCADDR;
+} dmac_descriptor_registers_t;
+
+#define DMAC_BTCTRL_VALID_Msk       0x0001
+#define DMAC_BTCTRL_BLOCKACT_NOACT  0x0000
+#define DMAC_BTCTRL_BLOCKACT_INT    0x0010
+#define DMAC_BTCTRL_BEATSIZE_BYTE   0x0000
+#define DMAC_BTCTRL_SRCINC_Msk      0x0400
+#define DMAC_BTCTRL_DSTINC_Msk      0x0800
+
+typedef enum
+{
+    DMAC_TRANSFER_EVENT_NONE = 0,
+    DMAC_TRANSFER_EVENT_COMPLETE = 1,
+    DMAC_TRANSFER_EVENT_ERROR = 2
+} DMAC_TRANSFER_EVENT;
+
+static inline void LED0_Toggle(void)
+{
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SIM_DEFINITIONS_H */
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,926 @@
+/* ************************************************************************** */
+/** Host-side checks of the firmware's simulator builds
+
+  @File Name
+    simCheck.cpp
+
+  @Summary
+    Builds the firmware's print queue, console and result store without
+    the hardware (USING_HW 0), drives them through their simulator hooks,
+    and checks what comes out.
+
+  @Description
+    Build and run on any Linux host with a C and a C++17 compiler:
+
+        cc -O2 -c -DUSING_HW=0 -Isim ../firmware/src/printQueue.c \
+                ../firmware/src/logCompress.c ../firmware/src/console.c \
+                ../firmware/src/fmtFuncs.c ../firmware/src/resultStore.c
+        c++ -O2 -std=c++17 -no-pie -o simCheck simCheck.cpp *.o
+        ./simCheck
+
+    and again, in another directory, as the framed and compressed build:
+
+        cc -O2 -c -DUSING_HW=0 -DPRINT_QUEUE_FRAMES=1 \
+                -DLOG_COMPRESS_ENABLE=1 -Isim ...the same five files...
+        c++ -O2 -std=c++17 -no-pie -DPRINT_QUEUE_FRAMES=1 \
+                -DLOG_COMPRESS_ENABLE=1 -o simCheck simCheck.cpp *.o
+        ./simCheck
+
+    with logFrames and logInflate built in the directory it runs in.
+
+    Options:
+        -v      print every check, not only the ones that fail
+
+    sim/definitions.h stands in for Harmony's, with just what the
+    USING_HW 0 branches use. The simulated DMAC keeps addresses in the
+    32-bit descriptor fields the board has, so the program is linked
+    -no-pie to keep its static buffers below 4 GB. printAndWait() and the
+    differential test's engine table are defined here, since the rest of
+    printFuncs.c and diffFuncs.c needs the asm functions.
+
+    The default build (PRINT_QUEUE_FRAMES and LOG_COMPRESS_ENABLE both 0)
+    compares the sink's bytes with the text queued. The framed build runs
+    the sink's bytes through ./logFrames and ./logInflate instead, and
+    checks that no frame is damaged or lost and that the text comes back
+    exactly; its console and report checks are left out, since they look
+    for text in the raw sink. It also changes a byte of a frame, which
+    logFrames must report as damaged.
+
+    Exit status is 0 if every check passes, else 1.
+ */
+/* ************************************************************************** */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+
+#include "../firmware/src/printQueue.h"
+#include "../firmware/src/logCompress.h"
+#include "../firmware/src/printFuncs.h"
+#include "../firmware/src/console.h"
+#include "../firmware/src/diffFuncs.h"
+#include "../firmware/src/resultStore.h"
+
+static_assert(PRINT_QUEUE_FRAMES == LOG_COMPRESS_ENABLE,
+        "simCheck is built plain, or with frames and compression both");
+
+/* as printFuncs.c's */
+extern "C" void printAndWait(char *txBuffer, volatile bool *txCompletePtr)
+{
+    printQueueBufferSend(txBuffer, (uint32_t)strlen(txBuffer), txCompletePtr);
+}
+
+/* names for the console's engine command; never run */
+extern "C" const diffEngine diffEngines[] = {
+    { "mul",     nullptr },
+    { "smuad",   nullptr },
+    { "asmMain", nullptr }
+};
+extern "C" const uint32_t diffNumEngines =
+        sizeof(diffEngines) / sizeof(diffEngines[0]);
+
+namespace
+{
+
+/* everything the simulated DMAC has moved since the last reset */
+std::string sinkBytes;
+
+void sinkAppend(const uint8_t *bytes, uint32_t len)
+{
+    sinkBytes.append(reinterpret_cast<const char *>(bytes), len);
+}
+
+void resetQueue()
+{
+    printQueueInit();
+    printQueueSimSinkRegister(sinkAppend);
+    sinkBytes.clear();
+}
+
+void put(const std::string &s, volatile bool *done)
+{
+    printQueuePut(s.data(), (uint32_t)s.size(), done);
+}
+
+/* the text of message n, of a length that varies with n */
+std::string message(uint32_t n)
+{
+    char line[80];
+    snprintf(line, sizeof(line), "message %lu%*s\r\n", (unsigned long)n,
+            (int)(n * 7 % 41), "");
+    return line;
+}
+
+struct Check
+{
+    const char *name;
+    bool (*run)(std::string &why);
+};
+
+#if !PRINT_QUEUE_FRAMES
+bool checkQueueOrder(std::string &why)
+{
+    volatile bool first = true;
+    volatile bool second = true;
+
+    resetQueue();
+    put("first\r\n", &first);
+    if (first == true || sinkBytes.empty() == false)
+    {
+        why = "a message was sent before the DMAC ran";
+        return false;
+    }
+    // the first message's chain is running, so the second waits for it
+    put("second\r\n", &second);
+    if (printQueueSimRun(1) != 1 || sinkBytes != "first\r\n" ||
+            first == false || second == true)
+    {
+        why = "one block did not complete the first chain alone";
+        return false;
+    }
+    printQueueFlush();
+    if (sinkBytes != "first\r\nsecond\r\n" || second == false)
+    {
+        why = "got \"" + sinkBytes + "\"";
+        return false;
+    }
+    return true;
+}
+
+bool checkRingWrap(std::string &why)
+{
+    std::string expected;
+
+    resetQueue();
+    // more than the segments and the ring hold, so both wrap and the
+    // puts wait on the DMAC for room
+    for (uint32_t n = 0; n < 4 * PRINT_QUEUE_SEGMENTS; ++n)
+    {
+        std::string m = message(n);
+        put(m, nullptr);
+        expected += m;
+    }
+    std::string longer;
+    for (uint32_t i = 0; longer.size() < PRINT_QUEUE_BYTES * 3 / 2 + 7; ++i)
+    {
+        longer += (char)('a' + i % 26);
+    }
+    volatile bool done = false;
+    put(longer, &done);
+    expected += longer;
+    printQueueFlush();
+
+    if (sinkBytes != expected)
+    {
+        why = "the output differs from the messages queued";
+        return false;
+    }
+    if (done == false || printQueuePending() != 0)
+    {
+        why = "the queue did not empty";
+        return false;
+    }
+    return true;
+}
+
+bool checkChainLength(std::string &why)
+{
+    const uint32_t count = PRINT_QUEUE_DESCRIPTORS + 4;
+    volatile bool done[count];
+
+    resetQueue();
+    // queued behind a running chain, these go out in full chains after it
+    put("head\r\n", nullptr);
+    for (uint32_t n = 0; n < count; ++n)
+    {
+        put(message(n), &done[n]);
+    }
+    printQueueSimRun(1);
+    // the done flags are set when a chain ends, and only then
+    printQueueSimRun(PRINT_QUEUE_DESCRIPTORS - 1);
+    if (done[0] == true)
+    {
+        why = "a segment was done before the end of its chain";
+        return false;
+    }
+    printQueueSimRun(1);
+    if (done[PRINT_QUEUE_DESCRIPTORS - 1] == false ||
+            done[PRINT_QUEUE_DESCRIPTORS] == true)
+    {
+        why = "a chain did not hold PRINT_QUEUE_DESCRIPTORS segments";
+        return false;
+    }
+    if (printQueueSimRun(1000) != count - PRINT_QUEUE_DESCRIPTORS ||
+            done[count - 1] == false)
+    {
+        why = "the last chain did not hold the rest";
+        return false;
+    }
+    return true;
+}
+
+bool checkBuffers(std::string &why)
+{
+    std::string expected;
+
+    resetQueue();
+    char *held = printQueueBufferGet();
+    if (printQueueBufferGet() != held)
+    {
+        why = "a second get did not return the held buffer";
+        return false;
+    }
+    // more sends than buffers: each get past the last waits on the DMAC
+    // for the oldest to come back
+    volatile bool done[PRINT_QUEUE_TX_BUFFERS + 2];
+    for (uint32_t n = 0; n < PRINT_QUEUE_TX_BUFFERS + 2; ++n)
+    {
+        char *b = printQueueBufferGet();
+        std::string m = message(n);
+        memcpy(b, m.data(), m.size());
+        printQueueBufferSend(b, (uint32_t)m.size(), &done[n]);
+        expected += m;
+    }
+    // not a pool buffer: sent as a copy
+    char local[] = "copied\r\n";
+    printQueueBufferSend(local, sizeof(local) - 1, nullptr);
+    expected += local;
+    printQueueFlush();
+
+    if (sinkBytes != expected)
+    {
+        why = "got \"" + sinkBytes + "\"";
+        return false;
+    }
+    for (uint32_t n = 0; n < PRINT_QUEUE_TX_BUFFERS + 2; ++n)
+    {
+        if (done[n] == false)
+        {
+            why = "buffer send " + std::to_string(n) + " not done";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool checkNoSink(std::string &why)
+{
+    volatile bool done = false;
+
+    resetQueue();
+    printQueueSimSinkRegister(nullptr);
+    put("dropped\r\n", &done);
+    printQueueFlush();
+    if (done == false || sinkBytes.empty() == false ||
+            printQueueErrors() != 0)
+    {
+        why = "a discarded message was not completed cleanly";
+        return false;
+    }
+    return true;
+}
+#endif
+
+bool checkCrc(std::string &why)
+{
+    uint32_t crc = printQueueCrc32("123456789", 9);
+    if (crc != 0xCBF43926UL)
+    {
+        char hex[16];
+        snprintf(hex, sizeof(hex), "0x%08lx", (unsigned long)crc);
+        why = std::string("CRC-32 of \"123456789\" is ") + hex;
+        return false;
+    }
+    return true;
+}
+
+#if PRINT_QUEUE_FRAMES
+/* what logFrames and logInflate made of the sink's bytes */
+struct Decoded
+{
+    bool framesClean = false;   // logFrames' exit status was 0
+    bool inflated = false;      // logInflate's was
+    std::string report;         // logFrames -s on stderr
+    std::string text;
+};
+
+std::string readFile(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    std::ostringstream s;
+    s << in.rdbuf();
+    return s.str();
+}
+
+Decoded decode(const std::string &bytes)
+{
+    Decoded d;
+    char dir[] = "/tmp/simCheckXXXXXX";
+
+    if (mkdtemp(dir) == nullptr)
+    {
+        d.report = "no temporary directory";
+        return d;
+    }
+    const std::string sink = std::string(dir) + "/sink.bin";
+    const std::string frames = std::string(dir) + "/frames.bin";
+    const std::string report = std::string(dir) + "/frames.txt";
+    const std::string text = std::string(dir) + "/text.txt";
+    std::ofstream(sink, std::ios::binary) << bytes;
+
+    std::string cmd = "./logFrames -s < " + sink + " > " + frames + " 2> " +
+            report;
+    d.framesClean = system(cmd.c_str()) == 0;
+    cmd = "./logInflate < " + frames + " > " + text;
+    d.inflated = system(cmd.c_str()) == 0;
+    d.report = readFile(report);
+    d.text = readFile(text);
+
+    for (const std::string *path : { &sink, &frames, &report, &text })
+    {
+        unlink(path->c_str());
+    }
+    rmdir(dir);
+    return d;
+}
+
+/* queue a mix of puts and buffer sends that fills and wraps the ring;
+ * returns the text queued */
+std::string queueMix()
+{
+    std::string expected;
+
+    resetQueue();
+    for (uint32_t n = 0; n < 4 * PRINT_QUEUE_SEGMENTS; ++n)
+    {
+        std::string m = message(n);
+        if (n % 3 == 0)
+        {
+            char *b = printQueueBufferGet();
+            memcpy(b, m.data(), m.size());
+            printQueueBufferSend(b, (uint32_t)m.size(), nullptr);
+        }
+        else
+        {
+            put(m, nullptr);
+        }
+        expected += m;
+    }
+    std::string longer;
+    for (uint32_t i = 0; longer.size() < PRINT_QUEUE_BYTES * 3 / 2 + 7; ++i)
+    {
+        longer += (char)('a' + i * i % 26);
+    }
+    put(longer, nullptr);
+    expected += longer;
+    printQueueFlush();
+    return expected;
+}
+
+bool checkFramedOutput(std::string &why)
+{
+    std::string expected = queueMix();
+    Decoded d = decode(sinkBytes);
+
+    if (d.framesClean == false ||
+            d.report.find(" 0 damaged, 0 lost, 0 bytes outside frames") ==
+            std::string::npos)
+    {
+        why = "logFrames reported: " + d.report;
+        return false;
+    }
+    if (d.inflated == false || d.text != expected)
+    {
+        why = "logInflate's output differs from the text queued";
+        return false;
+    }
+    return true;
+}
+
+bool checkFramedDamage(std::string &why)
+{
+    std::string expected = queueMix();
+    // the last byte of the last frame: a frame after the first, so its
+    // sequence number is expected and a bad CRC is believed
+    std::string bytes = sinkBytes;
+    bytes[bytes.size() - PRINT_QUEUE_TRAILER_LEN - 1] ^= 0x20;
+    Decoded d = decode(bytes);
+
+    if (d.framesClean == true ||
+            d.report.find(" 1 damaged, 0 lost") == std::string::npos)
+    {
+        why = "a changed byte was not reported: " + d.report;
+        return false;
+    }
+    // the damaged frame is dropped: what came before it is still right
+    if (d.text.size() >= expected.size() ||
+            expected.compare(0, d.text.size(), d.text) != 0)
+    {
+        why = "the frames before the damaged one did not decode";
+        return false;
+    }
+    return true;
+}
+#else
+/* main.c's settings, as far as the console checks need them */
+struct ConsoleSettings
+{
+    bool turbo = false;
+    bool fuzz = true;
+    uint32_t fuzzSeed = 1;
+    benchInputSet inputs = BENCH_INPUTS_TEST_VECTORS;
+    uint32_t engineMask = 0x7;
+};
+
+ConsoleSettings settings;
+
+const consoleFlag settingFlags[] = {
+    { "turbo", &settings.turbo },
+    { "fuzz",  &settings.fuzz }
+};
+const consoleNumber settingNumbers[] = {
+    { "fuzzseed", &settings.fuzzSeed }
+};
+const consoleConfig settingConfig = {
+    settingFlags, sizeof(settingFlags) / sizeof(settingFlags[0]),
+    settingNumbers, sizeof(settingNumbers) / sizeof(settingNumbers[0]),
+    &settings.inputs,
+    &settings.engineMask
+};
+
+void resetConsole()
+{
+    resetQueue();
+    settings = ConsoleSettings();
+    consoleInit(&settingConfig);
+}
+
+/* feed input to the console, poll it, and return what it printed */
+std::string consoleRun(const char *input, bool *runRequested = nullptr)
+{
+    sinkBytes.clear();
+    consoleSimInput(input);
+    bool run = consolePoll();
+    printQueueFlush();
+    if (runRequested != nullptr)
+    {
+        *runRequested = run;
+    }
+    return sinkBytes;
+}
+
+bool checkConsoleSettings(std::string &why)
+{
+    resetConsole();
+    std::string out = consoleRun("set turbo on\rset fuzz off\n"
+            "set fuzzseed 0x1234\r\ninputs random\r");
+    if (out.empty() == false)
+    {
+        why = "good commands printed \"" + out + "\"";
+        return false;
+    }
+    if (settings.turbo == false || settings.fuzz == true ||
+            settings.fuzzSeed != 0x1234 ||
+            settings.inputs != BENCH_INPUTS_RANDOM)
+    {
+        why = "a setting did not change";
+        return false;
+    }
+    // backspace takes back the byte before it
+    consoleRun("set turbo onx\b\x7f" "ff\r");
+    if (settings.turbo == true)
+    {
+        why = "backspace was not applied";
+        return false;
+    }
+    out = consoleRun("show\r");
+    if (out.find("turbo off\r\n") == std::string::npos ||
+            out.find("fuzzseed 4660 (0x00001234)\r\n") == std::string::npos)
+    {
+        why = "show printed \"" + out + "\"";
+        return false;
+    }
+    return true;
+}
+
+bool checkConsoleEngines(std::string &why)
+{
+    resetConsole();
+    consoleRun("engine smuad off\r");
+    if (settings.engineMask != 0x5)
+    {
+        why = "engine smuad off left the mask at " +
+                std::to_string(settings.engineMask);
+        return false;
+    }
+    consoleRun("engine all off\r");
+    std::string out = consoleRun("engine asmMain on\r");
+    // the reference's bit is never cleared
+    if (settings.engineMask != 0x5 || out.empty() == false)
+    {
+        why = "engine all off, asmMain on left the mask at " +
+                std::to_string(settings.engineMask);
+        return false;
+    }
+    out = consoleRun("engine mul off\r");
+    if (out != "console: the reference always runs: 'mul'; try help\r\n")
+    {
+        why = "engine mul off printed \"" + out + "\"";
+        return false;
+    }
+    return true;
+}
+
+bool checkConsoleErrors(std::string &why)
+{
+    static const struct
+    {
+        const char *input;
+        const char *reply;
+    } cases[] = {
+        { "set fuzzseed 12x\r", "console: not a number: '12x'; try help\r\n" },
+        { "set turbo maybe\r",
+                "console: expected on or off, not 'maybe'; try help\r\n" },
+        { "set speed 3\r", "console: no setting 'speed'; try help\r\n" },
+        { "set turbo\r",
+                "console: set needs a name and a value; try help\r\n" },
+        { "inputs some\r",
+                "console: inputs are vectors or random; try help\r\n" },
+        { "jump\r", "console: unknown command 'jump'; try help\r\n" },
+    };
+
+    resetConsole();
+    for (const auto &c : cases)
+    {
+        std::string out = consoleRun(c.input);
+        if (out != c.reply)
+        {
+            why = std::string("\"") + c.input + "\" printed \"" + out + "\"";
+            return false;
+        }
+    }
+    if (settings.turbo == true || settings.fuzzSeed != 1)
+    {
+        why = "a bad command changed a setting";
+        return false;
+    }
+    return true;
+}
+
+bool checkConsoleRun(std::string &why)
+{
+    bool run = false;
+
+    resetConsole();
+    // a line only runs once its end has come
+    consoleRun("ru", &run);
+    if (run == true)
+    {
+        why = "run was taken before the end of its line";
+        return false;
+    }
+    std::string out = consoleRun("n\r", &run);
+    if (run == false || out != "console: starting a new run\r\n\r\n")
+    {
+        why = "run printed \"" + out + "\"";
+        return false;
+    }
+    consoleRunStarted();
+    consoleRun("", &run);
+    if (run == true)
+    {
+        why = "consoleRunStarted() did not clear the request";
+        return false;
+    }
+    // more than a ring of input between polls: the console keeps up as
+    // long as each poll comes within one ring
+    for (uint32_t n = 0; n < 3 * CONSOLE_RX_RING_LEN / 16; ++n)
+    {
+        consoleRun("set turbo on\r");
+        consoleRun("set turbo off\r");
+    }
+    if (settings.turbo == true || consoleRun("show\r").empty() == true)
+    {
+        why = "the ring did not wrap cleanly";
+        return false;
+    }
+    return true;
+}
+#endif
+
+/* the corpus every stored run is on, unless it says otherwise */
+const int32_t corpus[] = { 0x00010002, -5, 0x7FFF8000, 12345 };
+const uint32_t corpusLen = sizeof(corpus) / sizeof(corpus[0]);
+
+/* how a simulated full run went */
+struct Run
+{
+    uint32_t numCases = corpusLen;      // fewer changes the corpus
+    uint32_t failTest = RESULT_NUM_TESTS;   // group with one failing case
+    uint32_t failCase = 0;
+    uint32_t cycles = 100;              // counter ticks per call
+    uint32_t shortTest = RESULT_NUM_TESTS;  // group stopped after a case
+    bool untimed = false;               // an interrupt hit each first call
+};
+
+resultRecord record(const Run &run)
+{
+    resultRecord r;
+
+    resultStoreInit(&r, corpus, run.numCases);
+    for (uint32_t test = 0; test < RESULT_NUM_TESTS; ++test)
+    {
+        for (uint32_t c = 0; c < run.numCases; ++c)
+        {
+            if (test == run.shortTest && c > 0)
+            {
+                break;
+            }
+            uint32_t start = resultStoreCycles();
+            resultStoreSimCycles += run.cycles;
+            uint32_t cycles = resultStoreCycles() - start;
+            if (run.untimed == true && c == 0)
+            {
+                cycles = RESULT_STORE_UNTIMED;
+            }
+            resultStoreAddCase(&r, (resultTestId)test, c,
+                    test == run.failTest && c == run.failCase ? 1 : 0,
+                    cycles);
+        }
+    }
+    return r;
+}
+
+/* the bytes of r the checksum covers are the same as s's */
+bool sameRecord(const resultRecord &r, const resultRecord &s)
+{
+    return memcmp(&r, &s, offsetof(resultRecord, checksum)) == 0;
+}
+
+bool checkStoreReboot(std::string &why)
+{
+    resultRecord loaded;
+
+    memset(resultStoreSimNvm, 0, sizeof(resultStoreSimNvm));
+    if (resultStoreLoad(&loaded) == true)
+    {
+        why = "an empty store loaded";
+        return false;
+    }
+    resultRecord saved = record(Run());
+    resultStoreSave(&saved, nullptr);
+
+    // a reboot: the store is all that is left
+    uint8_t nvm[RESULT_STORE_NVM_SIZE];
+    memcpy(nvm, resultStoreSimNvm, sizeof(nvm));
+    memset(resultStoreSimNvm, 0xFF, sizeof(resultStoreSimNvm));
+    memcpy(resultStoreSimNvm, nvm, sizeof(nvm));
+
+    if (resultStoreLoad(&loaded) == false || sameRecord(loaded, saved) == false)
+    {
+        why = "the saved record did not load back";
+        return false;
+    }
+    if (loaded.entry[RESULT_MULT].cycles != 100 * corpusLen)
+    {
+        why = "asmMult's cycles are " +
+                std::to_string(loaded.entry[RESULT_MULT].cycles);
+        return false;
+    }
+    return true;
+}
+
+bool checkStoreCorrupt(std::string &why)
+{
+    static const size_t offsets[] = {
+        offsetof(resultRecord, magic),
+        offsetof(resultRecord, version),
+        offsetof(resultRecord, entry) + RESULT_MULT * sizeof(resultEntry) +
+                offsetof(resultEntry, cycles),
+        offsetof(resultRecord, checksum) + 3,
+    };
+    resultRecord saved = record(Run());
+    resultRecord loaded;
+
+    resultStoreSave(&saved, nullptr);
+    for (size_t offset : offsets)
+    {
+        resultStoreSimNvm[offset] ^= 0x10;
+        bool ok = resultStoreLoad(&loaded);
+        resultStoreSimNvm[offset] ^= 0x10;
+        if (ok == true)
+        {
+            why = "a record changed at byte " + std::to_string(offset) +
+                    " loaded";
+            return false;
+        }
+    }
+    if (resultStoreLoad(&loaded) == false)
+    {
+        why = "the record did not load once put right";
+        return false;
+    }
+    return true;
+}
+
+bool checkStoreSave(std::string &why)
+{
+    Run slow;
+    slow.cycles = 300;
+    slow.shortTest = RESULT_MULT;
+    resultRecord previous = record(Run());
+    resultRecord current = record(slow);
+    resultRecord loaded;
+
+    // a group cut short keeps its stored entry; the others are replaced
+    resultStoreSave(&current, &previous);
+    if (resultStoreLoad(&loaded) == false ||
+            memcmp(&loaded.entry[RESULT_MULT], &previous.entry[RESULT_MULT],
+            sizeof(resultEntry)) != 0 ||
+            loaded.entry[RESULT_ABS].cycles != 300 * corpusLen)
+    {
+        why = "the stored entries are not the right mix of the two runs";
+        return false;
+    }
+    return true;
+}
+
+#if !PRINT_QUEUE_FRAMES
+/* resultStoreReport()'s output; *regressions is its return value */
+std::string report(const resultRecord *previous, const resultRecord &current,
+        uint32_t *regressions)
+{
+    volatile bool done = false;
+
+    sinkBytes.clear();
+    *regressions = resultStoreReport(previous, &current, &done);
+    printQueueFlush();
+    return sinkBytes;
+}
+
+bool checkStoreReport(std::string &why)
+{
+    static const char none[] =
+            "========= RESULT STORE: 0 regressions since the last boot\r\n\r\n";
+    resultRecord base = record(Run());
+    uint32_t n;
+    std::string out;
+
+    resetQueue();
+    if (report(&base, record(Run()), &n) != none || n != 0)
+    {
+        why = "the same run reported regressions";
+        return false;
+    }
+
+    Run failing;
+    failing.failTest = RESULT_MULT;
+    failing.failCase = 2;
+    out = report(&base, record(failing), &n);
+    if (n != 1 || out.find("REGRESSION: asmMult: 1 failed checks, was 0\r\n")
+            == std::string::npos)
+    {
+        why = "a new failure printed \"" + out + "\"";
+        return false;
+    }
+    resultRecord failed = record(failing);
+    failing.failCase = 3;
+    out = report(&failed, record(failing), &n);
+    if (n != 1 || out.find("REGRESSION: asmMult: 1 failed checks as before, "
+            "but in different test cases\r\n") == std::string::npos)
+    {
+        why = "a moved failure printed \"" + out + "\"";
+        return false;
+    }
+
+    // the tolerance is a bound: 5% more is not reported, 6% is
+    Run slower;
+    slower.cycles = 100 + RESULT_STORE_CYCLE_TOLERANCE_PCT;
+    if (report(&base, record(slower), &n) != none || n != 0)
+    {
+        why = "cycles within the tolerance were reported";
+        return false;
+    }
+    slower.cycles = 101 + RESULT_STORE_CYCLE_TOLERANCE_PCT;
+    out = report(&base, record(slower), &n);
+    if (n != RESULT_NUM_TESTS ||
+            out.find("REGRESSION: asmMain: 424 cycles, was 400\r\n") ==
+            std::string::npos)
+    {
+        why = "slower calls printed \"" + out + "\"";
+        return false;
+    }
+
+    // not comparable: a total missing cases, or a group cut short
+    Run untimed;
+    untimed.cycles = 200;
+    untimed.untimed = true;
+    Run cutShort;
+    cutShort.failTest = RESULT_MAIN;
+    cutShort.shortTest = RESULT_MAIN;
+    if (report(&base, record(untimed), &n) != none ||
+            report(&base, record(cutShort), &n) != none)
+    {
+        why = "an untimed or cut short group was compared";
+        return false;
+    }
+
+    out = report(nullptr, base, &n);
+    if (n != 0 || out.find("storing these as the baseline") == std::string::npos)
+    {
+        why = "no previous record printed \"" + out + "\"";
+        return false;
+    }
+    Run otherCorpus;
+    otherCorpus.numCases = corpusLen - 1;
+    out = report(&base, record(otherCorpus), &n);
+    if (n != 0 || out.find("test vectors changed") == std::string::npos)
+    {
+        why = "a new corpus printed \"" + out + "\"";
+        return false;
+    }
+    return true;
+}
+#endif
+
+const Check checks[] = {
+#if PRINT_QUEUE_FRAMES
+    { "printQueue framed output",  checkFramedOutput },
+    { "printQueue framed damage",  checkFramedDamage },
+    { "printQueue crc32",          checkCrc },
+#else
+    { "printQueue order",          checkQueueOrder },
+    { "printQueue ring wrap",      checkRingWrap },
+    { "printQueue chain length",   checkChainLength },
+    { "printQueue buffers",        checkBuffers },
+    { "printQueue no sink",        checkNoSink },
+    { "printQueue crc32",          checkCrc },
+    { "console settings",          checkConsoleSettings },
+    { "console engines",           checkConsoleEngines },
+    { "console errors",            checkConsoleErrors },
+    { "console run",               checkConsoleRun },
+#endif
+    { "resultStore reboot",        checkStoreReboot },
+    { "resultStore corrupt",       checkStoreCorrupt },
+    { "resultStore save",          checkStoreSave },
+#if !PRINT_QUEUE_FRAMES
+    { "resultStore report",        checkStoreReport },
+#endif
+};
+
+void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [-v]\n", argv0);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    bool verbose = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-v") == 0)
+        {
+            verbose = true;
+        }
+        else
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    uint32_t failed = 0;
+    for (const Check &c : checks)
+    {
+        std::string why;
+        bool ok = c.run(why);
+        if (ok == false)
+        {
+            ++failed;
+            fprintf(stderr, "FAIL %s: %s\n", c.name, why.c_str());
+        }
+        else if (verbose)
+        {
+            printf("ok   %s\n", c.name);
+        }
+    }
+
+    uint32_t total = sizeof(checks) / sizeof(checks[0]);
+    printf("%lu of %lu checks passed\n", (unsigned long)(total - failed),
+            (unsigned long)total);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/** Host-side golden signature for the exhaustive asmMain sweep
+
+  @File Name
+    sweepGolden.c
+
+  @Summary
+    Computes the signature the board prints at the end of an exhaustive
+    sweep (see firmware/src/sweepFuncs.h) using the reference product, so a
+    board run can be checked without trusting the board.
+
+  @Description
+    Build and run on any host with a C compiler:
+
+        cc -O2 -o sweepGolden sweepGolden.c
+        ./sweepGolden                       # full range 0x00000000..0xFFFFFFFF
+        ./sweepGolden 0x00000000 0x0000FFFF # same range as the board's settings
+
+    SWEEP_BLOCK_LEN and the fold must stay in step with sweepFuncs.c.
+ */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#define SWEEP_BLOCK_LEN 256
+#define SWEEP_SIGNATURE_SEED 0xFFFFFFFFUL
+
+static uint32_t crcTable[256];
+
+static void crc32Init(void)
+{
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        uint32_t c = i;
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            c = (c >> 1) ^ (0xEDB88320 & (0 - (c & 1)));
+        }
+        crcTable[i] = c;
+    }
+}
+
+/* standard CRC-32 (IEEE 802.3) over little-endian words, seeded with
+ * 0xFFFFFFFF, as computed by the DMAC CRC engine */
+static uint32_t crc32Words(const uint32_t *words, uint32_t count)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        for (int byte = 0; byte < 4; ++byte)
+        {
+            uint8_t b = (uint8_t)(words[i] >> (8 * byte));
+            crc = (crc >> 8) ^ crcTable[(crc ^ b) & 0xFF];
+        }
+    }
+    return ~crc;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t first = 0x00000000;
+    uint32_t last = 0xFFFFFFFF;
+    static uint32_t block[SWEEP_BLOCK_LEN];
+    uint32_t blockLen = 0;
+    uint32_t signature = SWEEP_SIGNATURE_SEED;
+
+    if (argc == 3)
+    {
+        first = (uint32_t)strtoul(argv[1], NULL, 0);
+        last = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s [firstInput lastInput]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    crc32Init();
+
+    for (uint32_t packedValue = first; ; ++packedValue)
+    {
+        int32_t a = (int16_t)(packedValue >> 16);
+        int32_t b = (int16_t)(packedValue & 0xFFFF);
+        block[blockLen++] = (uint32_t)(a * b);
+
+        if (blockLen == SWEEP_BLOCK_LEN || packedValue == last)
+        {
+            uint32_t fold[2];
+            fold[0] = signature;
+            fold[1] = crc32Words(block, blockLen);
+            signature = crc32Words(fold, 2);
+            blockLen = 0;
+        }
+        if (packedValue == last)
+        {
+            break;
+        }
+    }
+
+    printf("range 0x%08lx to 0x%08lx: golden signature 0x%08lx\n",
+            (unsigned long)first, (unsigned long)last,
+            (unsigned long)signature);
+    return EXIT_SUCCESS;
+}
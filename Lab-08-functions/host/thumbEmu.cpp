@@ -0,0 +1,1578 @@
+/* ************************************************************************** */
+/** Cortex-M4 Thumb instruction-set emulator for the host tools
+
+  @File Name
+    thumbEmu.cpp
+
+  @Summary
+    Runs the functions from an assembled asmMult.s on a PC, so submissions
+    can be graded, fuzzed and timed without a board.
+
+  @Description
+    See thumbEmu.h. Decoding follows the ARMv7-M Architecture Reference
+    Manual, section A5 (Thumb instruction set encoding); the pseudocode
+    helpers (AddWithCarry, Shift_C, ThumbExpandImm_C, ...) keep the
+    manual's names in camel case.
+ */
+/* ************************************************************************** */
+
+#include "thumbEmu.h"
+
+#include <cstdio>
+
+namespace lab
+{
+
+namespace
+{
+
+enum ShiftType
+{
+    SRType_LSL,
+    SRType_LSR,
+    SRType_ASR,
+    SRType_ROR,
+    SRType_RRX
+};
+
+struct ShiftResult
+{
+    uint32_t value;
+    bool carry;
+};
+
+struct AddResult
+{
+    uint32_t value;
+    bool carry;
+    bool overflow;
+};
+
+uint32_t ror32(uint32_t x, uint32_t n)
+{
+    n &= 31;
+    return n == 0 ? x : (x >> n) | (x << (32 - n));
+}
+
+int32_t signExtend(uint32_t value, uint32_t bits)
+{
+    uint32_t m = 1u << (bits - 1);
+    value &= (bits == 32) ? 0xFFFFFFFFu : ((1u << bits) - 1);
+    return (int32_t)((value ^ m) - m);
+}
+
+ShiftResult shiftC(uint32_t value, int type, uint32_t amount, bool carryIn)
+{
+    if (type == SRType_RRX)
+    {
+        return {(carryIn ? 0x80000000u : 0) | (value >> 1), (value & 1) != 0};
+    }
+    if (amount == 0)
+    {
+        return {value, carryIn};
+    }
+    switch (type)
+    {
+        case SRType_LSL:
+            if (amount < 32)
+            {
+                return {value << amount, ((value >> (32 - amount)) & 1) != 0};
+            }
+            return {0, amount == 32 ? (value & 1) != 0 : false};
+        case SRType_LSR:
+            if (amount < 32)
+            {
+                return {value >> amount, ((value >> (amount - 1)) & 1) != 0};
+            }
+            return {0, amount == 32 ? (value >> 31) != 0 : false};
+        case SRType_ASR:
+            if (amount < 32)
+            {
+                return {(uint32_t)((int32_t)value >> amount),
+                        ((value >> (amount - 1)) & 1) != 0};
+            }
+            return {(value >> 31) != 0 ? 0xFFFFFFFFu : 0, (value >> 31) != 0};
+        default:
+        {
+            uint32_t result = ror32(value, amount);
+            return {result, (result >> 31) != 0};
+        }
+    }
+}
+
+/* DecodeImmShift(): shift type and amount of an immediate shift */
+void decodeImmShift(uint32_t type, uint32_t imm5, int &shiftType,
+        uint32_t &amount)
+{
+    switch (type)
+    {
+        case 0:
+            shiftType = SRType_LSL;
+            amount = imm5;
+            break;
+        case 1:
+            shiftType = SRType_LSR;
+            amount = imm5 == 0 ? 32 : imm5;
+            break;
+        case 2:
+            shiftType = SRType_ASR;
+            amount = imm5 == 0 ? 32 : imm5;
+            break;
+        default:
+            shiftType = imm5 == 0 ? SRType_RRX : SRType_ROR;
+            amount = imm5 == 0 ? 1 : imm5;
+            break;
+    }
+}
+
+AddResult addWithCarry(uint32_t x, uint32_t y, bool carryIn)
+{
+    uint64_t u = (uint64_t)x + y + (carryIn ? 1 : 0);
+    int64_t s = (int64_t)(int32_t)x + (int32_t)y + (carryIn ? 1 : 0);
+    uint32_t result = (uint32_t)u;
+    return {result, (u >> 32) != 0, (int64_t)(int32_t)result != s};
+}
+
+ShiftResult thumbExpandImmC(uint32_t imm12, bool carryIn)
+{
+    uint32_t imm8 = imm12 & 0xFF;
+    if ((imm12 >> 10) == 0)
+    {
+        switch ((imm12 >> 8) & 3)
+        {
+            case 0:
+                return {imm8, carryIn};
+            case 1:
+                return {(imm8 << 16) | imm8, carryIn};
+            case 2:
+                return {(imm8 << 24) | (imm8 << 8), carryIn};
+            default:
+                return {imm8 * 0x01010101u, carryIn};
+        }
+    }
+    uint32_t result = ror32(0x80 | (imm12 & 0x7F), imm12 >> 7);
+    return {result, (result >> 31) != 0};
+}
+
+uint32_t popCount(uint32_t x)
+{
+    return (uint32_t)__builtin_popcount(x);
+}
+
+} // namespace
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: ThumbMemory                                                       */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+size_t ThumbMemory::addRegion(const std::string &name, uint32_t base,
+        uint32_t size, bool writable, bool executable)
+{
+    regions.push_back({name, base, std::vector<uint8_t>(size, 0), writable,
+            executable});
+    return regions.size() - 1;
+}
+
+MemRegion *ThumbMemory::find(uint32_t addr, uint32_t size)
+{
+    for (MemRegion &m : regions)
+    {
+        uint32_t offset = addr - m.base;
+        if (addr >= m.base && offset < m.bytes.size() &&
+                size <= m.bytes.size() - offset)
+        {
+            return &m;
+        }
+    }
+    return nullptr;
+}
+
+const MemRegion *ThumbMemory::find(uint32_t addr, uint32_t size) const
+{
+    return const_cast<ThumbMemory *>(this)->find(addr, size);
+}
+
+bool ThumbMemory::read(uint32_t addr, uint32_t size, uint32_t &value) const
+{
+    const MemRegion *m = find(addr, size);
+    if (m == nullptr)
+    {
+        return false;
+    }
+    const uint8_t *p = &m->bytes[addr - m->base];
+    value = 0;
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        value |= (uint32_t)p[i] << (8 * i);
+    }
+    return true;
+}
+
+bool ThumbMemory::write(uint32_t addr, uint32_t size, uint32_t value)
+{
+    MemRegion *m = find(addr, size);
+    if (m == nullptr || m->writable == false)
+    {
+        return false;
+    }
+    if (writeWindows.empty() == false)
+    {
+        bool allowed = false;
+        for (const AddrRange &w : writeWindows)
+        {
+            if (addr >= w.lo && addr + size <= w.hi)
+            {
+                allowed = true;
+                break;
+            }
+        }
+        if (allowed == false)
+        {
+            return false;
+        }
+    }
+    uint8_t *p = &m->bytes[addr - m->base];
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        p[i] = (uint8_t)(value >> (8 * i));
+    }
+    return true;
+}
+
+bool ThumbMemory::fetch16(uint32_t addr, uint32_t &value) const
+{
+    const MemRegion *m = find(addr, 2);
+    if (m == nullptr || m->executable == false)
+    {
+        return false;
+    }
+    value = m->bytes[addr - m->base] | (m->bytes[addr - m->base + 1] << 8);
+    return true;
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: ThumbCpu helpers                                                  */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+void ThumbCpu::fault(const std::string &reason, uint32_t addr)
+{
+    faultPc = curPc;
+    faultAddr = addr;
+    faultReason = reason;
+    throw FaultEx();
+}
+
+uint32_t ThumbCpu::load(uint32_t addr, uint32_t size)
+{
+    uint32_t value = 0;
+    if (mem.read(addr, size, value) == false)
+    {
+        fault("load from unmapped address", addr);
+    }
+    return value;
+}
+
+void ThumbCpu::store(uint32_t addr, uint32_t size, uint32_t value)
+{
+    if (mem.write(addr, size, value) == false)
+    {
+        fault("store outside the sandbox", addr);
+    }
+}
+
+uint32_t ThumbCpu::readReg(uint32_t reg, uint32_t pc) const
+{
+    return reg == 15 ? pc + 4 : r[reg];
+}
+
+void ThumbCpu::writeReg(uint32_t reg, uint32_t value)
+{
+    if (reg == 15)
+    {
+        fault("unpredictable write to pc");
+    }
+    r[reg] = reg == 13 ? value & ~3u : value;
+}
+
+void ThumbCpu::edge(uint32_t from, uint32_t to)
+{
+    if (edgeMap != nullptr)
+    {
+        uint32_t h = ((from >> 1) * 0x9E3779B1u) ^ (to * 0x85EBCA6Bu);
+        uint8_t &counter = edgeMap[(h ^ (h >> 15)) & (edgeMapSize - 1)];
+        if (counter != 0xFF)
+        {
+            ++counter;
+        }
+    }
+}
+
+/* BranchWritePC() */
+void ThumbCpu::branchTo(uint32_t target)
+{
+    target &= ~1u;
+    edge(curPc, target);
+    if (target == kReturnAddr)
+    {
+        returned = true;
+    }
+    nextPc = target;
+    stepCycles += 2;
+}
+
+/* BXWritePC(); also LoadWritePC() */
+void ThumbCpu::bxWritePC(uint32_t target)
+{
+    if ((target & ~1u) != kReturnAddr && (target & 1) == 0)
+    {
+        fault("INVSTATE: branch to an ARM-state address", target);
+    }
+    branchTo(target);
+}
+
+bool ThumbCpu::conditionPassed(uint32_t cond) const
+{
+    switch (cond)
+    {
+        case 0x0: return z;
+        case 0x1: return !z;
+        case 0x2: return c;
+        case 0x3: return !c;
+        case 0x4: return n;
+        case 0x5: return !n;
+        case 0x6: return v;
+        case 0x7: return !v;
+        case 0x8: return c && !z;
+        case 0x9: return !c || z;
+        case 0xA: return n == v;
+        case 0xB: return n != v;
+        case 0xC: return !z && n == v;
+        case 0xD: return z || n != v;
+        default: return true;
+    }
+}
+
+void ThumbCpu::pushRegs(uint32_t list)
+{
+    uint32_t count = popCount(list);
+    uint32_t addr = r[13] - 4 * count;
+    uint32_t a = addr;
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        if ((list & (1u << i)) != 0)
+        {
+            store(a, 4, r[i]);
+            a += 4;
+        }
+    }
+    r[13] = addr;
+    stepCycles = 1 + count;
+}
+
+void ThumbCpu::popRegs(uint32_t list)
+{
+    uint32_t count = popCount(list);
+    uint32_t a = r[13];
+    uint32_t pcValue = 0;
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        if ((list & (1u << i)) != 0)
+        {
+            uint32_t value = load(a, 4);
+            a += 4;
+            if (i == 15)
+            {
+                pcValue = value;
+            }
+            else
+            {
+                r[i] = value;
+            }
+        }
+    }
+    r[13] = a;
+    stepCycles = 1 + count;
+    if ((list & 0x8000) != 0)
+    {
+        loadWritePC(pcValue);
+    }
+}
+
+/* the ALU operations shared by the 32-bit modified-immediate and shifted-
+ * register encodings (op is bits 8:5 of the first halfword) */
+void ThumbCpu::dataProcessing(uint32_t op, bool setFlags, uint32_t rd,
+        uint32_t rn, uint32_t operand, bool shifterCarry, uint32_t pc)
+{
+    uint32_t a = readReg(rn, pc);
+    uint32_t result = 0;
+    bool logical = true;
+    bool writeResult = true;
+    AddResult sum = {0, false, false};
+
+    switch (op)
+    {
+        case 0x0:   // AND, TST
+            result = a & operand;
+            writeResult = !(rd == 15 && setFlags);
+            break;
+        case 0x1:   // BIC
+            result = a & ~operand;
+            break;
+        case 0x2:   // ORR, MOV
+            result = rn == 15 ? operand : a | operand;
+            break;
+        case 0x3:   // ORN, MVN
+            result = rn == 15 ? ~operand : a | ~operand;
+            break;
+        case 0x4:   // EOR, TEQ
+            result = a ^ operand;
+            writeResult = !(rd == 15 && setFlags);
+            break;
+        case 0x8:   // ADD, CMN
+            sum = addWithCarry(a, operand, false);
+            logical = false;
+            writeResult = !(rd == 15 && setFlags);
+            break;
+        case 0xA:   // ADC
+            sum = addWithCarry(a, operand, c);
+            logical = false;
+            break;
+        case 0xB:   // SBC
+            sum = addWithCarry(a, ~operand, c);
+            logical = false;
+            break;
+        case 0xD:   // SUB, CMP
+            sum = addWithCarry(a, ~operand, true);
+            logical = false;
+            writeResult = !(rd == 15 && setFlags);
+            break;
+        case 0xE:   // RSB
+            sum = addWithCarry(~a, operand, true);
+            logical = false;
+            break;
+        default:
+            fault("unsupported data-processing instruction");
+    }
+    if (logical == false)
+    {
+        result = sum.value;
+    }
+    if (writeResult)
+    {
+        writeReg(rd, result);
+    }
+    if (setFlags)
+    {
+        setNZ(result);
+        if (logical)
+        {
+            c = shifterCarry;
+        }
+        else
+        {
+            c = sum.carry;
+            v = sum.overflow;
+        }
+    }
+}
+
+
+/* ************************************************************************** */
+/* ************************************************************************** */
+// Section: ThumbCpu execution                                                */
+/* ************************************************************************** */
+/* ************************************************************************** */
+
+ThumbCpu::Stop ThumbCpu::call(uint32_t fn, const uint32_t args[4],
+        uint64_t maxInstructions)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        r[i] = args[i];
+    }
+    r[14] = kReturnAddr | 1;
+    itState = 0;
+    returned = false;
+    faultReason.clear();
+    curPc = kReturnAddr;
+    try
+    {
+        bxWritePC(fn);
+        returned = false;
+        for (uint64_t i = 0; i < maxInstructions; ++i)
+        {
+            step();
+            if (returned)
+            {
+                return Stop::Returned;
+            }
+        }
+    }
+    catch (FaultEx &)
+    {
+        return Stop::Fault;
+    }
+    return Stop::Timeout;
+}
+
+void ThumbCpu::step()
+{
+    curPc = nextPc;
+    stepCycles = 1;
+    itJustSet = false;
+
+    uint32_t hw1 = 0;
+    if (mem.fetch16(curPc, hw1) == false)
+    {
+        fault("instruction fetch from a non-executable address", curPc);
+    }
+    bool wide = (hw1 >> 11) >= 0x1D;
+    uint32_t hw2 = 0;
+    if (wide && mem.fetch16(curPc + 2, hw2) == false)
+    {
+        fault("instruction fetch from a non-executable address", curPc + 2);
+    }
+    nextPc = curPc + (wide ? 4 : 2);
+
+    bool execute = true;
+    bool conditional = inITBlock();
+    if (conditional)
+    {
+        execute = conditionPassed(itState >> 4);
+        edge(curPc, curPc | (execute ? 1 : 0));
+    }
+    if (execute)
+    {
+        if (wide)
+        {
+            exec32(curPc, hw1, hw2);
+        }
+        else
+        {
+            exec16(curPc, hw1);
+        }
+    }
+
+    if (conditional && itJustSet == false)
+    {
+        // ITAdvance()
+        itState = (itState & 7) == 0 ?
+                0 : (uint8_t)((itState & 0xE0) | ((itState << 1) & 0x1F));
+    }
+    ++instructions;
+    cycles += stepCycles;
+}
+
+void ThumbCpu::exec16(uint32_t pc, uint32_t hw)
+{
+    bool setFlags = !inITBlock();
+
+    if ((hw >> 14) == 0)
+    {
+        uint32_t opc = (hw >> 11) & 7;
+        if (opc < 3)
+        {
+            // LSL, LSR, ASR (immediate); LSL #0 is MOVS
+            uint32_t rd = hw & 7;
+            uint32_t rm = (hw >> 3) & 7;
+            int type;
+            uint32_t amount;
+            decodeImmShift(opc, (hw >> 6) & 31, type, amount);
+            ShiftResult sr = shiftC(r[rm], type, amount, c);
+            r[rd] = sr.value;
+            if (setFlags)
+            {
+                setNZ(sr.value);
+                c = sr.carry;
+            }
+        }
+        else if (opc == 3)
+        {
+            // ADD, SUB (register or 3-bit immediate)
+            uint32_t rd = hw & 7;
+            uint32_t rn = (hw >> 3) & 7;
+            uint32_t operand = (hw & 0x0400) != 0 ?
+                    (hw >> 6) & 7 : r[(hw >> 6) & 7];
+            AddResult a = (hw & 0x0200) != 0 ?
+                    addWithCarry(r[rn], ~operand, true) :
+                    addWithCarry(r[rn], operand, false);
+            r[rd] = a.value;
+            if (setFlags)
+            {
+                setNZ(a.value);
+                c = a.carry;
+                v = a.overflow;
+            }
+        }
+        else
+        {
+            // MOV, CMP, ADD, SUB (8-bit immediate)
+            uint32_t rdn = (hw >> 8) & 7;
+            uint32_t imm8 = hw & 0xFF;
+            AddResult a;
+            switch ((hw >> 11) & 3)
+            {
+                case 0:
+                    r[rdn] = imm8;
+                    if (setFlags)
+                    {
+                        setNZ(imm8);
+                    }
+                    return;
+                case 1:
+                    a = addWithCarry(r[rdn], ~imm8, true);
+                    setNZ(a.value);
+                    c = a.carry;
+                    v = a.overflow;
+                    return;
+                case 2:
+                    a = addWithCarry(r[rdn], imm8, false);
+                    break;
+                default:
+                    a = addWithCarry(r[rdn], ~imm8, true);
+                    break;
+            }
+            r[rdn] = a.value;
+            if (setFlags)
+            {
+                setNZ(a.value);
+                c = a.carry;
+                v = a.overflow;
+            }
+        }
+        return;
+    }
+
+    if ((hw >> 10) == 0x10)
+    {
+        // data processing (register)
+        uint32_t opcode = (hw >> 6) & 15;
+        uint32_t rm = (hw >> 3) & 7;
+        uint32_t rdn = hw & 7;
+        uint32_t x = r[rdn];
+        uint32_t y = r[rm];
+        uint32_t result = 0;
+        bool write = true;
+        bool arith = false;
+        bool carry = c;
+        AddResult a = {0, false, false};
+        ShiftResult sr;
+
+        switch (opcode)
+        {
+            case 0x0: result = x & y; break;                     // AND
+            case 0x1: result = x ^ y; break;                     // EOR
+            case 0x2: case 0x3: case 0x4: case 0x7:             // LSL LSR ASR ROR
+            {
+                static const int types[8] = {0, 0, SRType_LSL, SRType_LSR,
+                        SRType_ASR, 0, 0, SRType_ROR};
+                sr = shiftC(x, types[opcode], y & 0xFF, c);
+                result = sr.value;
+                carry = sr.carry;
+                break;
+            }
+            case 0x5: a = addWithCarry(x, y, c); arith = true; break;        // ADC
+            case 0x6: a = addWithCarry(x, ~y, c); arith = true; break;       // SBC
+            case 0x8: result = x & y; write = false; setFlags = true; break; // TST
+            case 0x9: a = addWithCarry(~y, 0, true); arith = true; break;    // RSB #0
+            case 0xA:                                                         // CMP
+                a = addWithCarry(x, ~y, true);
+                arith = true;
+                write = false;
+                setFlags = true;
+                break;
+            case 0xB:                                                         // CMN
+                a = addWithCarry(x, y, false);
+                arith = true;
+                write = false;
+                setFlags = true;
+                break;
+            case 0xC: result = x | y; break;                     // ORR
+            case 0xD: result = x * y; break;                     // MUL
+            case 0xE: result = x & ~y; break;                    // BIC
+            default: result = ~y; break;                         // MVN
+        }
+        if (arith)
+        {
+            result = a.value;
+        }
+        if (write)
+        {
+            r[rdn] = result;
+        }
+        if (setFlags)
+        {
+            setNZ(result);
+            if (arith)
+            {
+                c = a.carry;
+                v = a.overflow;
+            }
+            else if (opcode != 0xD)
+            {
+                c = carry;
+            }
+        }
+        return;
+    }
+
+    if ((hw >> 10) == 0x11)
+    {
+        // special data processing, branch and exchange
+        uint32_t rm = (hw >> 3) & 15;
+        uint32_t rdn = ((hw >> 4) & 8) | (hw & 7);
+        switch ((hw >> 8) & 3)
+        {
+            case 0:     // ADD (high registers)
+            {
+                uint32_t result = readReg(rdn, pc) + readReg(rm, pc);
+                if (rdn == 15)
+                {
+                    branchTo(result);
+                }
+                else
+                {
+                    writeReg(rdn, result);
+                }
+                return;
+            }
+            case 1:     // CMP (high registers)
+            {
+                AddResult a = addWithCarry(readReg(rdn, pc), ~readReg(rm, pc),
+                        true);
+                setNZ(a.value);
+                c = a.carry;
+                v = a.overflow;
+                return;
+            }
+            case 2:     // MOV (high registers)
+            {
+                uint32_t value = readReg(rm, pc);
+                if (rdn == 15)
+                {
+                    branchTo(value);
+                }
+                else
+                {
+                    writeReg(rdn, value);
+                }
+                return;
+            }
+            default:    // BX, BLX
+            {
+                uint32_t target = readReg(rm, pc);
+                if ((hw & 0x80) != 0)
+                {
+                    r[14] = (pc + 2) | 1;
+                }
+                bxWritePC(target);
+                return;
+            }
+        }
+    }
+
+    if ((hw >> 11) == 0x09)
+    {
+        // LDR (literal)
+        uint32_t addr = ((pc + 4) & ~3u) + (hw & 0xFF) * 4;
+        r[(hw >> 8) & 7] = load(addr, 4);
+        stepCycles = 2;
+        return;
+    }
+
+    if ((hw >> 12) == 0x5)
+    {
+        // load/store (register offset)
+        uint32_t rt = hw & 7;
+        uint32_t addr = r[(hw >> 3) & 7] + r[(hw >> 6) & 7];
+        stepCycles = 2;
+        switch ((hw >> 9) & 7)
+        {
+            case 0: store(addr, 4, r[rt]); break;                    // STR
+            case 1: store(addr, 2, r[rt]); break;                    // STRH
+            case 2: store(addr, 1, r[rt]); break;                    // STRB
+            case 3: r[rt] = (uint32_t)signExtend(load(addr, 1), 8); break;   // LDRSB
+            case 4: r[rt] = load(addr, 4); break;                    // LDR
+            case 5: r[rt] = load(addr, 2); break;                    // LDRH
+            case 6: r[rt] = load(addr, 1); break;                    // LDRB
+            default: r[rt] = (uint32_t)signExtend(load(addr, 2), 16); break; // LDRSH
+        }
+        return;
+    }
+
+    if ((hw >> 13) == 0x3 || (hw >> 12) == 0x8)
+    {
+        // LDR/STR, LDRB/STRB, LDRH/STRH (5-bit immediate)
+        uint32_t size = (hw >> 12) == 0x8 ? 2 : ((hw & 0x1000) != 0 ? 1 : 4);
+        uint32_t rt = hw & 7;
+        uint32_t addr = r[(hw >> 3) & 7] + ((hw >> 6) & 31) * size;
+        stepCycles = 2;
+        if ((hw & 0x0800) != 0)
+        {
+            r[rt] = load(addr, size);
+        }
+        else
+        {
+            store(addr, size, r[rt]);
+        }
+        return;
+    }
+
+    if ((hw >> 12) == 0x9)
+    {
+        // LDR/STR (SP-relative)
+        uint32_t rt = (hw >> 8) & 7;
+        uint32_t addr = r[13] + (hw & 0xFF) * 4;
+        stepCycles = 2;
+        if ((hw & 0x0800) != 0)
+        {
+            r[rt] = load(addr, 4);
+        }
+        else
+        {
+            store(addr, 4, r[rt]);
+        }
+        return;
+    }
+
+    if ((hw >> 11) == 0x14)
+    {
+        // ADR
+        r[(hw >> 8) & 7] = ((pc + 4) & ~3u) + (hw & 0xFF) * 4;
+        return;
+    }
+
+    if ((hw >> 11) == 0x15)
+    {
+        // ADD (SP plus immediate)
+        r[(hw >> 8) & 7] = r[13] + (hw & 0xFF) * 4;
+        return;
+    }
+
+    if ((hw >> 12) == 0xB)
+    {
+        // miscellaneous 16-bit instructions
+        if ((hw & 0xFF00) == 0xB000)
+        {
+            // ADD, SUB (SP plus/minus immediate)
+            uint32_t imm = (hw & 0x7F) * 4;
+            r[13] = (hw & 0x80) != 0 ? r[13] - imm : r[13] + imm;
+        }
+        else if ((hw & 0xF500) == 0xB100)
+        {
+            // CBZ, CBNZ
+            uint32_t imm = (((hw >> 9) & 1) << 6) | (((hw >> 3) & 31) << 1);
+            bool nonZero = (hw & 0x0800) != 0;
+            if ((r[hw & 7] != 0) == nonZero)
+            {
+                branchTo(pc + 4 + imm);
+            }
+            else
+            {
+                edge(pc, pc + 2);
+            }
+        }
+        else if ((hw & 0xFF00) == 0xB200)
+        {
+            // SXTH, SXTB, UXTH, UXTB
+            uint32_t x = r[(hw >> 3) & 7];
+            uint32_t result;
+            switch ((hw >> 6) & 3)
+            {
+                case 0: result = (uint32_t)signExtend(x, 16); break;
+                case 1: result = (uint32_t)signExtend(x, 8); break;
+                case 2: result = x & 0xFFFF; break;
+                default: result = x & 0xFF; break;
+            }
+            r[hw & 7] = result;
+        }
+        else if ((hw & 0xFE00) == 0xB400)
+        {
+            // PUSH
+            pushRegs((hw & 0xFF) | ((hw & 0x100) != 0 ? 0x4000 : 0));
+        }
+        else if ((hw & 0xFFE8) == 0xB660)
+        {
+            // CPS is ignored in unprivileged code, as in the sandbox
+        }
+        else if ((hw & 0xFF00) == 0xBA00 && ((hw >> 6) & 3) != 2)
+        {
+            // REV, REV16, REVSH
+            uint32_t x = r[(hw >> 3) & 7];
+            uint32_t result;
+            switch ((hw >> 6) & 3)
+            {
+                case 0:
+                    result = __builtin_bswap32(x);
+                    break;
+                case 1:
+                    result = ((x & 0x00FF00FFu) << 8) | ((x >> 8) & 0x00FF00FFu);
+                    break;
+                default:
+                    result = (uint32_t)signExtend(((x & 0xFF) << 8) |
+                            ((x >> 8) & 0xFF), 16);
+                    break;
+            }
+            r[hw & 7] = result;
+        }
+        else if ((hw & 0xFE00) == 0xBC00)
+        {
+            // POP
+            popRegs((hw & 0xFF) | ((hw & 0x100) != 0 ? 0x8000 : 0));
+        }
+        else if ((hw & 0xFF00) == 0xBE00)
+        {
+            fault("BKPT");
+        }
+        else if ((hw & 0xFF00) == 0xBF00)
+        {
+            if ((hw & 0x0F) != 0)
+            {
+                // IT
+                itState = (uint8_t)(hw & 0xFF);
+                itJustSet = true;
+            }
+            // else NOP, YIELD, WFE, WFI, SEV
+        }
+        else
+        {
+            fault("undefined instruction");
+        }
+        return;
+    }
+
+    if ((hw >> 12) == 0xC)
+    {
+        // STM, LDM
+        uint32_t rn = (hw >> 8) & 7;
+        uint32_t list = hw & 0xFF;
+        uint32_t addr = r[rn];
+        uint32_t count = popCount(list);
+        bool isLoad = (hw & 0x0800) != 0;
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            if ((list & (1u << i)) != 0)
+            {
+                if (isLoad)
+                {
+                    r[i] = load(addr, 4);
+                }
+                else
+                {
+                    store(addr, 4, r[i]);
+                }
+                addr += 4;
+            }
+        }
+        if (isLoad == false || (list & (1u << rn)) == 0)
+        {
+            r[rn] = addr;
+        }
+        stepCycles = 1 + count;
+        return;
+    }
+
+    if ((hw >> 12) == 0xD)
+    {
+        // B<c>, UDF, SVC
+        uint32_t cond = (hw >> 8) & 15;
+        if (cond == 0xE)
+        {
+            fault("UDF");
+        }
+        if (cond == 0xF)
+        {
+            fault("SVC");
+        }
+        if (conditionPassed(cond))
+        {
+            branchTo(pc + 4 + (uint32_t)signExtend((hw & 0xFF) << 1, 9));
+        }
+        else
+        {
+            edge(pc, pc + 2);
+        }
+        return;
+    }
+
+    if ((hw >> 11) == 0x1C)
+    {
+        // B (unconditional)
+        branchTo(pc + 4 + (uint32_t)signExtend((hw & 0x7FF) << 1, 12));
+        return;
+    }
+
+    fault("undefined instruction");
+}
+
+void ThumbCpu::exec32(uint32_t pc, uint32_t hw1, uint32_t hw2)
+{
+    uint32_t op1 = (hw1 >> 11) & 3;
+    uint32_t op2 = (hw1 >> 4) & 0x7F;
+
+    if (op1 == 1)
+    {
+        if ((op2 & 0x64) == 0x00)
+        {
+            execLoadStoreMultiple(pc, hw1, hw2);
+        }
+        else if ((op2 & 0x64) == 0x04)
+        {
+            execDualTable(pc, hw1, hw2);
+        }
+        else if ((op2 & 0x60) == 0x20)
+        {
+            // data processing (shifted register)
+            int type;
+            uint32_t amount;
+            uint32_t imm5 = (((hw2 >> 12) & 7) << 2) | ((hw2 >> 6) & 3);
+            decodeImmShift((hw2 >> 4) & 3, imm5, type, amount);
+            ShiftResult sr = shiftC(r[hw2 & 15], type, amount, c);
+            dataProcessing((hw1 >> 5) & 15, (hw1 & 0x10) != 0,
+                    (hw2 >> 8) & 15, hw1 & 15, sr.value, sr.carry, pc);
+        }
+        else
+        {
+            fault("coprocessor instruction");
+        }
+        return;
+    }
+
+    if (op1 == 2)
+    {
+        if ((hw2 & 0x8000) != 0)
+        {
+            execBranchMisc(pc, hw1, hw2);
+            return;
+        }
+        uint32_t imm12 = (((hw1 >> 10) & 1) << 11) | (((hw2 >> 12) & 7) << 8) |
+                (hw2 & 0xFF);
+        uint32_t rn = hw1 & 15;
+        uint32_t rd = (hw2 >> 8) & 15;
+        if ((hw1 & 0x0200) == 0)
+        {
+            // data processing (modified immediate)
+            ShiftResult imm = thumbExpandImmC(imm12, c);
+            dataProcessing((hw1 >> 5) & 15, (hw1 & 0x10) != 0, rd, rn,
+                    imm.value, imm.carry, pc);
+            return;
+        }
+
+        // data processing (plain binary immediate)
+        uint32_t lsb = (((hw2 >> 12) & 7) << 2) | ((hw2 >> 6) & 3);
+        uint32_t low5 = hw2 & 31;
+        switch ((hw1 >> 4) & 0x1F)
+        {
+            case 0x00:  // ADDW, ADR
+                writeReg(rd, rn == 15 ? ((pc + 4) & ~3u) + imm12 : r[rn] + imm12);
+                return;
+            case 0x04:  // MOVW
+                writeReg(rd, ((hw1 & 15) << 12) | imm12);
+                return;
+            case 0x0A:  // SUBW, ADR
+                writeReg(rd, rn == 15 ? ((pc + 4) & ~3u) - imm12 : r[rn] - imm12);
+                return;
+            case 0x0C:  // MOVT
+                writeReg(rd, (r[rd] & 0xFFFF) | (((hw1 & 15) << 12 | imm12) << 16));
+                return;
+            case 0x10:  // SSAT
+            case 0x18:  // USAT
+            {
+                bool isSigned = ((hw1 >> 4) & 0x1F) == 0x10;
+                if ((hw1 & 0x20) != 0 && lsb == 0)
+                {
+                    fault("unsupported SIMD saturate");
+                }
+                int type = (hw1 & 0x20) != 0 ? SRType_ASR : SRType_LSL;
+                int64_t x = (int32_t)shiftC(r[rn], type, lsb, c).value;
+                int64_t lo = isSigned ? -(1LL << low5) : 0;
+                int64_t hi = isSigned ? (1LL << low5) - 1 : (1LL << low5) - 1;
+                writeReg(rd, (uint32_t)(x < lo ? lo : (x > hi ? hi : x)));
+                return;
+            }
+            case 0x14:  // SBFX
+            case 0x1C:  // UBFX
+            {
+                uint32_t width = low5 + 1;
+                if (lsb + width > 32)
+                {
+                    fault("unpredictable bit field");
+                }
+                uint32_t field = (r[rn] >> lsb) &
+                        (width == 32 ? 0xFFFFFFFFu : (1u << width) - 1);
+                writeReg(rd, ((hw1 >> 4) & 0x1F) == 0x14 ?
+                        (uint32_t)signExtend(field, width) : field);
+                return;
+            }
+            case 0x16:  // BFI, BFC
+            {
+                if (low5 < lsb)
+                {
+                    fault("unpredictable bit field");
+                }
+                uint32_t width = low5 - lsb + 1;
+                uint32_t mask = (width == 32 ? 0xFFFFFFFFu : (1u << width) - 1) << lsb;
+                uint32_t src = rn == 15 ? 0 : r[rn] << lsb;
+                writeReg(rd, (r[rd] & ~mask) | (src & mask));
+                return;
+            }
+            default:
+                fault("undefined instruction");
+        }
+    }
+
+    // op1 == 3
+    if ((op2 & 0x71) == 0x00 || (op2 & 0x67) == 0x01 ||
+            (op2 & 0x67) == 0x03 || (op2 & 0x67) == 0x05)
+    {
+        execLoadStoreSingle(pc, hw1, hw2);
+    }
+    else if ((op2 & 0x70) == 0x20)
+    {
+        execDataReg(hw1, hw2);
+    }
+    else if ((op2 & 0x70) == 0x30)
+    {
+        execMultiply(hw1, hw2);
+    }
+    else
+    {
+        fault("coprocessor or undefined instruction");
+    }
+}
+
+void ThumbCpu::execBranchMisc(uint32_t pc, uint32_t hw1, uint32_t hw2)
+{
+    uint32_t s = (hw1 >> 10) & 1;
+    uint32_t j1 = (hw2 >> 13) & 1;
+    uint32_t j2 = (hw2 >> 11) & 1;
+    uint32_t imm11 = hw2 & 0x7FF;
+
+    if ((hw2 & 0x5000) == 0x0000)
+    {
+        uint32_t cond = (hw1 >> 6) & 15;
+        if ((cond & 0xE) != 0xE)
+        {
+            // B<c>.W
+            uint32_t imm = (s << 20) | (j2 << 19) | (j1 << 18) |
+                    ((hw1 & 0x3F) << 12) | (imm11 << 1);
+            if (conditionPassed(cond))
+            {
+                branchTo(pc + 4 + (uint32_t)signExtend(imm, 21));
+            }
+            else
+            {
+                edge(pc, pc + 4);
+            }
+            return;
+        }
+        if ((hw1 & 0xFFF0) == 0xF3A0 || (hw1 & 0xFFF0) == 0xF3B0)
+        {
+            // hints (NOP.W, ...) and barriers (DSB, DMB, ISB)
+            return;
+        }
+        fault("unsupported system instruction");
+    }
+
+    uint32_t i1 = (~(j1 ^ s)) & 1;
+    uint32_t i2 = (~(j2 ^ s)) & 1;
+    uint32_t imm = (s << 24) | (i1 << 23) | (i2 << 22) | ((hw1 & 0x3FF) << 12) |
+            (imm11 << 1);
+    uint32_t target = pc + 4 + (uint32_t)signExtend(imm, 25);
+
+    if ((hw2 & 0x5000) == 0x1000)
+    {
+        // B.W
+        branchTo(target);
+    }
+    else if ((hw2 & 0x5000) == 0x5000)
+    {
+        // BL
+        r[14] = (pc + 4) | 1;
+        branchTo(target);
+    }
+    else
+    {
+        fault("INVSTATE: BLX to ARM state", target);
+    }
+}
+
+void ThumbCpu::execLoadStoreSingle(uint32_t pc, uint32_t hw1, uint32_t hw2)
+{
+    uint32_t size = 1u << ((hw1 >> 5) & 3);
+    bool isLoad = (hw1 & 0x10) != 0;
+    bool isSigned = (hw1 & 0x100) != 0;
+    uint32_t rn = hw1 & 15;
+    uint32_t rt = (hw2 >> 12) & 15;
+    uint32_t addr;
+    bool writeBack = false;
+    uint32_t offsetAddr = 0;
+
+    if (size > 4)
+    {
+        fault("undefined instruction");
+    }
+    if (rn == 15)
+    {
+        // literal
+        if (isLoad == false)
+        {
+            fault("undefined instruction");
+        }
+        uint32_t base = (pc + 4) & ~3u;
+        addr = (hw1 & 0x80) != 0 ? base + (hw2 & 0xFFF) : base - (hw2 & 0xFFF);
+    }
+    else if ((hw1 & 0x80) != 0)
+    {
+        // 12-bit immediate offset
+        addr = r[rn] + (hw2 & 0xFFF);
+    }
+    else if ((hw2 & 0x800) != 0)
+    {
+        // 8-bit immediate, pre/post-indexed or negative offset
+        uint32_t imm8 = hw2 & 0xFF;
+        offsetAddr = (hw2 & 0x200) != 0 ? r[rn] + imm8 : r[rn] - imm8;
+        addr = (hw2 & 0x400) != 0 ? offsetAddr : r[rn];
+        writeBack = (hw2 & 0x100) != 0;
+    }
+    else if (((hw2 >> 6) & 0x3F) == 0)
+    {
+        // register offset
+        addr = r[rn] + (r[hw2 & 15] << ((hw2 >> 4) & 3));
+    }
+    else
+    {
+        fault("undefined instruction");
+    }
+
+    stepCycles = 2;
+    if (isLoad)
+    {
+        if (rt == 15 && size != 4)
+        {
+            // PLD, PLI
+            return;
+        }
+        uint32_t value = load(addr, size);
+        if (isSigned)
+        {
+            value = (uint32_t)signExtend(value, 8 * size);
+        }
+        if (writeBack)
+        {
+            r[rn] = offsetAddr;
+        }
+        if (rt == 15)
+        {
+            loadWritePC(value);
+        }
+        else
+        {
+            writeReg(rt, value);
+        }
+    }
+    else
+    {
+        store(addr, size, readReg(rt, pc));
+        if (writeBack)
+        {
+            r[rn] = offsetAddr;
+        }
+    }
+}
+
+void ThumbCpu::execLoadStoreMultiple(uint32_t pc, uint32_t hw1, uint32_t hw2)
+{
+    (void)pc;
+    uint32_t mode = (hw1 >> 7) & 3;
+    bool writeBack = (hw1 & 0x20) != 0;
+    bool isLoad = (hw1 & 0x10) != 0;
+    uint32_t rn = hw1 & 15;
+    uint32_t list = hw2 & (isLoad ? 0xDFFF : 0x5FFF);
+    uint32_t count = popCount(list);
+
+    if (mode != 1 && mode != 2)
+    {
+        fault("unsupported SRS/RFE");
+    }
+    if (rn == 13 && writeBack && isLoad == false && mode == 2)
+    {
+        pushRegs(list);
+        return;
+    }
+    if (rn == 13 && writeBack && isLoad && mode == 1)
+    {
+        popRegs(list);
+        return;
+    }
+
+    uint32_t start = mode == 1 ? r[rn] : r[rn] - 4 * count;
+    uint32_t addr = start;
+    uint32_t pcValue = 0;
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        if ((list & (1u << i)) != 0)
+        {
+            if (isLoad)
+            {
+                uint32_t value = load(addr, 4);
+                if (i == 15)
+                {
+                    pcValue = value;
+                }
+                else
+                {
+                    r[i] = value;
+                }
+            }
+            else
+            {
+                store(addr, 4, r[i]);
+            }
+            addr += 4;
+        }
+    }
+    if (writeBack && (isLoad == false || (list & (1u << rn)) == 0))
+    {
+        r[rn] = mode == 1 ? r[rn] + 4 * count : r[rn] - 4 * count;
+    }
+    stepCycles = 1 + count;
+    if (isLoad && (list & 0x8000) != 0)
+    {
+        loadWritePC(pcValue);
+    }
+}
+
+void ThumbCpu::execDualTable(uint32_t pc, uint32_t hw1, uint32_t hw2)
+{
+    bool p = (hw1 & 0x100) != 0;
+    bool u = (hw1 & 0x80) != 0;
+    bool w = (hw1 & 0x20) != 0;
+    bool isLoad = (hw1 & 0x10) != 0;
+    uint32_t rn = hw1 & 15;
+
+    if (p == false && w == false)
+    {
+        if ((hw1 & 0xFFF0) == 0xE8D0 && (hw2 & 0xFFE0) == 0xF000)
+        {
+            // TBB, TBH
+            uint32_t base = readReg(rn, pc);
+            uint32_t index = r[hw2 & 15];
+            uint32_t halfwords = (hw2 & 0x10) != 0 ?
+                    load(base + (index << 1), 2) : load(base + index, 1);
+            branchTo(pc + 4 + 2 * halfwords);
+            stepCycles += 2;
+            return;
+        }
+        fault("unsupported exclusive access");
+    }
+
+    // LDRD, STRD
+    uint32_t rt = (hw2 >> 12) & 15;
+    uint32_t rt2 = (hw2 >> 8) & 15;
+    uint32_t imm = (hw2 & 0xFF) * 4;
+    uint32_t base = rn == 15 ? (pc + 4) & ~3u : r[rn];
+    uint32_t offsetAddr = u ? base + imm : base - imm;
+    uint32_t addr = p ? offsetAddr : base;
+    if (isLoad)
+    {
+        uint32_t lo = load(addr, 4);
+        uint32_t hi = load(addr + 4, 4);
+        writeReg(rt, lo);
+        writeReg(rt2, hi);
+    }
+    else
+    {
+        store(addr, 4, r[rt]);
+        store(addr + 4, 4, r[rt2]);
+    }
+    if (w)
+    {
+        r[rn] = offsetAddr;
+    }
+    stepCycles = 3;
+}
+
+void ThumbCpu::execDataReg(uint32_t hw1, uint32_t hw2)
+{
+    uint32_t op1 = (hw1 >> 4) & 15;
+    uint32_t op2 = (hw2 >> 4) & 15;
+    uint32_t rn = hw1 & 15;
+    uint32_t rd = (hw2 >> 8) & 15;
+    uint32_t rm = hw2 & 15;
+
+    if ((op1 & 0x8) == 0 && op2 == 0)
+    {
+        // LSL, LSR, ASR, ROR (register)
+        static const int types[4] = {SRType_LSL, SRType_LSR, SRType_ASR,
+                SRType_ROR};
+        ShiftResult sr = shiftC(r[rn], types[(op1 >> 1) & 3], r[rm] & 0xFF, c);
+        writeReg(rd, sr.value);
+        if ((op1 & 1) != 0)
+        {
+            setNZ(sr.value);
+            c = sr.carry;
+        }
+        return;
+    }
+    if ((op1 & 0x8) == 0 && (op2 & 0x8) != 0)
+    {
+        // SXTH, UXTH, SXTB, UXTB and their accumulating forms
+        uint32_t x = ror32(r[rm], ((hw2 >> 4) & 3) * 8);
+        uint32_t result;
+        switch (op1)
+        {
+            case 0: result = (uint32_t)signExtend(x, 16); break;
+            case 1: result = x & 0xFFFF; break;
+            case 4: result = (uint32_t)signExtend(x, 8); break;
+            case 5: result = x & 0xFF; break;
+            default: fault("unsupported SIMD extend");
+        }
+        writeReg(rd, rn == 15 ? result : r[rn] + result);
+        return;
+    }
+    if ((op1 & 0xC) == 0x8 && (op2 & 0xC) == 0x8)
+    {
+        uint32_t x = r[rm];
+        uint32_t result;
+        switch (((op1 & 3) << 2) | (op2 & 3))
+        {
+            case 0x4: result = __builtin_bswap32(x); break;             // REV
+            case 0x5:                                                   // REV16
+                result = ((x & 0x00FF00FFu) << 8) | ((x >> 8) & 0x00FF00FFu);
+                break;
+            case 0x6:                                                   // RBIT
+                result = 0;
+                for (int i = 0; i < 32; ++i)
+                {
+                    result |= ((x >> i) & 1) << (31 - i);
+                }
+                break;
+            case 0x7:                                                   // REVSH
+                result = (uint32_t)signExtend(((x & 0xFF) << 8) |
+                        ((x >> 8) & 0xFF), 16);
+                break;
+            case 0xC: result = x == 0 ? 32 : __builtin_clz(x); break;  // CLZ
+            default: fault("unsupported saturating or SEL instruction");
+        }
+        writeReg(rd, result);
+        return;
+    }
+    fault("unsupported SIMD instruction");
+}
+
+void ThumbCpu::execMultiply(uint32_t hw1, uint32_t hw2)
+{
+    uint32_t op1 = (hw1 >> 4) & 7;
+    uint32_t rn = hw1 & 15;
+    uint32_t rm = hw2 & 15;
+    uint32_t rd = (hw2 >> 8) & 15;
+    uint32_t ra = (hw2 >> 12) & 15;
+
+    if ((hw1 & 0x0080) == 0)
+    {
+        // 32 x 32 -> 32 multiplies and the DSP 16 x 16 multiplies
+        uint32_t op2 = (hw2 >> 4) & 3;
+        uint32_t acc = ra == 15 ? 0 : r[ra];
+        switch (op1)
+        {
+            case 0:
+                if (op2 == 0)
+                {
+                    writeReg(rd, r[rn] * r[rm] + acc);                  // MLA, MUL
+                }
+                else if (op2 == 1)
+                {
+                    writeReg(rd, r[ra] - r[rn] * r[rm]);                // MLS
+                }
+                else
+                {
+                    fault("undefined instruction");
+                }
+                stepCycles = ra == 15 ? 1 : 2;
+                return;
+            case 1:                                                     // SMLA<x><y>
+            {
+                int32_t a = (int16_t)(r[rn] >> ((hw2 & 0x20) != 0 ? 16 : 0));
+                int32_t b = (int16_t)(r[rm] >> ((hw2 & 0x10) != 0 ? 16 : 0));
+                writeReg(rd, (uint32_t)(a * b) + acc);
+                return;
+            }
+            case 2:                                                     // SMLAD, SMUAD
+            {
+                uint32_t m = (hw2 & 0x10) != 0 ? ror32(r[rm], 16) : r[rm];
+                int32_t p1 = (int16_t)r[rn] * (int16_t)m;
+                int32_t p2 = (int16_t)(r[rn] >> 16) * (int16_t)(m >> 16);
+                writeReg(rd, (uint32_t)p1 + (uint32_t)p2 + acc);
+                return;
+            }
+            default:
+                fault("unsupported DSP multiply");
+        }
+    }
+
+    // long multiplies and divides
+    uint32_t op2 = (hw2 >> 4) & 15;
+    uint32_t rdLo = ra;
+    uint32_t rdHi = rd;
+    switch ((op1 << 4) | op2)
+    {
+        case 0x00:  // SMULL
+        {
+            int64_t p = (int64_t)(int32_t)r[rn] * (int32_t)r[rm];
+            writeReg(rdLo, (uint32_t)p);
+            writeReg(rdHi, (uint32_t)((uint64_t)p >> 32));
+            return;
+        }
+        case 0x1F:  // SDIV
+        {
+            int32_t a = (int32_t)r[rn];
+            int32_t b = (int32_t)r[rm];
+            int32_t q = b == 0 ? 0 : (a == INT32_MIN && b == -1) ? a : a / b;
+            writeReg(rd, (uint32_t)q);
+            stepCycles = 7;
+            return;
+        }
+        case 0x20:  // UMULL
+        {
+            uint64_t p = (uint64_t)r[rn] * r[rm];
+            writeReg(rdLo, (uint32_t)p);
+            writeReg(rdHi, (uint32_t)(p >> 32));
+            return;
+        }
+        case 0x3F:  // UDIV
+            writeReg(rd, r[rm] == 0 ? 0 : r[rn] / r[rm]);
+            stepCycles = 7;
+            return;
+        case 0x40:  // SMLAL
+        {
+            int64_t acc = (int64_t)(((uint64_t)r[rdHi] << 32) | r[rdLo]);
+            int64_t p = acc + (int64_t)(int32_t)r[rn] * (int32_t)r[rm];
+            writeReg(rdLo, (uint32_t)p);
+            writeReg(rdHi, (uint32_t)((uint64_t)p >> 32));
+            return;
+        }
+        case 0x60:  // UMLAL
+        {
+            uint64_t acc = ((uint64_t)r[rdHi] << 32) | r[rdLo];
+            uint64_t p = acc + (uint64_t)r[rn] * r[rm];
+            writeReg(rdLo, (uint32_t)p);
+            writeReg(rdHi, (uint32_t)(p >> 32));
+            return;
+        }
+        default:
+            fault("unsupported long multiply");
+    }
+}
+
+} // namespace lab
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,185 @@
+/* ************************************************************************** */
+/** Cortex-M4 Thumb instruction-set emulator for the host tools
+
+  @File Name
+    thumbEmu.h
+
+  @Summary
+    Runs the functions from an assembled asmMult.s on a PC, so submissions
+    can be graded, fuzzed and timed without a board.
+
+  @Description
+    ThumbCpu executes the ARMv7E-M Thumb instructions a lab solution uses:
+    all 16-bit encodings, 32-bit data processing (immediate, shifted
+    register, register shifts, extends, bit fields, MOVW/MOVT), loads and
+    stores of every size and addressing mode, LDM/STM/PUSH/POP, LDRD/STRD,
+    TBB/TBH, branches, IT blocks, MUL/MLA/MLS, the long multiplies and
+    SDIV/UDIV. Hints and barriers are no-ops. Anything else (coprocessor,
+    DSP SIMD, exclusives, system registers, SVC, BKPT, UDF) stops the call
+    with a fault, like the UsageFault it would raise on the board.
+
+    Memory is a list of regions. An access outside every region, a write
+    to a read-only region, or a write outside the write windows while any
+    are set, stops the call with a fault; the write windows play the role
+    of the MPU sandbox in firmware/src/sandbox.h.
+
+    call() runs a function until it returns to the caller, faults, or
+    executes maxInstructions instructions (a timeout).
+
+    cycles is an estimate using the Cortex-M4 instruction timings with zero
+    wait-state memory (loads 2, taken branches 3, LDM/STM 1 + registers,
+    divides 7); it is good for comparing solutions, not for exact counts.
+
+    If edgeMap is set, every branch (taken or not) and every conditional
+    instruction in an IT block bumps a counter for its (from, to) edge, for
+    coverage-guided fuzzing.
+
+    emuCheck.cpp runs hand-assembled encodings through it and checks the
+    registers and flags they leave.
+ */
+/* ************************************************************************** */
+
+#ifndef _THUMB_EMU_H    /* Guard against multiple inclusion */
+#define _THUMB_EMU_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace lab
+{
+
+    /* a block of emulated memory */
+struct MemRegion
+{
+    std::string name;
+    uint32_t base;
+    std::vector<uint8_t> bytes;
+    bool writable;
+    bool executable;
+};
+
+    /* [lo, hi) */
+struct AddrRange
+{
+    uint32_t lo;
+    uint32_t hi;
+};
+
+class ThumbMemory
+{
+public:
+    /* add a region; returns its index */
+    size_t addRegion(const std::string &name, uint32_t base, uint32_t size,
+            bool writable, bool executable);
+    MemRegion &region(size_t index) { return regions[index]; }
+
+    /* false if any byte is unmapped, or (for writes) not writable */
+    bool read(uint32_t addr, uint32_t size, uint32_t &value) const;
+    bool write(uint32_t addr, uint32_t size, uint32_t value);
+
+    /* false unless the halfword is in an executable region */
+    bool fetch16(uint32_t addr, uint32_t &value) const;
+
+    /* writes are limited to these ranges while the list is not empty */
+    std::vector<AddrRange> writeWindows;
+
+private:
+    MemRegion *find(uint32_t addr, uint32_t size);
+    const MemRegion *find(uint32_t addr, uint32_t size) const;
+
+    std::vector<MemRegion> regions;
+};
+
+class ThumbCpu
+{
+public:
+    enum class Stop
+    {
+        Returned,   // the function returned to the caller
+        Timeout,    // maxInstructions executed
+        Fault       // see faultPc, faultAddr and faultReason
+    };
+
+    explicit ThumbCpu(ThumbMemory &memory) : mem(memory) {}
+
+    /* call fn (bit 0 set for Thumb) with up to four arguments in r0-r3.
+     * The other registers keep their values, so the caller can seed
+     * r4-r11 and set sp first. */
+    Stop call(uint32_t fn, const uint32_t args[4], uint64_t maxInstructions);
+
+    uint32_t r[16] = {0};
+    bool n = false, z = false, c = false, v = false;
+
+    /* totals since construction */
+    uint64_t instructions = 0;
+    uint64_t cycles = 0;
+
+    /* details of the last Stop::Fault */
+    uint32_t faultPc = 0;
+    uint32_t faultAddr = 0;
+    std::string faultReason;
+
+    /* optional coverage counters; size must be a power of two */
+    uint8_t *edgeMap = nullptr;
+    uint32_t edgeMapSize = 0;
+
+    /* return address given to the called function */
+    static constexpr uint32_t kReturnAddr = 0xFFFFFFF0u;
+
+private:
+    struct FaultEx
+    {
+    };
+
+    void step();
+    void exec16(uint32_t pc, uint32_t hw);
+    void exec32(uint32_t pc, uint32_t hw1, uint32_t hw2);
+    void execBranchMisc(uint32_t pc, uint32_t hw1, uint32_t hw2);
+    void execLoadStoreSingle(uint32_t pc, uint32_t hw1, uint32_t hw2);
+    void execDataReg(uint32_t hw1, uint32_t hw2);
+    void execMultiply(uint32_t hw1, uint32_t hw2);
+    void execLoadStoreMultiple(uint32_t pc, uint32_t hw1, uint32_t hw2);
+    void execDualTable(uint32_t pc, uint32_t hw1, uint32_t hw2);
+    void pushRegs(uint32_t list);
+    void popRegs(uint32_t list);
+    void dataProcessing(uint32_t op, bool setFlags, uint32_t rd, uint32_t rn,
+            uint32_t operand, bool shifterCarry, uint32_t pc);
+
+    bool conditionPassed(uint32_t cond) const;
+    bool inITBlock() const { return (itState & 0x0F) != 0; }
+    bool lastInITBlock() const { return (itState & 0x0F) == 0x08; }
+
+    uint32_t readReg(uint32_t n, uint32_t pc) const;
+    void writeReg(uint32_t n, uint32_t value);
+    void branchTo(uint32_t target);
+    void bxWritePC(uint32_t target);
+    void loadWritePC(uint32_t target) { bxWritePC(target); }
+
+    uint32_t load(uint32_t addr, uint32_t size);
+    void store(uint32_t addr, uint32_t size, uint32_t value);
+    [[noreturn]] void fault(const std::string &reason, uint32_t addr = 0);
+
+    void edge(uint32_t from, uint32_t to);
+    void setNZ(uint32_t result)
+    {
+        n = (result >> 31) != 0;
+        z = result == 0;
+    }
+
+    ThumbMemory &mem;
+    uint32_t curPc = 0;
+    uint32_t nextPc = 0;
+    uint8_t itState = 0;
+    bool itJustSet = false;
+    bool returned = false;
+    uint32_t stepCycles = 1;
+};
+
+} // namespace lab
+
+#endif /* _THUMB_EMU_H */
+
+/* *****************************************************************************
+ End of File
+ */
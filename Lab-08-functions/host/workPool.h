@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/** Work-stealing thread pool for the host tools
+
+  @File Name
+    workPool.h
+
+  @Summary
+    Runs task(0) .. task(count - 1) on several threads.
+
+  @Description
+    Each thread starts with a contiguous share of the indexes in its own
+    deque and takes work from the back of it. A thread whose deque is empty
+    steals from the front of another's, so one slow task (a submission
+    that loops until its timeout, say) does not leave the other threads
+    idle while its neighbours wait behind it.
+
+    Tasks are independent: a task must not touch state another task uses
+    without its own locking.
+ */
+/* ************************************************************************** */
+
+#ifndef _WORK_POOL_H    /* Guard against multiple inclusion */
+#define _WORK_POOL_H
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lab
+{
+
+/* number of threads to use when the user does not say */
+inline unsigned defaultThreadCount()
+{
+    unsigned n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+}
+
+inline void runParallel(size_t count, unsigned threads,
+        const std::function<void(size_t)> &task)
+{
+    struct Queue
+    {
+        std::mutex lock;
+        std::deque<size_t> items;
+    };
+
+    if (threads == 0)
+    {
+        threads = 1;
+    }
+    if (threads > count)
+    {
+        threads = count == 0 ? 1 : (unsigned)count;
+    }
+    std::vector<Queue> queues(threads);
+    for (unsigned w = 0; w < threads; ++w)
+    {
+        for (size_t i = w * count / threads; i < (w + 1) * count / threads; ++i)
+        {
+            queues[w].items.push_back(i);
+        }
+    }
+
+    auto worker = [&](unsigned self)
+    {
+        while (true)
+        {
+            size_t index = 0;
+            bool found = false;
+            {
+                std::lock_guard<std::mutex> hold(queues[self].lock);
+                if (queues[self].items.empty() == false)
+                {
+                    index = queues[self].items.back();
+                    queues[self].items.pop_back();
+                    found = true;
+                }
+            }
+            for (unsigned k = 1; k < threads && found == false; ++k)
+            {
+                Queue &victim = queues[(self + k) % threads];
+                std::lock_guard<std::mutex> hold(victim.lock);
+                if (victim.items.empty() == false)
+                {
+                    index = victim.items.front();
+                    victim.items.pop_front();
+                    found = true;
+                }
+            }
+            if (found == false)
+            {
+                return;     // nothing is ever added, so every deque is empty
+            }
+            task(index);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned w = 1; w < threads; ++w)
+    {
+        pool.emplace_back(worker, w);
+    }
+    worker(0);
+    for (std::thread &t : pool)
+    {
+        t.join();
+    }
+}
+
+} // namespace lab
+
+#endif /* _WORK_POOL_H */
+
+/* *****************************************************************************
+ End of File
+ */